@@ -12,12 +12,33 @@
 #include "driver/gpio.h"
 #include "esp_sleep.h"
 #include "esp_random.h"
+#include "esp_timer.h"
+#include "esp_cpu.h"
 #include "bsp/esp-bsp.h"
 #include "bsp/display.h"
 #include "qmi8658.h"
 #include "esp_lvgl_port.h"
 #include "driver/i2c_master.h" // For I2C master functions
 #include "rtc_pcf85063a.h" // For PCF85063A RTC
+#include "poi_tx_sched.h" // Per-link transmit pacing
+#include "poi_frame_codec.h" // Delta/RLE frame compression
+#include "poi_batch.h" // Multi-frame writes
+#include "poi_conn_mgr.h" // Connection slots for up to POI_MAX_DEVICES poi
+#include "poi_sync.h" // Clock sync and timed frames for lockstep playback
+#include "poi_link_profile.h" // 2M PHY / DLE / short interval negotiation
+#include "poi_tx_pool.h" // Preallocated mbufs that stream writes are built in
+#include "poi_peer_cache.h" // Known poi addresses and GATT handles, kept in NVS
+#include "poi_seq.h" // Pre-rendered sequences uploaded to the poi
+#include "poi_rate_ctl.h" // Per-link colour depth / frame rate steps under congestion
+#include "poi_telemetry.h" // Per-link stats published for the UI and the UART dump
+#include "poi_protocol.h" // Wire protocol: commands, packet layouts, notification decoding
+#include "poi_bcast.h" // Connectionless stream to any number of poi over periodic advertising
+#include "poi_rx_ring.h" // Notifications handed from the host task to stream_task
+#include "poi_fixed.h" // Fixed-point math for the render path (no FPU on the C6)
+#include "poi_palette.h" // Whole-strip palette colour kernels the modes render through
+#include "poi_modes.h" // Render modes, their state types and the registry the mode screens are built from
+#include "poi_mode_bench.h" // Per-mode render cost and golden frames on synthetic motion and audio traces
+#include "poi_imu_predict.h" // IMU state extrapolated to when the poi show the frame
 
 /* NimBLE BLE */
 #include "host/ble_hs.h"
@@ -37,19 +58,85 @@ static const char *TAG = "WATCH_POI";
 #define POWER_BUTTON_GPIO GPIO_NUM_18
 #define MODE_BUTTON_GPIO  GPIO_NUM_9
 #define TARGET_NAME       "Open Pixel Poi"
-#define START_BYTE        0xD0
-#define CC_START_STREAM   21
-#define CC_STREAM_DATA    24
-#define CC_GET_CONFIG     23
 #define BYTES_PER_PIXEL   3
-#define GLOBAL_BRIGHTNESS 0.27
-#define NUM_LEDS          21
+#define GLOBAL_BRIGHTNESS POI_FX_Q16(0.27)
+#define NUM_LEDS          POI_MODE_LEDS // Canonical render resolution; each poi gets it resampled to its own LED count
 #define LVGL_PORT_LOCK_TIMEOUT_MS 50
-#define MIN_BRIGHTNESS    0.05f // Minimum brightness to ensure LEDs are never completely off
+#define FRAME_INTERVAL_MS 40    // Render cadence (25fps) until the links are profiled, independent of how fast each link drains
+#define FPS_MIN           20
+#define FPS_MAX           60
+#define LINK_HEADROOM     0.6f  // Share of the modelled link capacity the frame rate may use
+#define TX_TICK_MS        5     // How often stream_task retries frames pending on a busy link
+#define FRAME_RING_SIZE   16    // Rendered frames kept for links that fall behind (power of 2)
+#define MAX_WRITE_LEN     244   // ATT payload of one write at the preferred MTU of 247
+#define PLAYOUT_LATENCY_MS 120  // Timed frames are shown this long after rendering, on every poi at once
+#define RATE_CTL_LATENCY_MS (PLAYOUT_LATENCY_MS / 2) // Render-to-send delay past which a link lowers its quality
+#define CONFIG_TIMEOUT_MS 1000  // Poi that don't answer CC_GET_CONFIG by then are streamed at NUM_LEDS
+#define PEER_CACHE_SAVE_MS 2000 // Poi cache changes this close together go to NVS in one write
+#define STATUS_PERIOD_MS  100   // How often poi with POI_CAP_STATUS report their queue, battery and late frames
+#define RECONNECT_TIMEOUT_MS 3000 // Direct connect attempt to the known poi before falling back to a scan
+#define CONNECT_TIMEOUT_MS 5000   // Connect to a poi that was just seen advertising
+#define CANDIDATE_WINDOW_MS 150   // Keep scanning this long after the first poi shows up to collect the others (~1.5 adv intervals)
+#define CANDIDATE_MAX_AGE_MS 2000 // Candidates not seen advertising for this long are dropped
+#define SEQ_SECONDS       8     // Length of a pre-rendered sequence (long press on a mode)
+#define SEQ_MAX_BYTES     16384 // Per poi; a sequence that compresses worse is cut short
+#define SEQ_TICK_MS       1000  // Play ticks keep the poi on the shared timeline
+#define RESCAN_MS         5000  // Scan window between direct connect attempts while a known poi is missing
+#define SCAN_ITVL_MS        30    // Scan cycle; the window sets how much of it the radio listens
+#define SCAN_WINDOW_IDLE_MS 30    // Listening per cycle while nothing streams (100%, fastest bring-up)
+#define SCAN_WINDOW_BUSY_MS 10    // While other poi stream: a third of the airtime, the rest stays with their links
+#define BCAST_SLICES      2     // Broadcast: the frame and its mirror image for the poi in the other hand
+#define BCAST_REPEAT      (PLAYOUT_LATENCY_MS / FRAME_INTERVAL_MS) // Broadcast frames go out again this many frames later
+#define BCAST_ADV_ITVL_MS 100   // Extended adv pointing scanning poi at the periodic train
+#define BCAST_INSTANCE    0
+#define BCAST_SID         1
+#define FRAME_WRITE_HDR_LEN (POI_TIMED_HDR_LEN + POI_BATCH_HDR_LEN + POI_BATCH_FRAME_HDR_LEN) // Around a raw frame as stage_frames() builds it
+#define MAX_POI_LEDS      ((MAX_WRITE_LEN - FRAME_WRITE_HDR_LEN) / BYTES_PER_PIXEL) // A raw frame must fit one write
 
 // Uncomment the following line to enable initial RTC time setting
 // #define SET_INITIAL_RTC_TIME
 
+// Poi stream capabilities, negotiated from the protocol version in the config reply
+#define POI_PROTO_VERSION_COMPRESSED 2
+#define POI_PROTO_VERSION_BATCH      3
+#define POI_PROTO_VERSION_TIMED      4
+#define POI_PROTO_VERSION_SEQ        5
+#define POI_PROTO_VERSION_DEPTH      6
+#define POI_PROTO_VERSION_STATUS     7
+#define POI_CAP_COMPRESSED (1 << 0)
+#define POI_CAP_BATCH      (1 << 1)
+#define POI_CAP_TIMED      (1 << 2)
+#define POI_CAP_SEQ        (1 << 3)
+#define POI_CAP_DEPTH      (1 << 4) // Decodes POI_FRAME_KEY_PACKED4
+#define POI_CAP_STATUS     (1 << 5) // Sends CC_STATUS notifications
+
+// Uncomment to send stream writes through ble_gattc_write_no_rsp_flat (copy into an msys mbuf) instead of the tx pools
+// #define POI_TX_FLAT_COPY
+
+// Uncomment to print each streaming link's telemetry record (poi_telemetry.h) as a "TLM <hex>" console line this often
+// #define POI_TELEMETRY_DUMP_MS 1000
+
+// Uncomment to treat poi firmware that doesn't report its protocol version as this version
+// #define POI_ASSUME_PROTO_VERSION POI_PROTO_VERSION_BATCH
+
+// Uncomment to scan without scan requests; only poi with the service UUID or name in the adv PDU itself are found
+// #define SCAN_PASSIVE
+
+// Uncomment to scan only for the known poi while any is missing (controller accept list); new poi wait until they are back
+// #define SCAN_KNOWN_ONLY
+
+// Uncomment to log the palette kernels' cycles per strip against the per-pixel HSV loop they replaced, once at startup
+// #define POI_PALETTE_BENCH
+
+// Uncomment to print every mode's cycles and instructions per frame on the bench traces, and the compositor's per layer, once at startup (see poi_mode_bench.h)
+// #define POI_MODE_BENCH
+
+// Uncomment to check every mode's frames on the bench traces against the golden frames, once at startup
+// #define POI_MODE_GOLDEN
+
+// Uncomment to render from the IMU as sampled instead of predicted to when the poi show the frame
+// #define IMU_NO_PREDICT
+
 // PMU I2C Config (using defaults if not in sdkconfig)
 #ifndef CONFIG_I2C_MASTER_PORT_NUM
 #define CONFIG_I2C_MASTER_PORT_NUM  I2C_NUM_0
@@ -72,6 +159,8 @@ static const char *TAG = "WATCH_POI";
 #define N_SAMPLES           16  // Reduced FFT size for memory efficiency
 #define SAMPLE_RATE         2000 // Reduced sample rate for efficiency
 #define CHANNELS            2    // Stereo audio
+#define AUDIO_IDLE_POLL_MS  50   // How often audio_fft_task checks for a mode that listens while none does
+static_assert(N_SAMPLES / 2 == POI_MODE_BINS, "The modes read the lower half of the FFT");
 
 // Audio & FFT Buffers (aligned for DSP library)
 __attribute__((aligned(16))) int16_t raw_data[N_SAMPLES * CHANNELS];
@@ -79,6 +168,9 @@ __attribute__((aligned(16))) float audio_buffer[N_SAMPLES];
 __attribute__((aligned(16))) float wind[N_SAMPLES];
 __attribute__((aligned(16))) float fft_buffer[N_SAMPLES * 2];
 __attribute__((aligned(16))) float spectrum[N_SAMPLES / 2]; // Stores magnitude spectrum in dB
+// What the modes read (see audio_snapshot), published with spectrum under audio_spectrum_buffer_mutex
+static int32_t audio_level;                // Mean |windowed sample|, Q15
+static int32_t spectrum_q8[N_SAMPLES / 2]; // spectrum in dB, Q8
 
 // --- Display Stuff (LVGL Object Pointers) ---
 static lv_obj_t *battery_label;
@@ -91,6 +183,7 @@ static lv_obj_t *clock_unix_label;
 static lv_obj_t *mic_sens_low_btn;      // New: Mic Sensitivity Low button
 static lv_obj_t *mic_sens_medium_btn;   // New: Mic Sensitivity Medium button
 static lv_obj_t *mic_sens_high_btn;     // New: Mic Sensitivity High button
+static lv_obj_t *bcast_btn;
 static float mic_sensitivity_low = 1.0f;
 static float mic_sensitivity_medium = 3.0f;
 static float mic_sensitivity_high = 5.0f;
@@ -116,90 +209,27 @@ static lv_obj_t *selected_mode_btn = NULL; // To keep track of the currently sel
 
 // Forward declaration for the event callback
 static void mode_button_event_cb(lv_event_t * e);
+static void mode_button_long_press_cb(lv_event_t * e);
 
 
-// --- Mode Function Pointer Type ---
-typedef void (*poi_mode_fn)(qmi8658_data_t *s, uint8_t *pixel_data, size_t len);
-
-// --- Forward Declarations for POI Modes (Functions defined later) ---
-void mode_gravity_rainbow(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_spin_fire(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_centrifugal_rainbow(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_flow_trail(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_gravity_compass(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_velocity_prism(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_warp_speed(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_plasma_ghost(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_fire_ice_split(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_shifting_horizon(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_gravity_ball(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_compass_navigator(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_audio_spectrum(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_audio_wave(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_audio_bass_pulse(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_audio_motion_fusion(qmi8658_data_t *s, uint8_t *p, size_t l);      // New mode
-void mode_audio_peak_color(qmi8658_data_t *s, uint8_t *p, size_t l);      // New mode
-void mode_audio_rainbow_cycle(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_audio_vu_meter(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_audio_beat_fade(qmi8658_data_t *s, uint8_t *p, size_t l);
-void mode_audio_frequency_lava(qmi8658_data_t *s, uint8_t *p, size_t l);
-
-
-// --- Mode Names, Current Mode, Mode Table, and Mode Count (Defined early for UI and tasks) ---
-static const char* mode_names[] = {
-"Gravity \n Rainbow",
-    "Spin \n Fire",
-    "Centrifugal \n Rain",
-    "Flow \n Trail",
-    "Gravity \n Compass",
-    "Velocity \n Prism",
-    "Warp \n Speed",
-    "Plasma \n Ghost",
-    "Fire/Ice \n Split",
-    "Shifting \n Horizon",
-    "Gravity \n Ball",
-    "Navigator",
-    "Audio Spectrum",
-    "Audio Wave",          // New mode
-    "Audio Bass Pulse",     // New mode
-    "Audio+Motion",         // New mode
-    "Audio Peak",            // New mode
-    "Audio \n Rainbow",
-    "Audio \n VU Meter",
-    "Audio \n Beat Fade",
-    "Audio \n Lava"
-};
+// --- Modes: poi_modes::registry is the one list; the screens show it in order ---
+#define MODE_COUNT       poi_modes::COUNT
+#define MODES_PER_SCREEN 9 // 3x3 grid
+static_assert(poi_modes::count(poi_modes::registry, poi_modes::AUDIO) <= MODES_PER_SCREEN, "Audio modes overflow the audio screen");
+static_assert(MODE_COUNT <= 2 * MODES_PER_SCREEN ||
+              poi_modes::count(poi_modes::registry, poi_modes::AUDIO, 2 * MODES_PER_SCREEN) == MODE_COUNT - 2 * MODES_PER_SCREEN,
+              "Modes past the two mode screens are only reachable from the audio screen");
 
 static int current_mode = 0; // Global declaration for current mode
 
-// Note: mode_table definition uses function pointers, so the functions need to be
-//       either defined or forward-declared before this table is initialized.
-//       Forward declarations are above.
-poi_mode_fn mode_table[] = {
-mode_gravity_rainbow,
-    mode_spin_fire,
-    mode_centrifugal_rainbow,
-    mode_flow_trail,
-    mode_gravity_compass,
-    mode_velocity_prism,
-    mode_warp_speed,
-    mode_plasma_ghost,
-    mode_fire_ice_split,
-    mode_shifting_horizon,
-    mode_gravity_ball,
-    mode_compass_navigator,
-    mode_audio_spectrum,
-    mode_audio_wave,          // New mode
-    mode_audio_bass_pulse,     // New mode
-    mode_audio_motion_fusion,  // New mode
-    mode_audio_peak_color,      // New mode
-    mode_audio_rainbow_cycle,
-    mode_audio_vu_meter,
-    mode_audio_beat_fade,
-    mode_audio_frequency_lava
-};
-
-#define MODE_COUNT (sizeof(mode_table) / sizeof(poi_mode_fn))
+// Sequence show requests from the UI, picked up by stream_task
+#define SEQ_REQUEST_NONE -1
+#define SEQ_REQUEST_STOP -2
+static volatile int seq_request = SEQ_REQUEST_NONE; // A mode to pre-render and upload, or SEQ_REQUEST_STOP
+static volatile int seq_show_mode = -1; // Mode playing from uploaded sequences, -1 = live streaming
+static volatile bool bcast_request = false; // Broadcast button pressed, stream_task turns it on or off
+static volatile bool bcast_on = false;
+
 
 // Helper function to create a mode icon
 static lv_obj_t *create_mode_icon(lv_obj_t *parent, int mode_idx, const char *mode_name) {
@@ -218,6 +248,7 @@ static lv_obj_t *create_mode_icon(lv_obj_t *parent, int mode_idx, const char *mo
 
     // Use the static free function as the event callback
     lv_obj_add_event_cb(btn, mode_button_event_cb, LV_EVENT_CLICKED, (void *)new int(mode_idx)); // Pass mode index as user data
+    lv_obj_add_event_cb(btn, mode_button_long_press_cb, LV_EVENT_LONG_PRESSED, (void *)new int(mode_idx)); // Long press: upload as a sequence
 
     return btn;
 }
@@ -227,7 +258,8 @@ static void mode_button_event_cb(lv_event_t * e) {
     lv_obj_t *btn_target = (lv_obj_t*)lv_event_get_target(e); // Added explicit cast
     int *mode_index_ptr = (int *)lv_event_get_user_data(e);
     current_mode = *mode_index_ptr;
-    ESP_LOGI(TAG, "Mode button clicked: %s, setting mode to %d", mode_names[current_mode], current_mode);
+    ESP_LOGI(TAG, "Mode button clicked: %s, setting mode to %d", poi_modes::registry[current_mode].name, current_mode);
+    if (seq_show_mode >= 0 && seq_show_mode != current_mode) seq_request = SEQ_REQUEST_STOP; // Back to live frames
 
     if (selected_mode_btn != NULL) {
         lv_obj_clear_state(selected_mode_btn, LV_STATE_CHECKED); // Clear previous selection
@@ -238,13 +270,21 @@ static void mode_button_event_cb(lv_event_t * e) {
     // The original mode_label update is no longer needed/relevant for the new UI
     // if (lvgl_port_lock(LVGL_PORT_LOCK_TIMEOUT_MS)) {
     //     if (mode_label != NULL) {
-    //         lv_label_set_text_fmt(mode_label, "MODE: \n\n %s", mode_names[current_mode]);
+    //         lv_label_set_text_fmt(mode_label, "MODE: \n\n %s", poi_modes::registry[current_mode].name);
     //     }
     //     lvgl_port_unlock();
     // }
 }
 
 
+// Long press on a mode: pre-render it and play it from the poi's flash (the click that follows selects it)
+static void mode_button_long_press_cb(lv_event_t * e) {
+    int *mode_index_ptr = (int *)lv_event_get_user_data(e);
+    ESP_LOGI(TAG, "Mode button long-pressed: uploading %s as a sequence", poi_modes::registry[*mode_index_ptr].name);
+    seq_request = *mode_index_ptr;
+}
+
+
 // Forward declarations for PMU I2C callbacks
 static int pmu_register_read(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint8_t len);
 static int pmu_register_write_byte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint8_t len);
@@ -253,8 +293,22 @@ static int pmu_register_write_byte(uint8_t devAddr, uint8_t regAddr, uint8_t *da
 static qmi8658_dev_t imu_dev;
 static uint8_t own_addr_type;
 static bool is_streaming = false;
+static int64_t frame_interval_us = FRAME_INTERVAL_MS * 1000; // Render cadence, chosen from link capacity
+static int32_t anim_step_q16 = 1 << 16; // Frame interval relative to the 25 fps the modes' per-frame steps were tuned at, Q16
+static poi_modes::arena<poi_modes::registry, 2> mode_arena;
+static poi_modes::instance<poi_modes::registry> live_mode; // Renders the frame ring every link streams from
+static poi_modes::instance<poi_modes::registry> seq_mode;  // Renders sequences, each from the mode's start
+static volatile bool audio_wanted = false; // A running mode reads audio; audio_fft_task idles otherwise
 static SemaphoreHandle_t audio_spectrum_buffer_mutex; // For audio FFT
 
+// Copy the audio the modes read into in; keeps the previous snapshot if the FFT holds the lock too long
+static void audio_snapshot(poi_modes::input *in) {
+    if (xSemaphoreTake(audio_spectrum_buffer_mutex, 10) != pdTRUE) return;
+    in->audio_level = audio_level;
+    memcpy(in->spectrum_q8, spectrum_q8, sizeof(in->spectrum_q8));
+    xSemaphoreGive(audio_spectrum_buffer_mutex);
+}
+
 // --- PMU Global State ---
 static i2c_master_bus_handle_t i2c_bus_handle = NULL; // Global handle for the shared I2C bus
 static i2c_master_dev_handle_t pmu_dev_handle = NULL; // Handle for the PMU device on the bus
@@ -265,38 +319,104 @@ static bool is_charging = false;
 static bool is_usb_connected = false;
 static SemaphoreHandle_t pmu_data_mutex; // Mutex to protect PMU data
 
+// Per-poi data; the link state and connection handle of slot i live in poi_conns.slot[i]
 typedef struct {
-    uint16_t conn_handle;
     uint16_t rx_char_handle;
     uint16_t tx_char_handle; // Handle for the TX characteristic
-    bool discovered;
-    bool stream_started;
+    uint16_t tx_cccd_handle; // Its Client Characteristic Configuration descriptor, which turns notifications on
     // POI Device Configuration
     uint8_t num_leds;
     uint8_t protocol_version;
     uint16_t frame_buffer_size;
-    uint16_t hardware_buffer_limit;
+    uint16_t hardware_buffer_limit; // Largest write the poi accepts, 0 = no limit
     float battery_voltage; // Stored as float for display
     int free_space_kb; // Stored as int for display
     bool config_received; // Flag to indicate config has been received
+    int64_t config_requested_us; // When CC_GET_CONFIG was sent, for the timeout
+    uint8_t caps; // POI_CAP_* negotiated when streaming starts
+    uint16_t mtu; // Negotiated ATT MTU
+    poi_link_profile_t link; // PHY, PDU size and interval in effect
+    uint32_t busy_at_report; // tx.busy_count at the last rate choice, to spot a saturated link
+    float saturated_bps; // Throughput carried while the stack pushed back, 0 = never saturated
+    poi_tx_sched_t tx; // Transmit pacing and per-link frame counters
+    poi_rate_ctl_t rate; // Quality level this link can carry right now
+    poi_telem_t telem; // Link stats published by stream_task, read by the UI and the dump
+    poi_frame_codec_t codec; // Reference frame for delta compression
+    uint32_t next_seq; // Oldest rendered frame this poi hasn't been sent yet
+    poi_clock_sync_t clock; // Offset of the poi's clock, for presentation timestamps
+    uint32_t tx_cycles; // CPU cycles spent building and handing over stream writes
+    ble_addr_t addr; // Identity address, the key into peer_cache
+    bool handles_cached; // RX/TX handles came from peer_cache and discovery was skipped
+    uint16_t svc_start_handle; // Poi service range, characteristics are only looked for in it
+    uint16_t svc_end_handle;
+    int64_t disc_start_us; // When GATT discovery started
+    uint8_t disc_callbacks; // Services and characteristics discovery reported
+    bool config_replied; // The poi answered CC_GET_CONFIG (config_received is also set by the timeout)
+    int64_t connect_us; // When the connect that led to this link was issued
+    int64_t seq_tick_us; // Next play tick while the sequence show runs
+    poi_proto::notify_decoder notify; // Reassembles TX notifications into replies, fed by stream_task
+    int64_t status_us; // Last CC_STATUS, 0 = none yet
+    uint32_t frames_sent_at_status; // tx.frames_sent then, to estimate the poi's queue in between
+    uint8_t poi_queued; // From the last CC_STATUS
+    uint8_t poi_queue_cap;
+    uint16_t poi_last_seq; // Newest timed frame the poi acknowledged
+    uint16_t poi_late; // Late frame counter, wraps
+    uint32_t late_frames; // Total reported late while streaming
+    uint32_t queue_holds; // Sends held because the poi's queue was estimated full
+    uint32_t show_lag_us; // Render to the poi showing the frame, smoothed; 0 = nothing sent yet
 } poi_device_t;
 
-static poi_device_t devices[2] = {
-    { .conn_handle = BLE_HS_CONN_HANDLE_NONE, .rx_char_handle = 0, .tx_char_handle = 0, .discovered = false, .stream_started = false,
-      .num_leds = 0, .protocol_version = 0, .frame_buffer_size = 0, .hardware_buffer_limit = 0, .battery_voltage = 0.0f, .free_space_kb = 0, .config_received = false },
-    { .conn_handle = BLE_HS_CONN_HANDLE_NONE, .rx_char_handle = 0, .tx_char_handle = 0, .discovered = false, .stream_started = false,
-      .num_leds = 0, .protocol_version = 0, .frame_buffer_size = 0, .hardware_buffer_limit = 0, .battery_voltage = 0.0f, .free_space_kb = 0, .config_received = false }
-};
+static_assert(POI_MAX_DEVICES <= CONFIG_BT_NIMBLE_MAX_CONNECTIONS, "Raise CONFIG_BT_NIMBLE_MAX_CONNECTIONS");
+static_assert(POI_CONN_NONE == BLE_HS_CONN_HANDLE_NONE, "poi_conn_mgr handle sentinel");
+
+static poi_conn_mgr_t poi_conns;
+static poi_device_t devices[POI_MAX_DEVICES]; // Reset when a slot connects
+static poi_tx_pool_t tx_pools[POI_MAX_DEVICES]; // Not reset: the stack may still hold a previous link's writes
+static poi_rx_ring_t notify_ring; // Filled by the host task, drained by stream_task
+static_assert(MAX_WRITE_LEN <= POI_TX_POOL_PAYLOAD, "A write must fit one tx pool block");
+
+static poi_peer_cache_t peer_cache; // Loaded at boot, changed on the host task only, saved by peer_cache_task
+static SemaphoreHandle_t peer_cache_mutex; // Held while peer_cache changes or is copied for saving
+static TaskHandle_t peer_cache_task_handle;
+static int64_t reconnect_after_us = 0; // Next direct connect to known poi; scans in between
+static int64_t connect_issued_us = 0; // When the pending ble_gap_connect was issued
+static int64_t link_lost_us = 0; // Last disconnect (0 = boot), for time-to-streaming
+static int64_t scan_started_us = 0; // Running scan, 0 = none
+static uint32_t scan_reports = 0; // Advertising reports the controller passed up during it
+static uint32_t scan_matched = 0; // ...of which from poi
+static struct ble_npl_callout candidate_window; // Ends candidate collection, runs on the host task
+// Config bring-up runs on the host task, which owns poi_conns and connects, scans and discovers
+static struct ble_npl_callout config_timeout[POI_MAX_DEVICES]; // Armed by each CC_GET_CONFIG
+static struct ble_npl_event config_reply_event[POI_MAX_DEVICES]; // Posted by stream_task with the reply in config_replies
+static poi_proto::config_reply config_replies[POI_MAX_DEVICES];
+static struct ble_npl_callout link_timeout[POI_MAX_DEVICES]; // Armed while a link profile request is pending
+
+// Sequence uploads, keyed by poi address so an upload resumes after a reconnect; owned by stream_task
+typedef struct {
+    ble_addr_t addr;
+    uint8_t *blob; // NULL = unused
+    poi_seq_upload_t up;
+} seq_job_t;
+
+static seq_job_t seq_jobs[POI_MAX_DEVICES];
+static int64_t seq_show_start_us = 0; // When frame 0 of the show plays, 0 until every upload has finished
+static uint8_t seq_next_id = 1;
 
+static const ble_uuid128_t svc_uuid = BLE_UUID128_INIT(0x9E, 0xCA, 0xDC, 0x24, 0x0E, 0xE5, 0xA9, 0xE0, 0x93, 0xF3, 0xA3, 0xB5, 0x01, 0x00, 0x40, 0x6E);
 static const ble_uuid128_t rx_uuid = BLE_UUID128_INIT(0x9E, 0xCA, 0xDC, 0x24, 0x0E, 0xE5, 0xA9, 0xE0, 0x93, 0xF3, 0xA3, 0xB5, 0x02, 0x00, 0x40, 0x6E);
 static const ble_uuid128_t tx_uuid = BLE_UUID128_INIT(0x9E, 0xCA, 0xDC, 0x24, 0x0E, 0xE5, 0xA9, 0xE0, 0x93, 0xF3, 0xA3, 0xB5, 0x03, 0x00, 0x40, 0x6E);
+static const ble_uuid16_t cccd_uuid = BLE_UUID16_INIT(BLE_GATT_DSC_CLT_CFG_UUID16);
+static const ble_uuid16_t chr_decl_uuid = BLE_UUID16_INIT(0x2803); // Starts the next characteristic in a descriptor search
 
 // Forward declarations for LVGL event callbacks and BLE central functions
 static void gesture_event_cb(lv_event_t * e);
 static void set_mic_sensitivity_low_cb(lv_event_t * e);    // New
 static void set_mic_sensitivity_medium_cb(lv_event_t * e); // New
 static void set_mic_sensitivity_high_cb(lv_event_t * e);   // New
+static void bcast_button_cb(lv_event_t * e);
 static int on_disc_char(uint16_t conn_handle, const struct ble_gatt_error *error, const struct ble_gatt_chr *chr, void *arg);
+static int on_disc_dsc(uint16_t conn_handle, const struct ble_gatt_error *error, uint16_t chr_val_handle, const struct ble_gatt_dsc *dsc, void *arg);
+static int on_disc_svc(uint16_t conn_handle, const struct ble_gatt_error *error, const struct ble_gatt_svc *svc, void *arg);
 static int ble_central_event(struct ble_gap_event *event, void *arg);
 void poi_scan_start(void);
 
@@ -318,8 +438,8 @@ void ui_init() {
     lv_obj_set_style_pad_all(poi1_flex_cont, 5, 0); // Reduced padding
     lv_obj_center(poi1_flex_cont);
 
-    for (int i = 0; i < 9 && i < MODE_COUNT; ++i) { // Modes 0-8 for a 3x3 grid
-        create_mode_icon(poi1_flex_cont, i, mode_names[i]);
+    for (int i = 0; i < MODES_PER_SCREEN && i < MODE_COUNT; ++i) {
+        create_mode_icon(poi1_flex_cont, i, poi_modes::registry[i].name);
     }
 
 
@@ -338,8 +458,8 @@ void ui_init() {
     lv_obj_set_style_pad_all(poi2_flex_cont, 5, 0); // Reduced padding
     lv_obj_center(poi2_flex_cont);
 
-    for (int i = 9; i < 18 && i < MODE_COUNT; ++i) { // Modes 9-17 for a 3x3 grid
-        create_mode_icon(poi2_flex_cont, i, mode_names[i]);
+    for (int i = MODES_PER_SCREEN; i < 2 * MODES_PER_SCREEN && i < MODE_COUNT; ++i) {
+        create_mode_icon(poi2_flex_cont, i, poi_modes::registry[i].name);
     }
 
 
@@ -358,8 +478,8 @@ void ui_init() {
     lv_obj_set_style_pad_all(audio_modes_flex_cont, 5, 0); // Reduced padding
     lv_obj_align(audio_modes_flex_cont, LV_ALIGN_TOP_MID, 0, 0); // Align to top-mid
 
-    for (int i = 12; i < MODE_COUNT; ++i) { // Modes 12 to end
-        create_mode_icon(audio_modes_flex_cont, i, mode_names[i]);
+    for (int i = 0; i < MODE_COUNT; ++i) {
+        if (poi_modes::registry[i].cat == poi_modes::AUDIO) create_mode_icon(audio_modes_flex_cont, i, poi_modes::registry[i].name);
     }
 
     // Mic Sensitivity Buttons Container on Audio Screen
@@ -427,7 +547,7 @@ void ui_init() {
 
     // POI Info Box
     poi_info_box = lv_obj_create(sys_info_cont);
-    lv_obj_set_size(poi_info_box, lv_pct(90), 80);
+    lv_obj_set_size(poi_info_box, lv_pct(90), LV_SIZE_CONTENT); // Grows with the per-poi link lines
     lv_obj_set_style_bg_color(poi_info_box, lv_color_hex(0x202020), 0);
     lv_obj_set_style_pad_all(poi_info_box, 5, 0);
     lv_obj_set_style_align(poi_info_box, LV_ALIGN_CENTER, 0);
@@ -438,6 +558,16 @@ void ui_init() {
     lv_obj_set_style_text_font(poi_info_label, &lv_font_montserrat_18, 0);
     lv_obj_center(poi_info_label);
 
+    // Broadcast toggle: frames for any number of poi over periodic advertising
+    bcast_btn = lv_btn_create(sys_info_cont);
+    lv_obj_set_size(bcast_btn, 140, 40);
+    lv_obj_set_style_align(bcast_btn, LV_ALIGN_CENTER, 0);
+    lv_obj_set_style_bg_color(bcast_btn, lv_color_hex(0x404040), 0);
+    lv_obj_add_event_cb(bcast_btn, bcast_button_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_t *bcast_label = lv_label_create(bcast_btn);
+    lv_label_set_text(bcast_label, "Broadcast");
+    lv_obj_center(bcast_label);
+
 
     // Clock Info
     clock_time_label = lv_label_create(sys_info_cont);
@@ -538,6 +668,10 @@ static void set_mic_sensitivity_high_cb(lv_event_t * e) {
     ESP_LOGI(TAG, "Mic Sensitivity set to HIGH (%.1fx)", current_mic_sensitivity);
 }
 
+static void bcast_button_cb(lv_event_t * e) {
+    bcast_request = true; // Button colour follows once stream_task has acted on it
+}
+
 
 
 // --- PMU I2C Functions ---
@@ -589,1133 +723,695 @@ static int pmu_register_write_byte(uint8_t devAddr, uint8_t regAddr, uint8_t *da
     return 0;
 }
 
-// --- Helper: HSV to RGB ---
-void hsv_to_rgb(uint8_t h_in, uint8_t *r, uint8_t *g, uint8_t *b) {
-    uint16_t h_scaled = h_in * 3;
-    if (h_scaled < 255) { *r = 255 - h_scaled; *g = h_scaled; *b = 0; }
-    else if (h_scaled < 510) { h_scaled -= 255; *r = 0; *g = 255 - h_scaled; *b = h_scaled; }
-    else { h_scaled -= 510; *r = h_scaled; *g = 0; *b = 255 - h_scaled; }
-}
-
-// =============================================================================
-// POI MODE FUNCTION DEFINITIONS
-// =============================================================================
-void mode_gravity_rainbow(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    float angle = atan2f(s->accelY, s->accelX);
-    uint8_t r, g, b;
-    hsv_to_rgb((uint8_t)(((angle + M_PI) / (2.0f * M_PI)) * 255.0f), &r, &g, &b);
-    for (int i = 0; i < l; i += 3) { p[i] = r; p[i+1] = g; p[i+2] = b; }
-}
-
-void mode_spin_fire(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    // Increase sensitivity: Divide by 4 instead of 64
-    // Add +40 so it's always a little bit visible even when still
-    float val = (fabs(s->gyroZ) / 4.0f) + 40.0f;
-    uint8_t intensity = (uint8_t)fminf(val, 255.0f);
-
-    for (int i = 0; i < l; i += 3) {
-        p[i] = intensity;          // Red
-        p[i+1] = intensity / 3;    // Orange tint (slightly more than /4)
-        p[i+2] = 0;
-    }
-}
-
-
-void mode_centrifugal_rainbow(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float hue = 0;
-    // Lowered divisor from 2000 to 500 for more "pop"
-    hue += fabs(s->gyroZ) / 500.0f;
-
-    if (hue >= 255) hue -= 255; // Use subtraction to keep it smooth
-    for (int i = 0; i < l; i += 3) {
+#ifdef POI_PALETTE_BENCH
+// The per-pixel path the modes used before the palettes: hue branches, then a scale per channel
+static void palette_bench_hsv(const uint8_t *hue, const uint16_t *level, uint8_t *p, int n) {
+    for (int i = 0; i < n; i++, p += 3) {
+        uint16_t h = hue[i] * 3;
         uint8_t r, g, b;
-        // Adding (i/3) creates a slight gradient across the 12 LEDs
-        hsv_to_rgb((uint8_t)hue + (i * 2), &r, &g, &b);
-        p[i] = r; p[i+1] = g; p[i+2] = b;
+        if (h < 255) { r = 255 - h; g = h; b = 0; }
+        else if (h < 510) { h -= 255; r = 0; g = 255 - h; b = h; }
+        else { h -= 510; r = h; g = 0; b = 255 - h; }
+        p[0] = poi_fx_scale8(r, level[i]);
+        p[1] = poi_fx_scale8(g, level[i]);
+        p[2] = poi_fx_scale8(b, level[i]);
     }
 }
 
-void mode_flow_trail(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    // Brightness based on spin speed
-    uint8_t br = (uint8_t)fminf(fabs(s->gyroZ) / 4.0f, 255.0f);
-    for (int i = 0; i < l; i += 3) { p[i] = 0; p[i+1] = br; p[i+2] = br; }
-}
-
-void mode_gravity_compass(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    float angle = atan2f(s->accelY, s->accelX);
-    uint8_t hue = (uint8_t)(((angle + M_PI) / (2.0f * M_PI)) * 255.0f);
-    for (int i = 0; i < l; i += 3) {
-        uint8_t r, g, b; hsv_to_rgb(hue + (i/3), &r, &g, &b);
-        p[i] = r; p[i+1] = g; p[i+2] = b;
+// Best of PALETTE_BENCH_RUNS per kernel, in CPU cycles per NUM_LEDS strip; the +1 byte
+// output is the unaligned case seq_prepare() hits
+static void palette_bench(void) {
+    const int PALETTE_BENCH_RUNS = 200;
+    uint8_t hue[NUM_LEDS];
+    uint16_t level[NUM_LEDS];
+    uint32_t ref[NUM_LEDS * 3 / 4 + 1], out[NUM_LEDS * 3 / 4 + 2];
+    static poi_palette_t pal_rainbow;
+    poi_palette_rainbow(&pal_rainbow);
+    for (int i = 0; i < NUM_LEDS; i++) {
+        hue[i] = (uint8_t)esp_random();
+        level[i] = esp_random() % (POI_FX_ONE + 1);
+    }
+    palette_bench_hsv(hue, level, (uint8_t *)ref, NUM_LEDS);
+    for (int offset = 0; offset < 2; offset++) {
+        uint8_t *p = (uint8_t *)out + offset;
+        uint32_t best[4] = { UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX };
+        for (int run = 0; run < PALETTE_BENCH_RUNS; run++) {
+            uint32_t t0 = esp_cpu_get_cycle_count();
+            palette_bench_hsv(hue, level, p, NUM_LEDS);
+            uint32_t t1 = esp_cpu_get_cycle_count();
+            poi_palette_map(&pal_rainbow, hue, level, p, NUM_LEDS);
+            uint32_t t2 = esp_cpu_get_cycle_count();
+            poi_palette_map(&pal_rainbow, hue, NULL, p, NUM_LEDS);
+            uint32_t t3 = esp_cpu_get_cycle_count();
+            poi_palette_shade(pal_rainbow.rgb[hue[0]], level, p, NUM_LEDS);
+            uint32_t t4 = esp_cpu_get_cycle_count();
+            uint32_t t[4] = { t1 - t0, t2 - t1, t3 - t2, t4 - t3 };
+            for (int k = 0; k < 4; k++) if (t[k] < best[k]) best[k] = t[k];
+        }
+        poi_palette_map(&pal_rainbow, hue, level, p, NUM_LEDS);
+        ESP_LOGI(TAG, "Palette bench (+%d byte): hsv %lu, map %lu, map unscaled %lu, shade %lu cycles%s", offset,
+                 (unsigned long)best[0], (unsigned long)best[1], (unsigned long)best[2], (unsigned long)best[3],
+                 memcmp(p, ref, NUM_LEDS * 3) ? ", MAP DIFFERS FROM HSV" : "");
     }
 }
+#endif
 
-void mode_velocity_prism(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float smoothed_vel = 0.0f;
-    static float hue_offset = 0.0f;
-
-    float current_vel = sqrtf(s->gyroX * s->gyroX + s->gyroY * s->gyroY + s->gyroZ * s->gyroZ); // Use all gyro axes for velocity
-
-    // Smooth the velocity to reduce flashiness
-    smoothed_vel = smoothed_vel * 0.9f + current_vel * 0.1f; // Exponential moving average
-
-    // Map smoothed_vel to a dynamic range for hue, making it less direct and more subtle
-    // Max vel could be around 2000-3000, so a divisor of 100.0f will give 0-30 hue range
-    float dynamic_hue_base = fminf(smoothed_vel / 50.0f, 255.0f); // Adjust divisor for desired sensitivity
-
-    // Slowly shift hue offset for a flowing effect
-    hue_offset += 0.2f + (dynamic_hue_base * 0.05f); // Faster shift with higher velocity
-    if (hue_offset >= 255.0f) hue_offset -= 255.0f;
+// =============================================================================
+// BLE & SYSTEM LOGIC
+// =============================================================================
 
-    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-        uint8_t r, g, b;
-        float led_pos_norm = (float)led_idx / (NUM_LEDS - 1);
+// BLE-related Forward Declarations
+static int ble_central_event(struct ble_gap_event *event, void *arg);
+void poi_scan_start(void);
+static int on_disc_char(uint16_t conn_handle, const struct ble_gatt_error *error, const struct ble_gatt_chr *chr, void *arg);
 
-        // Create a subtle wave or gradient across the LEDs, influenced by hue_offset and velocity
-        uint8_t hue = (uint8_t)fmodf(dynamic_hue_base + (led_pos_norm * 50.0f) + hue_offset, 255.0f); // 50.0f for spread
 
-        // Brightness can also be influenced by smoothed velocity, but gently
-        float brightness = 0.4f + fminf(smoothed_vel / 1000.0f, 0.6f); // Base brightness with gentle boost from velocity
-        brightness = fmaxf(MIN_BRIGHTNESS, fminf(1.0f, brightness));
 
-        hsv_to_rgb(hue, &r, &g, &b);
+// Stream features a poi accepts, derived from the protocol version in its config reply
+static uint8_t poi_caps_for_version(uint8_t protocol_version) {
+#ifdef POI_ASSUME_PROTO_VERSION
+    if (protocol_version == 0) protocol_version = POI_ASSUME_PROTO_VERSION;
+#endif
+    uint8_t caps = 0;
+    if (protocol_version >= POI_PROTO_VERSION_COMPRESSED) caps |= POI_CAP_COMPRESSED;
+    if (protocol_version >= POI_PROTO_VERSION_BATCH) caps |= POI_CAP_BATCH;
+    if (protocol_version >= POI_PROTO_VERSION_TIMED) caps |= POI_CAP_TIMED;
+    if (protocol_version >= POI_PROTO_VERSION_SEQ) caps |= POI_CAP_SEQ;
+    if (protocol_version >= POI_PROTO_VERSION_DEPTH) caps |= POI_CAP_DEPTH;
+    if (protocol_version >= POI_PROTO_VERSION_STATUS) caps |= POI_CAP_STATUS;
+    return caps;
+}
 
-        int p_idx = led_idx * 3;
-        p[p_idx] = (uint8_t)(r * brightness);
-        p[p_idx+1] = (uint8_t)(g * brightness);
-        p[p_idx+2] = (uint8_t)(b * brightness);
+// Stream as long as at least one poi is ready; the others join as they finish discovery
+static void check_and_start_streaming(void) {
+    int ready_count = poi_conn_mgr_count(&poi_conns, POI_SLOT_READY);
+    bool was_streaming = is_streaming;
+    is_streaming = ready_count > 0;
+    if (is_streaming && !was_streaming) {
+        ESP_LOGI(TAG, "POI ready. Starting streaming.");
+        if (lvgl_port_lock(LVGL_PORT_LOCK_TIMEOUT_MS)) {
+            if (poi_info_label != NULL) {
+                lv_label_set_text(poi_info_label, "Connected. Streaming!");
+                lv_obj_set_style_text_color(poi_info_label, lv_color_make(0x00, 0xFF, 0x00), 0);
+            }
+            lvgl_port_unlock();
+        }
+    } else if (!is_streaming && was_streaming) {
+        ESP_LOGI(TAG, "No POI left. Streaming paused.");
     }
 }
 
-void mode_warp_speed(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    // Brightness flashes based on Gyro Z (spin speed)
-    // Creates a "strobe" effect the faster you spin
-    uint8_t flash = (uint8_t)fminf(fabs(s->gyroZ) / 5.0f, 255.0f);
-    for (int i = 0; i < l; i += 3) {
-        p[i] = flash; p[i+1] = flash; p[i+2] = flash;
+// NVS writes stall the CPU for milliseconds, so they happen here, at low priority and batched:
+// a change wakes the task, which waits out PEER_CACHE_SAVE_MS for more before writing a copy
+static void peer_cache_task(void *param) {
+    static poi_peer_cache_t copy;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        vTaskDelay(pdMS_TO_TICKS(PEER_CACHE_SAVE_MS));
+        ulTaskNotifyTake(pdTRUE, 0); // Changes meanwhile are in this write
+        xSemaphoreTake(peer_cache_mutex, portMAX_DELAY);
+        copy = peer_cache;
+        peer_cache.dirty = false;
+        xSemaphoreGive(peer_cache_mutex);
+        esp_err_t err = poi_peer_cache_save(&copy);
+        if (err != ESP_OK) ESP_LOGW(TAG, "Saving the poi cache failed: %s", esp_err_to_name(err)); // The next change retries
     }
 }
 
-void mode_plasma_ghost(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float global_hue = 0.0f;
-    static float plasma_seed = 0.0f; // For subtle, organic movement
-
-    // Global hue shifts slowly, creating a "breathing" color effect
-    global_hue += 0.1f;
-    if (global_hue >= 255.0f) global_hue -= 255.0f;
-
-    // Plasma movement seed (subtle variation)
-    plasma_seed += 0.01f;
-
-    // Overall acceleration magnitude for intensity
-    float accel_mag = sqrtf(s->accelX*s->accelX + s->accelY*s->accelY + s->accelZ*s->accelZ);
-    float intensity_boost = fminf(accel_mag / 10.0f, 1.0f); // Boost intensity with movement
-
-    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-        uint8_t r, g, b;
-        float led_pos_norm = (float)led_idx / (NUM_LEDS - 1);
-
-        // Base hue for the "plasma" effect, influenced by global_hue and LED position
-        uint8_t base_hue = (uint8_t)fmodf(global_hue + (led_pos_norm * 80.0f) + sinf(plasma_seed + led_pos_norm * M_PI * 2.0f) * 20.0f, 255.0f);
-
-        // A "ghostly" complementary color that blends in
-        uint8_t secondary_hue = (uint8_t)fmodf(base_hue + 120.0f, 255.0f);
-
-        uint8_t r_base, g_base, b_base;
-        hsv_to_rgb(base_hue, &r_base, &g_base, &b_base);
-
-        uint8_t r_sec, g_sec, b_sec;
-        hsv_to_rgb(secondary_hue, &r_sec, &g_sec, &b_sec);
-
-        // Blend the colors, with blending factor subtly varied by a sine wave for "plasma" feel
-        float blend_factor = (sinf(plasma_seed * 2.0f + led_pos_norm * M_PI * 4.0f) + 1.0f) / 2.0f; // 0 to 1
-
-        r = (uint8_t)(r_base * (1.0f - blend_factor) + r_sec * blend_factor);
-        g = (uint8_t)(g_base * (1.0f - blend_factor) + g_sec * blend_factor);
-        b = (uint8_t)(b_base * (1.0f - blend_factor) + b_sec * blend_factor);
+static void peer_cache_store(const poi_peer_t *peer) {
+    xSemaphoreTake(peer_cache_mutex, portMAX_DELAY);
+    poi_peer_cache_store(&peer_cache, peer);
+    bool dirty = peer_cache.dirty;
+    xSemaphoreGive(peer_cache_mutex);
+    if (dirty) xTaskNotifyGive(peer_cache_task_handle);
+}
 
-        // Overall brightness, with a boost from movement
-        float brightness = 0.3f + intensity_boost * 0.7f;
-        brightness = fmaxf(MIN_BRIGHTNESS, fminf(1.0f, brightness));
+static void peer_cache_forget(const ble_addr_t *addr) {
+    xSemaphoreTake(peer_cache_mutex, portMAX_DELAY);
+    poi_peer_cache_forget(&peer_cache, addr->type, addr->val);
+    bool dirty = peer_cache.dirty;
+    xSemaphoreGive(peer_cache_mutex);
+    if (dirty) xTaskNotifyGive(peer_cache_task_handle);
+}
 
-        int p_idx = led_idx * 3;
-        p[p_idx] = (uint8_t)(r * brightness);
-        p[p_idx+1] = (uint8_t)(g * brightness);
-        p[p_idx+2] = (uint8_t)(b * brightness);
+// Config reply (or its timeout, cfg == NULL): size this poi's frames and let it stream
+static void poi_config_done(int slot, const poi_proto::config_reply *cfg) {
+    poi_device_t *dev = &devices[slot];
+    if (dev->config_received) return;
+    if (cfg != NULL) {
+        dev->protocol_version = cfg->protocol_version;
+        dev->num_leds = cfg->num_leds;
+        dev->frame_buffer_size = cfg->frame_buffer_size;
+        dev->hardware_buffer_limit = cfg->hardware_buffer_limit;
+        dev->battery_voltage = cfg->battery_mv / 1000.0f;
+        dev->free_space_kb = cfg->free_space_kb;
+        dev->config_replied = true;
+    } else if (dev->handles_cached && dev->num_leds != 0) {
+        ESP_LOGW(TAG, "Poi %d sent no config, using the cached one", slot);
+    } else {
+        ESP_LOGW(TAG, "Poi %d sent no config, assuming %d LEDs", slot, NUM_LEDS);
+        dev->num_leds = NUM_LEDS;
+    }
+    if (dev->num_leds == 0) dev->num_leds = NUM_LEDS;
+    int max_leds = MAX_POI_LEDS;
+    if (dev->hardware_buffer_limit > FRAME_WRITE_HDR_LEN && dev->hardware_buffer_limit < MAX_WRITE_LEN) {
+        max_leds = (dev->hardware_buffer_limit - FRAME_WRITE_HDR_LEN) / BYTES_PER_PIXEL; // stage_frames() can send a raw frame within the limit
     }
+    if (dev->num_leds > max_leds) {
+        ESP_LOGW(TAG, "Poi %d has %d LEDs, streaming the first %d", slot, dev->num_leds, max_leds);
+        dev->num_leds = max_leds;
+    }
+    dev->config_received = true;
+    ESP_LOGI(TAG, "Poi %d config: v%d, %d LEDs, buffer %d, limit %d, %.2fV, %d KB free", slot, dev->protocol_version,
+             dev->num_leds, dev->frame_buffer_size, dev->hardware_buffer_limit, dev->battery_voltage, dev->free_space_kb);
+    poi_conn_mgr_advance(&poi_conns, slot, POI_SLOT_READY);
+
+    // Remember how to reach this poi without a scan or discovery next time
+    poi_peer_t peer;
+    memset(&peer, 0, sizeof(peer));
+    peer.addr_type = dev->addr.type;
+    memcpy(peer.addr, dev->addr.val, sizeof(peer.addr));
+    peer.config_replied = dev->config_replied;
+    peer.rx_char_handle = dev->rx_char_handle;
+    peer.tx_char_handle = dev->tx_char_handle;
+    peer.tx_cccd_handle = dev->tx_cccd_handle;
+    peer.protocol_version = dev->protocol_version;
+    peer.num_leds = dev->num_leds;
+    peer.frame_buffer_size = dev->frame_buffer_size;
+    peer.hardware_buffer_limit = dev->hardware_buffer_limit;
+    peer_cache_store(&peer);
+
+    int64_t now_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "Poi %d ready to stream (%s): %lld ms after connecting, %lld ms after the last link loss", slot,
+             dev->handles_cached ? "warm" : "cold", (now_us - dev->connect_us) / 1000, (now_us - link_lost_us) / 1000);
+    check_and_start_streaming(); // Check if streaming can start
+    poi_scan_start(); // Now ready to look for other devices if needed
 }
 
-void mode_fire_ice_split(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    float tilt_norm = (s->accelY + 1.0f) / 2.0f; // Normalized tilt from 0.0 to 1.0
-
-    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-        uint8_t r, g, b;
-        float led_pos_norm = (float)led_idx / (NUM_LEDS - 1); // Normalized LED position 0.0 to 1.0
-
-        // Determine the "balance" between fire and ice for this LED
-        // Create a blend zone that moves with tilt_norm
-        float blend_width = 0.3f; // Width of the blend zone
-        float blend_start = tilt_norm - (blend_width / 2.0f);
-        float blend_end = tilt_norm + (blend_width / 2.0f);
-
-        float fire_factor; // How much fire color should contribute (0 to 1)
-        if (led_pos_norm < blend_start) { // Pure ice
-            fire_factor = 0.0f;
-        } else if (led_pos_norm > blend_end) { // Pure fire
-            fire_factor = 1.0f;
-        } else { // In the blend zone
-            fire_factor = (led_pos_norm - blend_start) / blend_width;
+// True if a slot is linked to this address
+static bool poi_addr_connected(uint8_t addr_type, const uint8_t *addr) {
+    for (int s = 0; s < POI_MAX_DEVICES; s++) {
+        if (poi_conns.slot[s].state >= POI_SLOT_DISCOVERING && devices[s].addr.type == addr_type &&
+            memcmp(devices[s].addr.val, addr, sizeof(devices[s].addr.val)) == 0) {
+            return true;
         }
-
-        // Fire hues (red to yellow/orange, maybe some white/bright in the middle)
-        // Base hue for fire part, slightly shifted by led position
-        uint8_t fire_hue = (uint8_t)(led_pos_norm * 40.0f); // Red (0) to Orange/Yellow (40)
-
-        // Ice hues (blue to cyan/white)
-        // Base hue for ice part, slightly shifted by led position
-        uint8_t ice_hue = (uint8_t)(180 + (1.0f - led_pos_norm) * 40.0f); // Blue (180) to Cyan (220)
-
-        uint8_t r_src_fire, g_src_fire, b_src_fire;
-        hsv_to_rgb(fire_hue, &r_src_fire, &g_src_fire, &b_src_fire);
-
-        uint8_t r_src_ice, g_src_ice, b_src_ice;
-        hsv_to_rgb(ice_hue, &r_src_ice, &g_src_ice, &b_src_ice);
-
-        // Blend the colors based on fire_factor
-        r = (uint8_t)(r_src_ice * (1.0f - fire_factor) + r_src_fire * fire_factor);
-        g = (uint8_t)(g_src_ice * (1.0f - fire_factor) + g_src_fire * fire_factor);
-        b = (uint8_t)(b_src_ice * (1.0f - fire_factor) + b_src_fire * fire_factor);
-
-        int p_idx = led_idx * 3;
-        p[p_idx] = r;
-        p[p_idx+1] = g;
-        p[p_idx+2] = b;
     }
+    return false;
 }
 
-void mode_shifting_horizon(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float hue_offset = 0.0f;
-    static float horizon_pos_smoothed = 0.5f; // Normalized position of the horizon line
-
-    // Map accelZ (-1.0 to 1.0) to a normalized horizon position (0.0 to 1.0)
-    float target_horizon_pos = (s->accelZ + 1.0f) / 2.0f;
-
-    // Smooth the horizon position for less jittery movement
-    horizon_pos_smoothed = horizon_pos_smoothed * 0.9f + target_horizon_pos * 0.1f;
-
-    // Slowly shift overall hue for dynamic colors
-    hue_offset += 0.08f;
-    if (hue_offset >= 255.0f) hue_offset -= 255.0f;
-
-    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-        uint8_t r, g, b;
-        float led_pos_norm = (float)led_idx / (NUM_LEDS - 1); // 0.0 to 1.0
-
-        // Calculate distance from the smoothed horizon line
-        float dist_from_horizon = fabsf(led_pos_norm - horizon_pos_smoothed);
-
-        // Intensity/brightness based on proximity to the horizon
-        float proximity_intensity = 1.0f - fminf(dist_from_horizon * 4.0f, 1.0f); // Peak at horizon, falloff
-
-        // Create a color gradient that shifts across the horizon
-        // Hue varies across the strip, with a bias towards the global_hue_offset
-        uint8_t hue = (uint8_t)fmodf(hue_offset + (led_pos_norm * 120.0f), 255.0f);
-        hsv_to_rgb(hue, &r, &g, &b);
-
-        // Apply brightness: higher near the horizon, with a base minimum
-        float brightness = fmaxf(MIN_BRIGHTNESS, 0.2f + proximity_intensity * 0.8f);
-        brightness = fminf(1.0f, brightness); // Clamp to 1.0
+// The scan ended or is being cancelled: how much advertising it had to look at
+static void scan_stats_log(void) {
+    if (scan_started_us == 0) return;
+    int64_t ms = (esp_timer_get_time() - scan_started_us) / 1000;
+    ESP_LOGI(TAG, "Scan: %lu adv reports in %lld ms (%.1f/s), %lu from poi", scan_reports, ms,
+             ms > 0 ? scan_reports * 1000.0f / ms : 0.0f, scan_matched);
+    scan_started_us = 0;
+}
 
-        int p_idx = led_idx * 3;
-        p[p_idx] = (uint8_t)(r * brightness);
-        p[p_idx+1] = (uint8_t)(g * brightness);
-        p[p_idx+2] = (uint8_t)(b * brightness);
+// Known poi that aren't connected; returns how many were written to addrs
+static int missing_peers(ble_addr_t *addrs) {
+    int n = 0;
+    for (int i = 0; i < POI_PEER_CACHE_SIZE; i++) {
+        const poi_peer_t *p = &peer_cache.peer[i];
+        if (p->last_used == 0 || poi_addr_connected(p->addr_type, p->addr)) continue;
+        addrs[n].type = p->addr_type;
+        memcpy(addrs[n].val, p->addr, sizeof(p->addr));
+        n++;
     }
+    return n;
 }
 
-void mode_gravity_ball(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    memset(p, 0, l);
-
-    // 1. Normalize the input. If it's > 10, assume it's in milli-Gs (1000)
-    float ay = s->accelY;
-    if (fabsf(ay) > 10.0f) ay /= 1000.0f;
-
-    // 2. Clamp the value to the expected range [-1.0, 1.0]
-    if (ay > 1.0f) ay = 1.0f;
-    if (ay < -1.0f) ay = -1.0f;
-
-    // 3. Map -1.0..1.0 to 0.0..1.0
-    float pos = (ay + 1.0f) / 2.0f;
-
-    // 4. Calculate LED index (0 to 11)
-    int led_idx = (int)(pos * NUM_LEDS -1);
-    int p_idx = led_idx * 3; // 3 bytes per pixel
-
-    // Safety check and light it up
-    if (p_idx <= l - 3) {
-        p[p_idx] = 255;
-        p[p_idx+1] = 255;
-        p[p_idx+2] = 255;
+// Connect to whichever known poi advertises first, through the controller's accept list
+static bool poi_reconnect_start(void) {
+    ble_addr_t addrs[POI_PEER_CACHE_SIZE];
+    int n = missing_peers(addrs);
+    if (n == 0 || esp_timer_get_time() < reconnect_after_us) return false;
+
+    int slot = poi_conn_mgr_reserve(&poi_conns);
+    if (slot < 0) return false;
+    ble_gap_disc_cancel(); // The accept list can't change while the controller scans
+    scan_stats_log();
+    int rc = ble_gap_wl_set(addrs, n);
+    if (rc == 0) rc = ble_gap_connect(own_addr_type, NULL, RECONNECT_TIMEOUT_MS, NULL, ble_central_event, NULL); // NULL peer = accept list
+    if (rc != 0) {
+        ESP_LOGW(TAG, "Reconnect to known poi failed to start: %d", rc);
+        poi_conn_mgr_connect_failed(&poi_conns);
+        reconnect_after_us = esp_timer_get_time() + RESCAN_MS * 1000;
+        return false;
     }
+    connect_issued_us = esp_timer_get_time();
+    ESP_LOGI(TAG, "Reconnecting to %d known poi into slot %d...", n, slot);
+    return true;
 }
 
-void mode_compass_navigator(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    float angle = atan2f(s->accelY, s->accelX); // -PI to PI
-    float angle_norm = (angle + M_PI) / (2.0f * M_PI); // 0.0 to 1.0
-
-    // Map the normalized angle to a target LED position (0 to NUM_LEDS-1)
-    float target_led_pos = angle_norm * (NUM_LEDS - 1);
-
-    // Dynamic glow/pulse based on spin speed
-    float spin_intensity = fminf(fabs(s->gyroZ) / 50.0f, 1.0f); // Normalize gyroZ to 0..1
-
-    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-        uint8_t r, g, b;
-        float led_pos_norm = (float)led_idx / (NUM_LEDS - 1); // 0.0 to 1.0
-
-        // Calculate distance from target LED position, wrapping around the strip
-        float dist = fabsf(led_idx - target_led_pos);
-        if (dist > NUM_LEDS / 2.0f) {
-            dist = NUM_LEDS - dist; // Handle wrap-around for shortest distance
-        }
-        float proximity_factor = 1.0f - fminf(dist / (NUM_LEDS / 4.0f), 1.0f); // 1.0 at target, 0.0 further away
-
-        // Base hue shifts slowly, perhaps based on time or a slow cycle, to make it more interesting
-        static float global_hue_offset = 0.0f;
-        global_hue_offset += 0.05f; // Slow rotation
-        if (global_hue_offset >= 255.0f) global_hue_offset -= 255.0f;
+// Connect to the next poi collected while scanning; discovery of the ones before it carries on meanwhile
+static bool poi_connect_candidate(void) {
+    int slot = poi_conn_mgr_reserve(&poi_conns);
+    if (slot < 0) return false;
+    poi_candidate_t c;
+    while (poi_conn_mgr_candidate_take(&poi_conns, esp_timer_get_time(), CANDIDATE_MAX_AGE_MS * 1000LL, &c)) {
+        if (poi_addr_connected(c.addr_type, c.addr)) continue;
+        ble_addr_t addr;
+        addr.type = c.addr_type;
+        memcpy(addr.val, c.addr, sizeof(addr.val));
+        ble_gap_disc_cancel();
+        scan_stats_log();
+        ESP_LOGI(TAG, "Connecting to Poi %d...", slot);
+        connect_issued_us = esp_timer_get_time();
+        if (ble_gap_connect(own_addr_type, &addr, CONNECT_TIMEOUT_MS, NULL, ble_central_event, NULL) == 0) return true;
+    }
+    poi_conn_mgr_connect_failed(&poi_conns); // Nobody left to connect to: release the slot
+    return false;
+}
 
-        // Determine hue: a base color, blended with a "pointer" color at the target_led_pos
-        uint8_t base_hue = (uint8_t)fmodf(led_pos_norm * 255.0f + global_hue_offset, 255.0f);
-        uint8_t pointer_hue = (uint8_t)fmodf(base_hue + 120.0f, 255.0f); // Complementary hue for the pointer
+static void candidate_window_end(struct ble_npl_event *ev) {
+    poi_scan_start();
+}
 
-        uint8_t r_base, g_base, b_base;
-        hsv_to_rgb(base_hue, &r_base, &g_base, &b_base);
+// Next step of bringing up poi: connect a collected candidate, reconnect known poi, or scan
+void poi_scan_start(void) {
+    if (!poi_conn_mgr_want_scan(&poi_conns)) return;
+    if (ble_npl_callout_is_active(&candidate_window)) return; // Still collecting, the window's end carries on
+    if (poi_connect_candidate()) return;
+    if (poi_reconnect_start()) return;
 
-        uint8_t r_pointer, g_pointer, b_pointer;
-        hsv_to_rgb(pointer_hue, &r_pointer, &g_pointer, &b_pointer);
+    // While known poi are missing, scan in windows so direct reconnects get another turn
+    ble_addr_t addrs[POI_PEER_CACHE_SIZE];
+    int missing = missing_peers(addrs);
+    int32_t duration_ms = missing > 0 ? RESCAN_MS : BLE_HS_FOREVER;
 
-        // Blend base and pointer colors based on proximity
-        r = (uint8_t)(r_base * (1.0f - proximity_factor) + r_pointer * proximity_factor);
-        g = (uint8_t)(g_base * (1.0f - proximity_factor) + g_pointer * proximity_factor);
-        b = (uint8_t)(b_base * (1.0f - proximity_factor) + b_pointer * proximity_factor);
+    struct ble_gap_disc_params dp;
+    memset(&dp, 0, sizeof(dp));
 
-        // Apply brightness: higher near the pointer, and a boost from spin intensity
-        float brightness = 0.5f + proximity_factor * 0.5f + spin_intensity * 0.3f;
-        brightness = fmaxf(MIN_BRIGHTNESS, fminf(1.0f, brightness));
+    dp.filter_duplicates = 1;
+#ifdef SCAN_PASSIVE
+    dp.passive = 1;
+#else
+    dp.passive = 0; // Active scanning to get the device name from the scan response
+#endif
+    // Full duty until something streams, then leave most of the air to the links
+    bool busy = poi_conn_mgr_count(&poi_conns, POI_SLOT_STREAMING) > 0;
+    dp.itvl = SCAN_ITVL_MS * 1000 / 625;
+    dp.window = (busy ? SCAN_WINDOW_BUSY_MS : SCAN_WINDOW_IDLE_MS) * 1000 / 625;
+#ifdef SCAN_KNOWN_ONLY
+    if (missing > 0 && ble_gap_wl_set(addrs, missing) == 0) dp.filter_policy = BLE_HCI_SCAN_FILT_USE_WL;
+#endif
 
-        int p_idx = led_idx * 3;
-        p[p_idx] = (uint8_t)(r * brightness);
-        p[p_idx+1] = (uint8_t)(g * brightness);
-        p[p_idx+2] = (uint8_t)(b * brightness);
+    int rc = ble_gap_disc(own_addr_type, duration_ms, &dp, ble_central_event, NULL);
+    if (rc == 0) {
+        scan_started_us = esp_timer_get_time();
+        scan_reports = 0;
+        scan_matched = 0;
+    } else if (rc != BLE_HS_EALREADY) {
+        ESP_LOGE(TAG, "Scan Error: %d", rc);
     }
 }
 
-void mode_audio_spectrum(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        int num_spectrum_bins = N_SAMPLES / 2; // This is 8 (N_SAMPLES = 16)
+// Find the poi service, then its RX/TX characteristics within it; on_disc_char takes it from there
+static void poi_discover(int slot) {
+    poi_device_t *dev = &devices[slot];
+    dev->svc_start_handle = 0;
+    dev->svc_end_handle = 0;
+    dev->disc_start_us = esp_timer_get_time();
+    dev->disc_callbacks = 0;
+    ble_gattc_disc_svc_by_uuid(poi_conns.slot[slot].conn_handle, &svc_uuid.u, on_disc_svc, NULL);
+}
 
-        for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-            float target_spectrum_pos = (float)led_idx / (NUM_LEDS - 1) * (num_spectrum_bins - 1);
-            int spectrum_idx_low = (int)floorf(target_spectrum_pos);
-            int spectrum_idx_high = (int)ceilf(target_spectrum_pos);
-            float interp_factor = target_spectrum_pos - spectrum_idx_low;
+// The cached handles of slot's poi don't work (firmware update?): forget them and discover from scratch
+static void poi_cache_stale(int slot) {
+    poi_device_t *dev = &devices[slot];
+    ESP_LOGW(TAG, "Cached handles of Poi %d are stale, discovering", slot);
+    peer_cache_forget(&dev->addr);
+    ble_npl_callout_stop(&config_timeout[slot]); // Discovery asks again
+    dev->handles_cached = false;
+    dev->rx_char_handle = 0;
+    dev->tx_char_handle = 0;
+    dev->tx_cccd_handle = 0;
+    dev->config_requested_us = 0;
+    poi_discover(slot);
+}
 
-            float mag_low = spectrum[spectrum_idx_low];
-            float mag_high = spectrum[spectrum_idx_high];
-            float interpolated_magnitude = mag_low * (1.0f - interp_factor) + mag_high * interp_factor;
+// Write responses to the config request; an error on cached handles means they are stale
+static int on_config_write(uint16_t conn_handle, const struct ble_gatt_error *error, struct ble_gatt_attr *attr, void *arg) {
+    int slot = poi_conn_mgr_find(&poi_conns, conn_handle);
+    if (slot < 0 || error->status == 0) return 0;
+    if (devices[slot].handles_cached) {
+        poi_cache_stale(slot);
+    } else {
+        ESP_LOGW(TAG, "Poi %d config request write failed: %d", slot, error->status);
+    }
+    return 0;
+}
 
-            // **Adjust dB range for higher sensitivity to lower sounds**
-            float normalized_magnitude = (interpolated_magnitude + 70.0f) / 70.0f; // Shift range from -70 to 0dB
-            normalized_magnitude = fmaxf(0.0f, fminf(1.0f, normalized_magnitude));
+// Subscribe to TX and ask for the config; the slot becomes READY on the reply or the timeout
+static void poi_request_config(int slot) {
+    poi_device_t *dev = &devices[slot];
+    uint16_t conn_handle = poi_conns.slot[slot].conn_handle;
+    // Replies come back as notifications
+    uint8_t cccd[] = {0x01, 0x00};
+    ble_gattc_write_flat(conn_handle, dev->tx_cccd_handle, cccd, sizeof(cccd), on_config_write, NULL);
+    uint8_t req[poi_proto::get_config_req::wire_size];
+    poi_proto::encode(poi_proto::get_config_req{}, req);
+    ble_gattc_write_flat(conn_handle, dev->rx_char_handle, req, sizeof(req), on_config_write, NULL);
+    dev->config_requested_us = esp_timer_get_time();
+    ble_npl_callout_reset(&config_timeout[slot], ble_npl_time_ms_to_ticks32(CONFIG_TIMEOUT_MS));
+}
 
-            // **Even stronger baseline and audio reaction**
-            float effective_brightness = fmaxf(MIN_BRIGHTNESS * 2.0f, normalized_magnitude * 1.2f + MIN_BRIGHTNESS * 1.0f); // Even higher floor and stronger audio scaling
+// Poi that never answer CC_GET_CONFIG are streamed at the canonical LED count
+static void config_timeout_end(struct ble_npl_event *ev) {
+    int slot = (int)(intptr_t)ble_npl_event_get_arg(ev);
+    poi_device_t *dev = &devices[slot];
+    // The request may be from a link that dropped since, or been superseded
+    if (poi_conns.slot[slot].state != POI_SLOT_DISCOVERING || dev->config_received || dev->config_requested_us == 0 ||
+        esp_timer_get_time() - dev->config_requested_us < CONFIG_TIMEOUT_MS * 1000) {
+        return;
+    }
+    const poi_peer_t *peer = poi_peer_cache_find(&peer_cache, dev->addr.type, dev->addr.val);
+    if (dev->handles_cached && peer != NULL && peer->config_replied) {
+        poi_cache_stale(slot); // It used to answer, so the request went to the wrong handle
+    } else {
+        poi_config_done(slot, NULL);
+    }
+}
 
-            uint8_t r, g, b;
-            // Map magnitude to hue: 0 (red) -> 85 (green) -> 170 (blue) for low to high magnitude
-            // Invert hue so low magnitude is blue, high is red (red is 0, so 170 - hue_val)
-            uint8_t hue_val = (uint8_t)(normalized_magnitude * 220.0f); // Even wider hue range for more color diversity
-            hsv_to_rgb(170 - hue_val, &r, &g, &b);
+static void config_reply_received(struct ble_npl_event *ev) {
+    int slot = (int)(intptr_t)ble_npl_event_get_arg(ev);
+    if (poi_conns.slot[slot].state != POI_SLOT_DISCOVERING) return; // Dropped since, or a repeated reply
+    ble_npl_callout_stop(&config_timeout[slot]);
+    poi_config_done(slot, &config_replies[slot]);
+}
 
-            // Apply effective brightness
-            r = (uint8_t)(r * effective_brightness);
-            g = (uint8_t)(g * effective_brightness);
-            b = (uint8_t)(b * effective_brightness);
+static int on_disc_svc(uint16_t conn_handle, const struct ble_gatt_error *error, const struct ble_gatt_svc *svc, void *arg) {
+    int slot = poi_conn_mgr_find(&poi_conns, conn_handle);
+    if (slot < 0) return 0; // Disconnected while discovering
+    poi_device_t *dev = &devices[slot];
 
-            int p_idx = led_idx * 3;
-            if (p_idx <= l - 3) {
-                p[p_idx] = r;
-                p[p_idx+1] = g;
-                p[p_idx+2] = b;
-            }
-        }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
+    if (error->status == 0) {
+        dev->disc_callbacks++;
+        dev->svc_start_handle = svc->start_handle;
+        dev->svc_end_handle = svc->end_handle;
+    } else if (error->status == BLE_HS_EDONE && dev->svc_start_handle != 0) {
+        ble_gattc_disc_all_chrs(conn_handle, dev->svc_start_handle, dev->svc_end_handle, on_disc_char, NULL);
+    } else {
+        ESP_LOGE(TAG, "Poi service not found on device (Handle: %d): %d", conn_handle, error->status);
+        ble_gap_terminate(conn_handle, BLE_ERR_REM_USER_CONN_TERM); // Not a usable poi
     }
+    return 0;
 }
 
-void mode_audio_wave(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float wave_phase = 0.0f; // Use phase for smoother wave motion
-    static float hue_offset = 0.0f; // Global hue offset for color diversity
+static int on_disc_char(uint16_t conn_handle, const struct ble_gatt_error *error, const struct ble_gatt_chr *chr, void *arg) {
+    int slot = poi_conn_mgr_find(&poi_conns, conn_handle);
+    if (slot < 0) return 0; // Disconnected while discovering
+    poi_device_t *dev = &devices[slot];
 
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        float sum_amplitude = 0.0f;
-        for (int i = 0; i < N_SAMPLES; i++) {
-            sum_amplitude += fabsf(audio_buffer[i]);
+    if (error->status == 0) {
+        dev->disc_callbacks++;
+        if (ble_uuid_cmp(&rx_uuid.u, &chr->uuid.u) == 0) {
+            dev->rx_char_handle = chr->val_handle;
+            ESP_LOGI(TAG, "RX Characteristic Found (Handle: %d)!", dev->rx_char_handle);
+        } else if (ble_uuid_cmp(&tx_uuid.u, &chr->uuid.u) == 0) {
+            dev->tx_char_handle = chr->val_handle;
+            ESP_LOGI(TAG, "TX Characteristic Found (Handle: %d)!", dev->tx_char_handle);
         }
-        float avg_amplitude = sum_amplitude / N_SAMPLES;
-
-        // **Even much higher sensitivity: Multiplier 15.0f**
-        float normalized_amplitude = fminf(avg_amplitude * 15.0f, 1.0f);
-
-        // Base brightness, boosted even more strongly by amplitude
-        float effective_brightness = fmaxf(MIN_BRIGHTNESS * 2.0f, normalized_amplitude * 1.5f + MIN_BRIGHTNESS * 1.0f); // Higher floor, stronger audio impact
-
-        // Hue changes over time, influenced by amplitude (faster change with louder audio) and motion
-        hue_offset += (1.0f + normalized_amplitude * 4.0f + fabs(s->gyroZ) / 200.0f); // Faster global hue shift, more motion influence
-        if (hue_offset >= 255.0f) hue_offset -= 255.0f;
-
-        // Wave motion influenced more strongly by audio amplitude
-        wave_phase += (0.2f + normalized_amplitude * 2.0f); // Faster wave with louder audio
-
-        for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-            uint8_t r, g, b;
-
-            // Create a wave pattern: sine wave along the strip
-            // Wave amplitude and frequency influenced by audio more intensely
-            float wave_amplitude = 0.4f + normalized_amplitude * 0.6f; // More dynamic wave peaks
-            float wave_frequency = 1.0f + normalized_amplitude * 0.7f; // More compression with louder audio
-
-            float wave_value = sinf((float)led_idx / (NUM_LEDS - 1) * M_PI * wave_frequency + wave_phase) * wave_amplitude;
-            wave_value = (wave_value + 1.0f) / 2.0f; // Map -1 to 1 to 0 to 1
-
-            // Combine global hue, wave value, and led position for color diversity
-            // Added current_pixel_brightness into hue calculation for more color diversity
-            uint8_t hue = (uint8_t)fmodf(hue_offset + (wave_value * 120.0f) + ((float)led_idx / NUM_LEDS * 50.0f), 255.0f);
-
-            hsv_to_rgb(hue, &r, &g, &b);
-
-            // Brightness affected by wave value and audio amplitude
-            float pixel_brightness = effective_brightness * (0.5f + wave_value * 0.5f);
-            pixel_brightness = fmaxf(MIN_BRIGHTNESS, pixel_brightness);
-            if (pixel_brightness > 1.0f) pixel_brightness = 1.0f;
-
-            p[led_idx * 3]     = (uint8_t)(r * pixel_brightness);
-            p[led_idx * 3 + 1] = (uint8_t)(g * pixel_brightness);
-            p[led_idx * 3 + 2] = (uint8_t)(b * pixel_brightness);
+        if (dev->rx_char_handle == 0 || dev->tx_char_handle == 0) return 0;
+        // Both found: stop here rather than spend another round trip reading to the end of the service
+    }
+    if (error->status == 0 || error->status == BLE_HS_EDONE) {
+        // Discovery finished for this device
+        if (dev->rx_char_handle != 0 && dev->tx_char_handle != 0) {
+            // TX's descriptors follow its value, up to the next characteristic or the end of the service
+            ble_gattc_disc_all_dscs(conn_handle, dev->tx_char_handle, dev->svc_end_handle, on_disc_dsc, NULL);
+        } else {
+            ESP_LOGE(TAG, "Discovery done but not all characteristics found for device (Handle: %d). RX: %d, TX: %d", conn_handle, dev->rx_char_handle, dev->tx_char_handle);
+            // Not a usable poi: free the slot, BLE_GAP_EVENT_DISCONNECT restarts the scan
+            ble_gap_terminate(conn_handle, BLE_ERR_REM_USER_CONN_TERM);
         }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
     }
+    return 1; // Ends the procedure if it is still running
 }
 
+static int on_disc_dsc(uint16_t conn_handle, const struct ble_gatt_error *error, uint16_t chr_val_handle, const struct ble_gatt_dsc *dsc, void *arg) {
+    int slot = poi_conn_mgr_find(&poi_conns, conn_handle);
+    if (slot < 0) return 0; // Disconnected while discovering
+    poi_device_t *dev = &devices[slot];
 
-void mode_audio_bass_pulse(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        // Average the lowest few frequency bins for bass
-        float bass_magnitude_sum = 0.0f;
-        int num_bass_bins = 3;
-        for (int i = 0; i < num_bass_bins; i++) {
-            bass_magnitude_sum += spectrum[i];
-        }
-        float avg_bass_magnitude = bass_magnitude_sum / num_bass_bins;
-        float normalized_bass = (avg_bass_magnitude + 65.0f) / 65.0f; // Slightly more sensitive bass range
-        normalized_bass = fmaxf(0.0f, fminf(1.0f, normalized_bass));
-
-        // Analyze mid and higher frequency bins for nuanced high tones/melody
-        float mid_magnitude_sum = 0.0f;
-        float treble_magnitude_sum = 0.0f;
-        float max_treble_magnitude = -100.0f;
-        int peak_treble_bin = num_bass_bins;
-
-        int num_mid_bins_start = num_bass_bins;
-        int num_mid_bins_end = num_bass_bins + (N_SAMPLES / 2 - num_bass_bins) / 2; // Middle half of remaining bins
-
-        int num_treble_bins_start = num_mid_bins_end;
-        int num_treble_bins_end = N_SAMPLES / 2;
-
-        for (int i = num_mid_bins_start; i < num_mid_bins_end; i++) {
-            mid_magnitude_sum += spectrum[i];
+    if (error->status == 0) {
+        dev->disc_callbacks++;
+        if (ble_uuid_cmp(&dsc->uuid.u, &cccd_uuid.u) == 0) {
+            dev->tx_cccd_handle = dsc->handle;
+        } else if (ble_uuid_cmp(&dsc->uuid.u, &chr_decl_uuid.u) != 0) {
+            return 0; // Another descriptor of TX; keep looking until the next characteristic
         }
-        for (int i = num_treble_bins_start; i < num_treble_bins_end; i++) {
-            treble_magnitude_sum += spectrum[i];
-            if (spectrum[i] > max_treble_magnitude) {
-                max_treble_magnitude = spectrum[i];
-                peak_treble_bin = i;
-            }
+    }
+    if (error->status == 0 || error->status == BLE_HS_EDONE) {
+        if (dev->tx_cccd_handle != 0) {
+            ESP_LOGI(TAG, "All characteristics discovered for Poi %d (Handle: %d) in %lld ms, service %d-%d, TX CCCD %d, %d results",
+                     slot, conn_handle, (esp_timer_get_time() - dev->disc_start_us) / 1000,
+                     dev->svc_start_handle, dev->svc_end_handle, dev->tx_cccd_handle, dev->disc_callbacks);
+            poi_request_config(slot);
+        } else {
+            ESP_LOGE(TAG, "Poi %d TX characteristic has no CCCD, it can't notify", slot);
+            ble_gap_terminate(conn_handle, BLE_ERR_REM_USER_CONN_TERM);
         }
+    } else {
+        ESP_LOGE(TAG, "Descriptor discovery failed for Poi %d: %d", slot, error->status);
+        ble_gap_terminate(conn_handle, BLE_ERR_REM_USER_CONN_TERM);
+    }
+    return 1;
+}
 
-        float avg_mid_magnitude = (num_mid_bins_end - num_mid_bins_start > 0) ? (mid_magnitude_sum / (num_mid_bins_end - num_mid_bins_start)) : 0.0f;
-        float avg_treble_magnitude = (num_treble_bins_end - num_treble_bins_start > 0) ? (treble_magnitude_sum / (num_treble_bins_end - num_treble_bins_start)) : 0.0f;
-
-        float normalized_mid_avg = (avg_mid_magnitude + 65.0f) / 65.0f;
-        normalized_mid_avg = fmaxf(0.0f, fminf(1.0f, normalized_mid_avg));
-
-        float normalized_treble_avg = (avg_treble_magnitude + 65.0f) / 65.0f;
-        normalized_treble_avg = fmaxf(0.0f, fminf(1.0f, normalized_treble_avg));
 
-        float normalized_treble_peak_val = (max_treble_magnitude + 65.0f) / 65.0f;
-        normalized_treble_peak_val = fmaxf(0.0f, fminf(1.0f, normalized_treble_peak_val));
 
-        float sum_total_amplitude = 0.0f;
-        for (int i = 0; i < N_SAMPLES; i++) {
-            sum_total_amplitude += fabsf(audio_buffer[i]);
+// Issue whatever the link profile negotiation wants next; it resumes from each controller event
+static void link_profile_step(int slot) {
+    poi_device_t *dev = &devices[slot];
+    uint16_t conn_handle = poi_conns.slot[slot].conn_handle;
+    bool was_done = poi_link_profile_done(&dev->link);
+    poi_link_req_t req;
+    while (poi_link_profile_next(&dev->link, esp_timer_get_time(), &req)) {
+        int rc;
+        if (req.step == POI_LINK_STEP_PHY) {
+            rc = ble_gap_set_prefered_le_phy(conn_handle, BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_2M_MASK, BLE_GAP_LE_PHY_CODED_ANY);
+        } else if (req.step == POI_LINK_STEP_DATA_LEN) {
+            rc = ble_gap_set_data_len(conn_handle, POI_LINK_TX_OCTETS_MAX, POI_LINK_TX_TIME_MAX);
+        } else {
+            struct ble_gap_upd_params params;
+            memset(&params, 0, sizeof(params));
+            params.itvl_min = req.itvl_min;
+            params.itvl_max = req.itvl_max;
+            params.latency = req.latency;
+            params.supervision_timeout = req.supervision_timeout;
+            rc = ble_gap_update_params(conn_handle, &params);
         }
-        float avg_total_amplitude = sum_total_amplitude / N_SAMPLES;
-        float normalized_amplitude = fminf(avg_total_amplitude * 15.0f, 1.0f); // Adjust multiplier as needed
-
-
-        // Base brightness always present, boosted by all frequency components
-        float effective_base_brightness = fmaxf(MIN_BRIGHTNESS * 2.0f, normalized_bass * 0.6f + normalized_mid_avg * 0.3f + normalized_treble_avg * 0.2f + MIN_BRIGHTNESS * 1.5f);
-
-
-        for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-            uint8_t r, g, b;
-            float current_pixel_brightness = effective_base_brightness;
-
-            // Base color for bass: red/orange, pulsating with bass intensity
-            uint8_t hue_bass = (uint8_t)(normalized_bass * 60.0f); // Red (0) to Yellow (60) for more range
-            hsv_to_rgb(hue_bass, &r, &g, &b);
-
-            // Mid tones add a different nuance (e.g., green/yellow)
-            if (normalized_mid_avg > 0.1f) {
-                float mid_influence_factor = normalized_mid_avg * 0.9f;
-                uint8_t mid_hue = (uint8_t)(60 + normalized_mid_avg * 30); // Yellow to Greenish
-                uint8_t mr, mg, mb;
-                hsv_to_rgb(mid_hue, &mr, &mg, &mb);
-
-                r = (uint8_t)(r * (1.0f - mid_influence_factor) + mr * mid_influence_factor);
-                g = (uint8_t)(g * (1.0f - mid_influence_factor) + mg * mid_influence_factor);
-                b = (uint8_t)(b * (1.0f - mid_influence_factor) + mb * mid_influence_factor);
-                current_pixel_brightness = fmaxf(current_pixel_brightness, mid_influence_factor);
-            }
-
-            // High tones add a distinct color (e.g., blue/purple)
-            if (normalized_treble_avg > 0.1f) {
-                float treble_influence_factor = normalized_treble_avg * 1.0f;
-
-                uint8_t treble_hue = (uint8_t)(((float)(peak_treble_bin - num_treble_bins_start) / (num_treble_bins_end - num_treble_bins_start)) * 90.0f + 180); // Blue to Magenta range
-
-                uint8_t tr, tg, tb;
-                hsv_to_rgb(treble_hue, &tr, &tg, &tb);
-
-                r = (uint8_t)(r * (1.0f - treble_influence_factor) + tr * treble_influence_factor);
-                g = (uint8_t)(g * (1.0f - treble_influence_factor) + tg * treble_influence_factor);
-                b = (uint8_t)(b * (1.0f - treble_influence_factor) + tb * treble_influence_factor);
-                current_pixel_brightness = fmaxf(current_pixel_brightness, treble_influence_factor);
-            }
-
-            // Apply slight "sparkle" or intensity boost for very strong high-frequency peaks
-            if (normalized_treble_peak_val > 0.5f) {
-                float sparkle_intensity = normalized_treble_peak_val * 0.8f;
-                // Localize sparkle based on LED position relative to peak_treble_bin
-                float peak_pos_norm = (float)peak_treble_bin / (N_SAMPLES / 2 - 1); // 0 to 1
-                float led_pos_norm = (float)led_idx / (NUM_LEDS - 1);
-                float distance_from_treble_peak = fabsf(led_pos_norm - peak_pos_norm);
-
-                sparkle_intensity *= (1.0f - distance_from_treble_peak * 2.0f); // Falloff
-                sparkle_intensity = fmaxf(0.0f, sparkle_intensity);
-
-                current_pixel_brightness = fmaxf(current_pixel_brightness, sparkle_intensity);
-            }
-
+        if (rc != 0) ESP_LOGW(TAG, "Poi %d link step %d failed to start: %d", slot, req.step, rc);
+        poi_link_profile_issued(&dev->link, rc, esp_timer_get_time());
+    }
+    if (!was_done && poi_link_profile_done(&dev->link)) {
+        ESP_LOGI(TAG, "Poi %d link: %dM PHY, %d-byte PDUs, %.2f ms interval", slot, dev->link.tx_phy,
+                 dev->link.tx_octets, dev->link.conn_itvl * 1.25f);
+    }
+    if (dev->link.pending) {
+        int64_t wait_ms = (dev->link.deadline_us - esp_timer_get_time()) / 1000 + 1;
+        ble_npl_callout_reset(&link_timeout[slot], ble_npl_time_ms_to_ticks32(wait_ms > 0 ? (uint32_t)wait_ms : 1));
+    }
+}
 
-            // Apply final brightness and ensure minimum light
-            float final_pixel_brightness = fmaxf(MIN_BRIGHTNESS, current_pixel_brightness * (0.7f + normalized_amplitude * 0.3f)); // Overall amplitude for final boost
-            if (final_pixel_brightness > 1.0f) final_pixel_brightness = 1.0f;
+// The controller never answered a link request: fall back and go on
+static void link_timeout_end(struct ble_npl_event *ev) {
+    int slot = (int)(intptr_t)ble_npl_event_get_arg(ev);
+    if (poi_conns.slot[slot].state >= POI_SLOT_DISCOVERING) link_profile_step(slot);
+}
 
-            p[led_idx * 3]     = (uint8_t)(r * final_pixel_brightness);
-            p[led_idx * 3 + 1] = (uint8_t)(g * final_pixel_brightness);
-            p[led_idx * 3 + 2] = (uint8_t)(b * final_pixel_brightness);
+// An advertising report from the scan: collect every poi advertising nearby, then connect them back to back
+static void on_adv_report(const ble_addr_t *addr, const uint8_t *data, uint8_t len) {
+    scan_reports++;
+    if (!poi_conn_mgr_adv_is_poi(data, len, svc_uuid.value, TARGET_NAME)) return;
+    scan_matched++;
+    if (!poi_addr_connected(addr->type, addr->val)) {
+        int n = poi_conn_mgr_candidate_add(&poi_conns, addr->type, addr->val, esp_timer_get_time());
+        int free_slots = POI_MAX_DEVICES - poi_conn_mgr_count(&poi_conns, POI_SLOT_CONNECTING);
+        if (n < 0 || n >= free_slots) { // Enough to fill every slot, no point waiting
+            ble_npl_callout_stop(&candidate_window);
+            poi_scan_start();
+        } else if (!ble_npl_callout_is_active(&candidate_window)) {
+            ble_npl_callout_reset(&candidate_window, ble_npl_time_ms_to_ticks32(CANDIDATE_WINDOW_MS));
         }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
     }
 }
 
-void mode_audio_motion_fusion(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float global_hue_cycle = 0.0f;
-    static float motion_flow_speed = 0.0f;
-    static float last_accel_magnitude = 0.0f; // For subtle acceleration-based color shifts
-
-    // Calculate overall acceleration magnitude for motion reactivity
-    float current_accel_magnitude = sqrtf(s->accelX*s->accelX + s->accelY*s->accelY + s->accelZ*s->accelZ);
-    float delta_accel_magnitude = fabs(current_accel_magnitude - last_accel_magnitude);
-    last_accel_magnitude = current_accel_magnitude;
+static int ble_central_event(struct ble_gap_event *event, void *arg) {
+    switch (event->type) {
+        case BLE_GAP_EVENT_DISC:
+            on_adv_report(&event->disc.addr, event->disc.data, event->disc.length_data);
+            break;
 
-    // Smoothed gyroscope Z for rotation influence
-    float smoothed_gyro_z = fabs(s->gyroZ) / 50.0f; // Stronger influence from spin
+        case BLE_GAP_EVENT_EXT_DISC: // With extended advertising built in (broadcast), the scan reports through here
+            on_adv_report(&event->ext_disc.addr, event->ext_disc.data, event->ext_disc.length_data);
+            break;
 
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        float sum_amplitude = 0.0f;
-        for (int i = 0; i < N_SAMPLES; i++) {
-            sum_amplitude += fabsf(audio_buffer[i]);
-        }
-        float avg_amplitude = sum_amplitude / N_SAMPLES;
+        case BLE_GAP_EVENT_DISC_COMPLETE:
+            scan_stats_log();
+            poi_scan_start();
+            break;
 
-        // **Highly sensitive audio reaction**
-        float audio_reactivity = fminf(avg_amplitude * 20.0f, 1.0f);
+        case BLE_GAP_EVENT_CONNECT:
+            if (event->connect.status == 0) {
+                ESP_LOGI(TAG, "Connected! Negotiating link...");
 
-        // Base brightness always present, with a high floor, and highly boosted by audio
-        float base_brightness = fmaxf(MIN_BRIGHTNESS * 3.0f, audio_reactivity * 1.0f + MIN_BRIGHTNESS * 1.5f);
+                // 1. Request larger MTU so several frames fit in one write
+                ble_gattc_exchange_mtu(event->connect.conn_handle, NULL, NULL);
 
-        // Motion influences global hue cycle speed and a secondary pattern
-        global_hue_cycle += (0.1f + smoothed_gyro_z * 0.5f); // Spin speeds up hue cycle
-        if (global_hue_cycle >= 255.0f) global_hue_cycle -= 255.0f;
+                int slot = poi_conn_mgr_connected(&poi_conns, event->connect.conn_handle);
+                if (slot >= 0) {
+                    poi_device_t *dev = &devices[slot];
+                    memset(dev, 0, sizeof(*dev)); // Nothing carries over from the previous occupant
+                    dev->mtu = BLE_ATT_MTU_DFLT; // Until BLE_GAP_EVENT_MTU reports the exchange
+                    dev->connect_us = connect_issued_us;
+                    struct ble_gap_conn_desc desc;
+                    uint16_t conn_itvl = 0;
+                    if (ble_gap_conn_find(event->connect.conn_handle, &desc) == 0) {
+                        conn_itvl = desc.conn_itvl;
+                        dev->addr = desc.peer_id_addr;
+                    }
+                    poi_tx_sched_init(&dev->tx, conn_itvl * 1250, esp_timer_get_time());
+
+                    // A known poi skips discovery; the config request proves its cached handles
+                    const poi_peer_t *peer = poi_peer_cache_find(&peer_cache, dev->addr.type, dev->addr.val);
+                    if (peer != NULL && peer->tx_cccd_handle != 0) { // Entries saved before the CCCD was cached lack it
+                        dev->handles_cached = true;
+                        dev->rx_char_handle = peer->rx_char_handle;
+                        dev->tx_char_handle = peer->tx_char_handle;
+                        dev->tx_cccd_handle = peer->tx_cccd_handle;
+                        dev->protocol_version = peer->protocol_version;
+                        dev->num_leds = peer->num_leds;
+                        dev->frame_buffer_size = peer->frame_buffer_size;
+                        dev->hardware_buffer_limit = peer->hardware_buffer_limit;
+                        ESP_LOGI(TAG, "Poi %d is known (RX %d, TX %d), skipping discovery", slot, dev->rx_char_handle, dev->tx_char_handle);
+                        poi_request_config(slot);
+                    } else {
+                        poi_discover(slot);
+                    }
 
-        // Motion flow influenced by gyro (speed) and accel (jerkiness)
-        motion_flow_speed = fminf(2.0f, 0.1f + smoothed_gyro_z * 0.3f + delta_accel_magnitude * 5.0f);
+                    // 2. Faster PHY, longer PDUs and a shorter interval, one step at a time
+                    poi_link_profile_init(&dev->link, conn_itvl);
+                    link_profile_step(slot);
+                }
+                poi_scan_start(); // Connect the next poi while this one discovers
+            } else { 
+                ESP_LOGE(TAG, "Connection failed: %d", event->connect.status);
+                poi_conn_mgr_connect_failed(&poi_conns);
+                if (reconnect_after_us <= esp_timer_get_time()) {
+                    reconnect_after_us = esp_timer_get_time() + RESCAN_MS * 1000; // Known poi not around: scan for a while
+                }
+                poi_scan_start(); // Restart scan to try again
+            }
+            break;
 
-        for (int i = 0; i < l; i += 3) {
-            uint8_t r, g, b;
-            float led_pos_norm = (float)(i / 3) / (NUM_LEDS - 1);
 
-            // Core pattern: a flowing, motion-driven color gradient
-            uint8_t base_pattern_hue = (uint8_t)fmodf(global_hue_cycle + (led_pos_norm * 150.0f) + (sinf(led_pos_norm * M_PI * 4.0f + motion_flow_speed) * 30.0f), 255.0f);
 
-            // Audio layers on top, influencing a secondary color pulse or shift
-            uint8_t audio_layer_hue = (uint8_t)fmodf(base_pattern_hue + 90.0f, 255.0f); // Complementary or shifted hue
+        case BLE_GAP_EVENT_MTU: {
+            int slot = poi_conn_mgr_find(&poi_conns, event->mtu.conn_handle);
+            if (slot >= 0) {
+                devices[slot].mtu = event->mtu.value;
+                ESP_LOGI(TAG, "Poi %d MTU: %d", slot, event->mtu.value);
+            }
+            break;
+        }
 
-            // Interpolate between base and audio layer based on audio reactivity
-            uint8_t final_hue;
-            if (audio_reactivity > 0.1f) {
-                final_hue = (uint8_t)(base_pattern_hue * (1.0f - audio_reactivity) + audio_layer_hue * audio_reactivity);
+        case BLE_GAP_EVENT_CONN_UPDATE: {
+            int slot = poi_conn_mgr_find(&poi_conns, event->conn_update.conn_handle);
+            if (slot < 0) break;
+            struct ble_gap_conn_desc desc;
+            if (event->conn_update.status == 0 && ble_gap_conn_find(event->conn_update.conn_handle, &desc) == 0) {
+                poi_tx_sched_set_conn_itvl(&devices[slot].tx, desc.conn_itvl * 1250); // 1.25ms units
+                poi_link_profile_on_conn_update(&devices[slot].link, 0, desc.conn_itvl);
+                ESP_LOGI(TAG, "Poi %d connection interval now %.2f ms", slot, desc.conn_itvl * 1.25f);
             } else {
-                final_hue = base_pattern_hue;
+                poi_link_profile_on_conn_update(&devices[slot].link, event->conn_update.status, 0);
+                ESP_LOGW(TAG, "Poi %d connection update failed: %d", slot, event->conn_update.status);
             }
+            link_profile_step(slot);
+            break;
+        }
 
-            hsv_to_rgb(final_hue, &r, &g, &b);
-
-            // Saturation: always high, but audio can boost it to max
-            float saturation = 0.8f + audio_reactivity * 0.2f;
-            if (saturation > 1.0f) saturation = 1.0f;
-
-            // Final brightness: influenced by base brightness, audio, and motion (gyro)
-            float final_pixel_brightness = base_brightness * (0.8f + audio_reactivity * 0.4f) + smoothed_gyro_z * 0.2f;
-            final_pixel_brightness = fmaxf(MIN_BRIGHTNESS, final_pixel_brightness * saturation); // Ensure min, apply saturation
-            final_pixel_brightness = fminf(1.0f, final_pixel_brightness);
-
-            p[i] = (uint8_t)(r * final_pixel_brightness);
-            p[i+1] = (uint8_t)(g * final_pixel_brightness);
-            p[i+2] = (uint8_t)(b * final_pixel_brightness);
+        case BLE_GAP_EVENT_PHY_UPDATE_COMPLETE: {
+            int slot = poi_conn_mgr_find(&poi_conns, event->phy_updated.conn_handle);
+            if (slot < 0) break;
+            poi_link_profile_on_phy(&devices[slot].link, event->phy_updated.status, event->phy_updated.tx_phy);
+            ESP_LOGI(TAG, "Poi %d PHY: %dM (status %d)", slot, event->phy_updated.tx_phy, event->phy_updated.status);
+            link_profile_step(slot);
+            break;
         }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
-    }
-}
 
-void mode_audio_peak_color(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float global_hue_offset = 0.0f;
-    static float peak_travel_pos = 0.0f;
+#ifdef BLE_GAP_EVENT_DATA_LEN_CHG
+        case BLE_GAP_EVENT_DATA_LEN_CHG: {
+            int slot = poi_conn_mgr_find(&poi_conns, event->data_len_chg.conn_handle);
+            if (slot < 0) break;
+            poi_link_profile_on_data_len(&devices[slot].link, event->data_len_chg.max_tx_octets);
+            ESP_LOGI(TAG, "Poi %d data length: %d bytes", slot, event->data_len_chg.max_tx_octets);
+            link_profile_step(slot);
+            break;
+        }
+#endif
 
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        float max_magnitude = -100.0f;
-        int peak_bin = 0;
-        int num_spectrum_bins = N_SAMPLES / 2;
-        float sum_amplitude = 0.0f;
-        for (int i = 0; i < N_SAMPLES; i++) {
-            sum_amplitude += fabsf(audio_buffer[i]);
+        case BLE_GAP_EVENT_NOTIFY_RX: {
+            int slot = poi_conn_mgr_find(&poi_conns, event->notify_rx.conn_handle);
+            if (slot < 0 || event->notify_rx.attr_handle != devices[slot].tx_char_handle) break;
+            // Just copy it out: stream_task decodes it, so a reply never holds up the host
+            uint8_t buf[POI_RX_RING_DATA];
+            uint16_t len = OS_MBUF_PKTLEN(event->notify_rx.om);
+            // Replies are short; the ring drops a longer notification whole rather than reassemble a cut-off one
+            if (len <= sizeof(buf) && os_mbuf_copydata(event->notify_rx.om, 0, len, buf) != 0) break;
+            poi_rx_ring_push(&notify_ring, event->notify_rx.conn_handle, buf, len, esp_timer_get_time());
+            break;
         }
-        float avg_amplitude = sum_amplitude / N_SAMPLES;
-        float normalized_overall_amplitude = fminf(avg_amplitude * 10.0f, 1.0f); // Increased overall audio reactivity
 
-        for (int i = 0; i < num_spectrum_bins; i++) {
-            if (spectrum[i] > max_magnitude) {
-                max_magnitude = spectrum[i];
-                peak_bin = i;
+        case BLE_GAP_EVENT_DISCONNECT: {
+            int slot = poi_conn_mgr_disconnected(&poi_conns, event->disconnect.conn.conn_handle);
+            if (slot >= 0) {
+                ESP_LOGI(TAG, "Poi %d disconnected (reason %d)", slot, event->disconnect.reason);
+                link_lost_us = esp_timer_get_time();
+                reconnect_after_us = 0; // It is probably still close by: try the known poi first
+                check_and_start_streaming();
             }
+            poi_scan_start(); // Restart scan to find a replacement if needed
+            break;
         }
+    } // Closing brace for switch (event->type)
+    return 0;
+} // Closing brace for ble_central_event function
 
-        float normalized_peak = (max_magnitude + 65.0f) / 65.0f; // Slightly more sensitive peak detection
-        normalized_peak = fmaxf(0.0f, fminf(1.0f, normalized_peak));
 
-        // Hue for the peak, slightly dynamic based on peak_bin or motion
-        uint8_t peak_hue = (uint8_t)((float)peak_bin / (num_spectrum_bins - 1) * 190.0f); // Wider peak hue range
-        peak_hue = (uint8_t)fmodf(peak_hue + global_hue_offset, 255.0f);
-        uint8_t peak_r, peak_g, peak_b;
-        hsv_to_rgb(peak_hue, &peak_r, &peak_g, &peak_b);
 
-        // Background hue cycle, more influenced by overall audio
-        global_hue_offset += (0.2f + normalized_overall_amplitude * 0.8f);
-        if (global_hue_offset >= 255.0f) global_hue_offset -= 255.0f;
+void init_buttons() {
+    // Reset both to clear any weird states
+    gpio_reset_pin((gpio_num_t)MODE_BUTTON_GPIO);
+    gpio_reset_pin((gpio_num_t)POWER_BUTTON_GPIO);
 
-        // Peak traveling effect - smoother and more responsive to peak changes
-        float target_peak_led_pos = (float)peak_bin / (num_spectrum_bins - 1) * (NUM_LEDS - 1);
-        peak_travel_pos = peak_travel_pos * 0.7f + target_peak_led_pos * 0.3f; // Faster smoothing
+    // Mode Button: Input + Pull-Down
+    gpio_set_direction((gpio_num_t)MODE_BUTTON_GPIO, GPIO_MODE_INPUT);
+    gpio_set_pull_mode((gpio_num_t)MODE_BUTTON_GPIO, GPIO_PULLDOWN_ONLY);
 
+    // Power Button: Input + Pull-Down
+    gpio_set_direction((gpio_num_t)POWER_BUTTON_GPIO, GPIO_MODE_INPUT);
+    gpio_set_pull_mode((gpio_num_t)POWER_BUTTON_GPIO, GPIO_PULLDOWN_ONLY);
+}
 
-        for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-            uint8_t r, g, b;
-            float current_brightness;
-
-            // Base background color, more reactive to overall audio amplitude
-            float background_brightness = MIN_BRIGHTNESS * 1.0f + normalized_overall_amplitude * 0.4f; // Stronger, more reactive background
-            hsv_to_rgb((uint8_t)fmodf(global_hue_offset + (float)led_idx * 7.0f, 255.0f), &r, &g, &b); // Faster background animation
-            current_brightness = background_brightness;
-
-            // Calculate influence from the traveling peak
-            float distance_from_traveling_peak = fabsf((float)led_idx - peak_travel_pos);
-
-            // **Significantly wider exponential falloff from the traveling peak**
-            float peak_falloff = expf(-distance_from_traveling_peak / (NUM_LEDS / 2.0f)); // Much wider spread
-
-            // Combine with normalized peak magnitude for intensity
-            float peak_effect_intensity = normalized_peak * peak_falloff;
-
-            // Blend peak color and background color - stronger blend
-            float blend_factor = peak_effect_intensity * (0.9f + normalized_overall_amplitude * 0.3f);
-            if (blend_factor > 1.0f) blend_factor = 1.0f;
-
-            r = (uint8_t)(r * (1.0f - blend_factor) + peak_r * blend_factor);
-            g = (uint8_t)(g * (1.0f - blend_factor) + peak_g * blend_factor);
-            b = (uint8_t)(b * (1.0f - blend_factor) + peak_b * blend_factor);
-
-            // Brightness is influenced by peak effect, but with an even stronger minimum floor
-            current_brightness = fmaxf(background_brightness, current_brightness + (peak_effect_intensity * 1.0f));
-            if (current_brightness > 1.0f) current_brightness = 1.0f;
-
-            p[led_idx * 3]     = (uint8_t)(r * current_brightness);
-            p[led_idx * 3 + 1] = (uint8_t)(g * current_brightness);
-            p[led_idx * 3 + 2] = (uint8_t)(b * current_brightness);
-        }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
-    }
-}
-void mode_audio_rainbow_cycle(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float global_hue_offset = 0.0f; // Continuous global hue shift
-    static float current_amplitude_smooth = 0.0f; // Smoothed amplitude for reactivity
-
-    const float BASE_CYCLE_SPEED = 0.1f; // Slowest cycle speed
-    const float AUDIO_SPEED_MULTIPLIER = 8.0f; // How much audio speeds up the cycle
-    const float BASE_RAINBOW_SPREAD = 2.0f; // Base number of full rainbow cycles along the strip
-    const float AUDIO_SPREAD_MODULATOR = 0.8f; // How much audio changes the spread
-    const float BRIGHTNESS_PULSATION_STRENGTH = 0.2f; // How much brightness pulsates with audio
-
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        float sum_amplitude = 0.0f;
-        for (int i = 0; i < N_SAMPLES; i++) {
-            sum_amplitude += fabsf(audio_buffer[i]);
-        }
-        float avg_amplitude = sum_amplitude / N_SAMPLES;
-        float normalized_amplitude = fminf(avg_amplitude * 15.0f, 1.0f); // Higher sensitivity
-
-        // Smooth amplitude for less "jumpy" reactions
-        current_amplitude_smooth = current_amplitude_smooth * 0.9f + normalized_amplitude * 0.1f;
-
-        // Cycle speed: base speed + audio influence
-        float cycle_speed = BASE_CYCLE_SPEED + (current_amplitude_smooth * AUDIO_SPEED_MULTIPLIER);
-        global_hue_offset += cycle_speed;
-        if (global_hue_offset >= 255.0f) global_hue_offset -= 255.0f;
-
-        // Rainbow spread: base spread, modulated by audio
-        float rainbow_spread = BASE_RAINBOW_SPREAD + (current_amplitude_smooth * AUDIO_SPREAD_MODULATOR);
-
-        // Base brightness: always present, subtly modulated by audio pulse
-        float base_overall_brightness = fmaxf(MIN_BRIGHTNESS * 2.5f, MIN_BRIGHTNESS * 2.0f + current_amplitude_smooth * 0.5f);
-
-        // Add a subtle brightness pulsation based on audio
-        base_overall_brightness *= (1.0f + BRIGHTNESS_PULSATION_STRENGTH * sinf(global_hue_offset / 10.0f) * current_amplitude_smooth);
-
-        for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-            uint8_t r, g, b;
-
-            // Hue calculation: global offset + LED position modulated by dynamic spread
-            uint8_t hue = (uint8_t)fmodf(global_hue_offset + (float)led_idx * (255.0f / NUM_LEDS) * rainbow_spread, 255.0f);
-
-            // Saturation: always high, audio boosts it slightly
-            float saturation_mod = 0.9f + current_amplitude_smooth * 0.1f;
-            if (saturation_mod > 1.0f) saturation_mod = 1.0f;
-
-            // Apply HSV to RGB
-            hsv_to_rgb(hue, &r, &g, &b);
-
-            // Apply brightness
-            float final_pixel_brightness = base_overall_brightness * saturation_mod;
-            final_pixel_brightness = fmaxf(MIN_BRIGHTNESS, final_pixel_brightness); // Ensure minimum light
-            if (final_pixel_brightness > 1.0f) final_pixel_brightness = 1.0f;
-
-            int p_idx = led_idx * 3;
-            if (p_idx <= l - 3) {
-                p[p_idx] = (uint8_t)(r * final_pixel_brightness);
-                p[p_idx+1] = (uint8_t)(g * final_pixel_brightness);
-                p[p_idx+2] = (uint8_t)(b * final_pixel_brightness);
-            }
-        }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
-    }
-}
-
-void mode_audio_vu_meter(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float global_hue_offset = 0.0f; // For shifting overall color
-    static float smoothed_amplitude = 0.0f; // For smoother reactions
-
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        float sum_amplitude = 0.0f;
-        for (int i = 0; i < N_SAMPLES; i++) {
-            sum_amplitude += fabsf(audio_buffer[i]);
-        }
-        float avg_amplitude = sum_amplitude / N_SAMPLES;
-        float normalized_amplitude = fminf(avg_amplitude * 20.0f, 1.0f); // Significantly increased sensitivity
-
-        // Smooth amplitude for less flickering
-        smoothed_amplitude = smoothed_amplitude * 0.8f + normalized_amplitude * 0.2f;
-
-        // Shift global hue slowly, influenced by audio activity
-        global_hue_offset += (0.05f + smoothed_amplitude * 0.5f);
-        if (global_hue_offset >= 255.0f) global_hue_offset -= 255.0f;
-
-        // Calculate how many LEDs should be active based on smoothed amplitude
-        int active_leds = (int)(smoothed_amplitude * NUM_LEDS);
-        if (active_leds > NUM_LEDS) active_leds = NUM_LEDS;
-
-        // Base brightness for inactive LEDs, subtly pulsing
-        float inactive_base_brightness = MIN_BRIGHTNESS * 1.5f * (0.8f + 0.2f * sinf(global_hue_offset / 20.0f));
-        inactive_base_brightness = fmaxf(MIN_BRIGHTNESS, inactive_base_brightness);
-
-        for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-            uint8_t r, g, b;
-            float current_pixel_brightness;
-
-            if (led_idx < active_leds) {
-                // Active VU meter LEDs have dynamic colors
-                float meter_progress = (float)led_idx / (NUM_LEDS - 1); // 0 to 1
-                // Wider hue range, influenced by global hue and meter progress
-                uint8_t hue = (uint8_t)fmodf(global_hue_offset + meter_progress * 170.0f, 255.0f);
-                hsv_to_rgb(hue, &r, &g, &b);
-                current_pixel_brightness = smoothed_amplitude * 1.2f + 0.1f; // Brighter active LEDs, more proportional to amplitude
-                if (current_pixel_brightness > 1.0f) current_pixel_brightness = 1.0f;
-            } else {
-                // Inactive LEDs show a subtle base color, shifted by global hue
-                uint8_t inactive_hue = (uint8_t)fmodf(global_hue_offset + (float)led_idx * 5.0f, 255.0f);
-                hsv_to_rgb(inactive_hue, &r, &g, &b);
-                current_pixel_brightness = inactive_base_brightness;
-            }
-
-            // Apply brightness
-            int p_idx = led_idx * 3;
-            if (p_idx <= l - 3) {
-                p[p_idx] = (uint8_t)(r * current_pixel_brightness);
-                p[p_idx+1] = (uint8_t)(g * current_pixel_brightness);
-                p[p_idx+2] = (uint8_t)(b * current_pixel_brightness);
-            }
-        }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
-    }
-}
-
-void mode_audio_beat_fade(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float current_beat_brightness_boost = 0.0f; // Smoother brightness boost
-    static float last_normalized_amplitude = 0.0f;
-    static int beat_count = 0;
-    static float target_base_hue = 0.0f; // For smooth color transitions every N beats
-    static float current_fade_hue = 0.0f; // Currently displayed hue
-
-    // Tuned constants for less flicker, more regularity, and compressed brightness range
-    const float MIN_AUDIO_LEVEL_FOR_BEAT = 0.08f; // Even lower threshold for beat detection
-    const float BEAT_SENSITIVITY = 0.15f; // Slightly higher sensitivity to detect clearer peaks
-    const float BRIGHTNESS_DECAY_RATE = 0.04f; // Even slower decay for much less flicker
-    const int BEATS_PER_COLOR_CHANGE = 4;
-    const float HUE_TRANSITION_RATE = 0.02f; // Slower, smoother hue transition
-
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        float sum_amplitude = 0.0f;
-        for (int i = 0; i < N_SAMPLES; i++) {
-            sum_amplitude += fabsf(audio_buffer[i]);
-        }
-        float avg_amplitude = sum_amplitude / N_SAMPLES;
-        float normalized_amplitude = fminf(avg_amplitude * 18.0f, 1.0f); // Even more amplified sensitivity
-
-        // Improved Beat Detection: look for a significant rise from a low point
-        if (normalized_amplitude > MIN_AUDIO_LEVEL_FOR_BEAT &&
-            (normalized_amplitude - last_normalized_amplitude > BEAT_SENSITIVITY)) {
-
-            beat_count++;
-            current_beat_brightness_boost = 1.0f; // Max boost on beat
-
-            if (beat_count >= BEATS_PER_COLOR_CHANGE) {
-                target_base_hue = fmodf(target_base_hue + 90.0f + (esp_random() % 60), 255.0f); // More distinct and random color shift
-                beat_count = 0;
-            }
-        }
-        last_normalized_amplitude = normalized_amplitude;
-
-        // Smoothly transition current hue towards target hue
-        current_fade_hue += (target_base_hue - current_fade_hue) * HUE_TRANSITION_RATE;
-        current_fade_hue = fmodf(current_fade_hue, 255.0f);
-        if (current_fade_hue < 0) current_fade_hue += 255.0f;
-
-        // Decay brightness boost smoothly
-        current_beat_brightness_boost = fmaxf(0.0f, current_beat_brightness_boost - BRIGHTNESS_DECAY_RATE);
-
-        // Calculate base brightness, ensuring minimum light and adding smooth beat boost
-        // Goal: less difference between max brightness and base brightness
-        float base_overall_brightness = fmaxf(MIN_BRIGHTNESS * 3.5f, MIN_BRIGHTNESS * 2.5f + normalized_amplitude * 0.3f); // Higher floor, lower direct amplitude scaling
-        base_overall_brightness += current_beat_brightness_boost * 0.3f; // Even smaller beat boost relative to base (compressing range)
-
-        uint8_t current_r, current_g, current_b;
-        hsv_to_rgb((uint8_t)current_fade_hue, &current_r, &current_g, &current_b);
-
-        for (int i = 0; i < l; i += 3) {
-            float pixel_brightness = base_overall_brightness;
-
-            // Optional: Subtle individual LED reaction to audio amplitude
-            // Reduced individual reaction contribution to avoid flicker and maintain compressed range
-            float individual_led_audio_reaction = fminf(normalized_amplitude * 0.3f, 0.3f);
-            pixel_brightness += individual_led_audio_reaction * sinf((float)i / l * M_PI); // Use sine for gentle spread
-
-            if (pixel_brightness > 1.0f) pixel_brightness = 1.0f;
-            pixel_brightness = fmaxf(MIN_BRIGHTNESS, pixel_brightness); // Ensure minimum light
-
-            p[i] = (uint8_t)(current_r * pixel_brightness);
-            p[i+1] = (uint8_t)(current_g * pixel_brightness);
-            p[i+2] = (uint8_t)(current_b * pixel_brightness);
-        }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
-    }
-}
-
-void mode_audio_frequency_lava(qmi8658_data_t *s, uint8_t *p, size_t l) {
-    static float global_hue_shift = 0.0f; // Overall lava color shift
-    static float flow_position = 0.0f;     // Position of the "lava" flow
-
-    const float BASE_FLOW_SPEED = 0.05f; // Base speed of the lava flow
-    const float HUE_SPREAD = 80.0f;      // How much hues spread out in blobs
-
-    if (xSemaphoreTake(audio_spectrum_buffer_mutex, (TickType_t)10) == pdTRUE) {
-        float sum_amplitude = 0.0f;
-        for (int i = 0; i < N_SAMPLES; i++) {
-            sum_amplitude += fabsf(audio_buffer[i]);
-        }
-        float avg_amplitude = sum_amplitude / N_SAMPLES;
-        float normalized_amplitude = fminf(avg_amplitude * 10.0f, 1.0f); // Overall audio reactivity
-
-        // Analyze frequency bands
-        float low_freq_mag = spectrum[0]; // First bin for low frequencies
-        float mid_freq_mag = (spectrum[1] + spectrum[2]) / 2.0f; // Mid bins
-        float high_freq_mag = spectrum[N_SAMPLES / 2 - 1]; // Highest bin for high frequencies
-
-        float normalized_low = fmaxf(0.0f, fminf(1.0f, (low_freq_mag + 60.0f) / 60.0f));
-        float normalized_mid = fmaxf(0.0f, fminf(1.0f, (mid_freq_mag + 60.0f) / 60.0f));
-        float normalized_high = fmaxf(0.0f, fminf(1.0f, (high_freq_mag + 60.0f) / 60.0f));
-
-        // Overall global hue slowly shifts
-        global_hue_shift += 0.1f;
-        if (global_hue_shift >= 255.0f) global_hue_shift -= 255.0f;
-
-        // Flow speed influenced by overall audio amplitude
-        flow_position += BASE_FLOW_SPEED + (normalized_amplitude * 0.2f);
-        if (flow_position >= NUM_LEDS * 2) flow_position -= NUM_LEDS * 2; // Cycle flow
-
-        float base_brightness = fmaxf(MIN_BRIGHTNESS * 1.5f, normalized_amplitude * 0.4f + MIN_BRIGHTNESS * 1.0f);
-
-        for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
-            uint8_t r, g, b;
-            float current_pixel_brightness = base_brightness;
-
-            // Base lava color with slight modulation from flow
-            uint8_t base_lava_hue = (uint8_t)fmodf(global_hue_shift + sinf((float)led_idx / NUM_LEDS * M_PI + flow_position / 10.0f) * 20.0f, 255.0f);
-            hsv_to_rgb(base_lava_hue, &r, &g, &b);
-
-            // Frequency band influence: create "blobs" of color or brighter areas
-            float band_influence = 0.0f;
-            uint8_t band_hue = 0;
-
-            if (led_idx < NUM_LEDS / 3) { // Lower part of strip for low frequencies
-                band_influence = normalized_low;
-                band_hue = (uint8_t)fmodf(global_hue_shift + 0, 255); // Reds/Oranges
-            } else if (led_idx < NUM_LEDS * 2 / 3) { // Middle part for mid frequencies
-                band_influence = normalized_mid;
-                band_hue = (uint8_t)fmodf(global_hue_shift + HUE_SPREAD, 255); // Yellows/Greens
-            } else { // Upper part for high frequencies
-                band_influence = normalized_high;
-                band_hue = (uint8_t)fmodf(global_hue_shift + HUE_SPREAD * 2, 255); // Blues/Violets
-            }
-
-            // Localized brightness boost and color shift from frequency bands
-            if (band_influence > 0.1f) {
-                float blend_factor = band_influence * 0.8f; // Stronger blend
-                uint8_t tr, tg, tb;
-                hsv_to_rgb(band_hue, &tr, &tg, &tb);
-
-                r = (uint8_t)(r * (1.0f - blend_factor) + tr * blend_factor);
-                g = (uint8_t)(g * (1.0f - blend_factor) + tg * blend_factor);
-                b = (uint8_t)(b * (1.0f - blend_factor) + tb * blend_factor);
-                current_pixel_brightness = fmaxf(current_pixel_brightness, blend_factor); // Boost brightness
-            }
-
-            // Overall amplitude can make the lava "bubble" or glow more intensely
-            current_pixel_brightness *= (1.0f + normalized_amplitude * 0.5f);
-
-            current_pixel_brightness = fmaxf(MIN_BRIGHTNESS, current_pixel_brightness);
-            if (current_pixel_brightness > 1.0f) current_pixel_brightness = 1.0f;
-
-            p[led_idx * 3]     = (uint8_t)(r * current_pixel_brightness);
-            p[led_idx * 3 + 1] = (uint8_t)(g * current_pixel_brightness);
-            p[led_idx * 3 + 2] = (uint8_t)(b * current_pixel_brightness);
-        }
-        xSemaphoreGive(audio_spectrum_buffer_mutex);
-    }
-}
-
-
-// =============================================================================
-// BLE & SYSTEM LOGIC
-// =============================================================================
-
-// BLE-related Forward Declarations
-static int ble_central_event(struct ble_gap_event *event, void *arg);
-void poi_scan_start(void);
-static int on_disc_char(uint16_t conn_handle, const struct ble_gatt_error *error, const struct ble_gatt_chr *chr, void *arg);
-
-
-
-static void check_and_start_streaming(void) {
-    int connected_and_discovered_count = 0;
-    for (int i = 0; i < 2; i++) {
-        if (devices[i].conn_handle != BLE_HS_CONN_HANDLE_NONE && devices[i].discovered) {
-            connected_and_discovered_count++;
-        }
-    }
-    if (connected_and_discovered_count == 2) {
-        is_streaming = true;
-        ESP_LOGI(TAG, "Both POIs connected and discovered. Starting streaming.");
-        if (lvgl_port_lock(LVGL_PORT_LOCK_TIMEOUT_MS)) {
-            if (poi_info_label != NULL) {
-                lv_label_set_text(poi_info_label, "All Connected. Streaming!");
-                lv_obj_set_style_text_color(poi_info_label, lv_color_make(0x00, 0xFF, 0x00), 0);
-            }
-            lvgl_port_unlock();
-        }
-    }
-}
-
-void poi_scan_start(void) {
-    int conn_count = 0;
-    for(int i=0; i<2; i++) {
-        if(devices[i].conn_handle != BLE_HS_CONN_HANDLE_NONE) conn_count++;
-    }
-    if (conn_count >= 2) return;
-
-    struct ble_gap_disc_params dp;
-    memset(&dp, 0, sizeof(dp));
-
-    dp.filter_duplicates = 1;
-    dp.passive = 0; // Active scanning to get the device name
-
-    int rc = ble_gap_disc(own_addr_type, BLE_HS_FOREVER, &dp, ble_central_event, NULL);
-    if (rc != 0 && rc != BLE_HS_EALREADY) {
-        ESP_LOGE(TAG, "Scan Error: %d", rc);
-    }
-}
-
-static int on_disc_char(uint16_t conn_handle, const struct ble_gatt_error *error, const struct ble_gatt_chr *chr, void *arg) {
-    poi_device_t *dev = (poi_device_t *)arg;
-
-    if (error->status == 0) {
-        if (ble_uuid_cmp(&rx_uuid.u, &chr->uuid.u) == 0) {
-            dev->rx_char_handle = chr->val_handle;
-            ESP_LOGI(TAG, "RX Characteristic Found (Handle: %d)!", dev->rx_char_handle);
-        } else if (ble_uuid_cmp(&tx_uuid.u, &chr->uuid.u) == 0) {
-            dev->tx_char_handle = chr->val_handle;
-            ESP_LOGI(TAG, "TX Characteristic Found (Handle: %d)!", dev->tx_char_handle);
-        }
-    } else if (error->status == BLE_HS_EDONE) {
-        // Discovery finished for this device
-        if (dev->rx_char_handle != 0 && dev->tx_char_handle != 0) {
-            dev->discovered = true;
-            dev->config_received = true; // Implicitly true as we are no longer reading config
-            ESP_LOGI(TAG, "All characteristics discovered for device (Handle: %d).", conn_handle);
-            check_and_start_streaming(); // Check if streaming can start
-            poi_scan_start(); // Now ready to look for other devices if needed
-        } else {
-            ESP_LOGE(TAG, "Discovery done but not all characteristics found for device (Handle: %d). RX: %d, TX: %d", conn_handle, dev->rx_char_handle, dev->tx_char_handle);
-            poi_scan_start(); // Try again/next if characteristics were not found for this device.
-        }
-    }
-    return 0;
-}
-
-
-
-static int ble_central_event(struct ble_gap_event *event, void *arg) {
-    struct ble_hs_adv_fields fields;
-    switch (event->type) {
-        case BLE_GAP_EVENT_DISC:
-            ble_hs_adv_parse_fields(&fields, event->disc.data, event->disc.length_data);
-                                    if (fields.name_len > 0 && strncmp((char *)fields.name, TARGET_NAME, fields.name_len) == 0) {
-                                        // Only connect if we have an empty slot
-                                        for (int i = 0; i < 2; i++) {
-                                            if (devices[i].conn_handle == BLE_HS_CONN_HANDLE_NONE) {
-                                                ble_gap_disc_cancel();
-                                                ESP_LOGI(TAG, "Connecting to Poi %d...", i);
-                                                ble_gap_connect(own_addr_type, &event->disc.addr, 30000, NULL, ble_central_event, NULL);
-                                                break;
-                                            }
-                                        }
-                                    }            break;
-
-        case BLE_GAP_EVENT_DISC_COMPLETE:
-            poi_scan_start();
-            break;
-
-        case BLE_GAP_EVENT_CONNECT:
-            if (event->connect.status == 0) {
-                ESP_LOGI(TAG, "Connected! Negotiating link...");
-
-                // 1. Request larger MTU so the 38-byte packet fits in one transmission
-                ble_gattc_exchange_mtu(event->connect.conn_handle, NULL, NULL);
-
-                // 2. Update Connection Parameters (Cleanly to avoid warnings)
-                struct ble_gap_upd_params params;
-                memset(&params, 0, sizeof(params));
-                params.itvl_min = 12; // 15ms
-                params.itvl_max = 24; // 30ms
-                params.latency = 0;
-                params.supervision_timeout = 400; // 4s
-                ble_gap_update_params(event->connect.conn_handle, &params);
-
-                for (int i = 0; i < 2; i++) {
-                    if (devices[i].conn_handle == BLE_HS_CONN_HANDLE_NONE) {
-                        devices[i].conn_handle = event->connect.conn_handle;
-                        ble_gattc_disc_all_chrs(devices[i].conn_handle, 1, 0xffff, on_disc_char, &devices[i]);
-                        break;
-                    }
-                }
-            } else { 
-                ESP_LOGE(TAG, "Connection failed: %d", event->connect.status);
-                poi_scan_start(); // Restart scan to try again
-            }
-            break;
-
-
-
-        case BLE_GAP_EVENT_DISCONNECT:
-            for (int i = 0; i < 2; i++) {
-                if (devices[i].conn_handle == event->disconnect.conn.conn_handle) {
-                    devices[i].conn_handle = BLE_HS_CONN_HANDLE_NONE;
-                    devices[i].discovered = false;
-                    devices[i].stream_started = false;
-                    break;
-                }
-            }
-            poi_scan_start(); // Restart scan to find a replacement if needed
-            break;
-    } // Closing brace for switch (event->type)
-    return 0;
-} // Closing brace for ble_central_event function
-
-
-
-void init_buttons() {
-    // Reset both to clear any weird states
-    gpio_reset_pin((gpio_num_t)MODE_BUTTON_GPIO);
-    gpio_reset_pin((gpio_num_t)POWER_BUTTON_GPIO);
-
-    // Mode Button: Input + Pull-Down
-    gpio_set_direction((gpio_num_t)MODE_BUTTON_GPIO, GPIO_MODE_INPUT);
-    gpio_set_pull_mode((gpio_num_t)MODE_BUTTON_GPIO, GPIO_PULLDOWN_ONLY);
-
-    // Power Button: Input + Pull-Down
-    gpio_set_direction((gpio_num_t)POWER_BUTTON_GPIO, GPIO_MODE_INPUT);
-    gpio_set_pull_mode((gpio_num_t)POWER_BUTTON_GPIO, GPIO_PULLDOWN_ONLY);
-}
+#ifdef POI_TELEMETRY_DUMP_MS
+// One console line per streaming link: the binary record in hex, so it survives line-ending translation and log interleaving
+static void telemetry_dump(void) {
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        poi_telem_stats_t s;
+        uint8_t rec[POI_TELEM_RECORD_LEN];
+        char line[4 + 2 * POI_TELEM_RECORD_LEN + 1];
+        if (poi_conns.slot[i].state != POI_SLOT_STREAMING || !poi_telem_read(&devices[i].telem, &s)) continue;
+        size_t len = poi_telem_encode(&s, i, rec, sizeof(rec));
+        memcpy(line, "TLM ", 4);
+        for (size_t k = 0; k < len; k++) sprintf(&line[4 + 2 * k], "%02x", rec[k]);
+        puts(line);
+    }
+}
+#endif
 
 // --- Tasks ---
 static void button_monitor_task(void *arg) {
@@ -1771,7 +1467,7 @@ static void button_monitor_task(void *arg) {
         //     // Lock the UI before touching labels
         //     if (lvgl_port_lock(LVGL_PORT_LOCK_TIMEOUT_MS)) {
         //         if (mode_label != NULL) {
-        //             lv_label_set_text_fmt(mode_label, "MODE: \n\n %s", mode_names[current_mode]);
+        //             lv_label_set_text_fmt(mode_label, "MODE: \n\n %s", poi_modes::registry[current_mode].name);
         //         }
         //         lvgl_port_unlock();
         //     }
@@ -1781,6 +1477,14 @@ static void button_monitor_task(void *arg) {
         //     mode_was_pressed = false;
         // }
 
+#ifdef POI_TELEMETRY_DUMP_MS
+        static TickType_t last_telemetry_dump = 0;
+        if ((xTaskGetTickCount() - last_telemetry_dump) >= pdMS_TO_TICKS(POI_TELEMETRY_DUMP_MS)) {
+            last_telemetry_dump = xTaskGetTickCount();
+            telemetry_dump();
+        }
+#endif
+
         // --- UI UPDATES ---
         static TickType_t last_ui_update = 0;
         if ((xTaskGetTickCount() - last_ui_update) > pdMS_TO_TICKS(500)) { // Update UI every 500ms
@@ -1809,15 +1513,31 @@ static void button_monitor_task(void *arg) {
 
                 // Update POI Info Box on scr_system_info
                 if (poi_info_box != NULL && poi_info_label != NULL) {
-                    char full_poi_info_str[200];
+                    char full_poi_info_str[POI_MAX_DEVICES * 80];
                     full_poi_info_str[0] = '\0'; // Initialize empty string
                     int connected_pois_count = 0;
 
-                    for (int i = 0; i < 2; i++) {
-                        if (devices[i].discovered) {
+                    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+                        uint8_t state = poi_conns.slot[i].state;
+                        if (state >= POI_SLOT_READY) {
                             connected_pois_count++;
-                            char temp_poi_str[100];
-                            snprintf(temp_poi_str, sizeof(temp_poi_str), "POI %d: Connected\n", i + 1);
+                            char temp_poi_str[80];
+                            poi_telem_stats_t ts;
+                            bool published = state == POI_SLOT_STREAMING && poi_telem_read(&devices[i].telem, &ts);
+                            if (published && ts.sequence <= 100) {
+                                snprintf(temp_poi_str, sizeof(temp_poi_str), "POI %d: upload %d%%\n", i + 1, ts.sequence);
+                            } else if (published && ts.sequence == POI_TELEM_SEQ_PLAYING) {
+                                snprintf(temp_poi_str, sizeof(temp_poi_str), "POI %d: sequence %.1fV\n", i + 1, devices[i].battery_voltage);
+                            } else if (published) {
+                                // Two lines: the stream, then the link and what it has refused or lost
+                                snprintf(temp_poi_str, sizeof(temp_poi_str), "POI %d: %.1f fps %dpx %.1fV q%d\n%ddBm %dM %.2fms nomem %lu err %lu\n",
+                                         i + 1, ts.fps_x10 / 10.0f, devices[i].num_leds, devices[i].battery_voltage, ts.level,
+                                         ts.rssi, ts.tx_phy, ts.conn_itvl * 1.25f, ts.enomem, ts.write_errors);
+                            } else if (state == POI_SLOT_STREAMING) {
+                                snprintf(temp_poi_str, sizeof(temp_poi_str), "POI %d: %.1f fps %dpx %.1fV\n", i + 1, devices[i].tx.fps, devices[i].num_leds, devices[i].battery_voltage);
+                            } else {
+                                snprintf(temp_poi_str, sizeof(temp_poi_str), "POI %d: Connected\n", i + 1);
+                            }
                             strcat(full_poi_info_str, temp_poi_str);
                         }
                     }
@@ -1832,6 +1552,10 @@ static void button_monitor_task(void *arg) {
                     lv_obj_center(poi_info_label); // Re-center after text change
                 }
 
+                if (bcast_btn != NULL) {
+                    lv_obj_set_style_bg_color(bcast_btn, bcast_on ? lv_color_make(0xFF, 0x00, 0x00) : lv_color_hex(0x404040), 0);
+                }
+
                 // Clock labels are now updated by rtc_time_update_task
 
 
@@ -1843,48 +1567,770 @@ static void button_monitor_task(void *arg) {
     }
 }
 
+// Rendered frames shared by all links; only stream_task touches these
+typedef struct {
+    int64_t t_us; // Render time, drives the playback cadence of batched frames
+    uint8_t rgb[NUM_LEDS * 3];
+} rendered_frame_t;
+
+static rendered_frame_t frame_ring[FRAME_RING_SIZE];
+static uint32_t frame_seq = 0; // Sequence number of the next frame to be rendered
+
+// Linear resample of a rendered strip to another LED count (Q16 positions, ends pinned)
+static void resample_leds(const uint8_t *src, int src_n, uint8_t *dst, int dst_n) {
+    if (dst_n == 1) {
+        memcpy(dst, &src[(src_n / 2) * 3], 3);
+        return;
+    }
+    for (int i = 0; i < dst_n; i++) {
+        uint32_t pos = ((uint32_t)(i * (src_n - 1)) << 16) / (dst_n - 1);
+        int k = pos >> 16;
+        uint32_t w = pos & 0xFFFF;
+        const uint8_t *a = &src[k * 3];
+        const uint8_t *b = (k + 1 < src_n) ? a + 3 : a;
+        for (int c = 0; c < 3; c++) {
+            dst[i * 3 + c] = (uint8_t)((a[c] * (0x10000 - w) + b[c] * w) >> 16);
+        }
+    }
+}
+
+// Pixels of f as dev shows them: the render itself, or a copy resampled into buf
+static const uint8_t *frame_pixels(const poi_device_t *dev, const rendered_frame_t *f, uint8_t *buf) {
+    if (dev->num_leds == NUM_LEDS) return f->rgb;
+    resample_leds(f->rgb, NUM_LEDS, buf, dev->num_leds);
+    return buf;
+}
+
+// Encode len bytes of pixels for dev as [cmd][body...] into out; returns its length.
+// The codec reference is left alone until commit_frame().
+static size_t encode_frame(poi_device_t *dev, const uint8_t *rgb, size_t len, uint8_t *out, size_t cap) {
+    if (dev->caps & POI_CAP_COMPRESSED) {
+        uint32_t t0 = esp_cpu_get_cycle_count();
+        size_t zlen = poi_codec_encode(&dev->codec, rgb, len, &out[1], cap - 1);
+        dev->codec.encode_cycles += esp_cpu_get_cycle_count() - t0;
+        // A raw keyframe is cheaper as plain CC_STREAM_DATA
+        if (out[1] != POI_FRAME_KEY_RAW) {
+            out[0] = poi_proto::CC_STREAM_COMPRESSED;
+            return 1 + zlen;
+        }
+    }
+    out[0] = poi_proto::CC_STREAM_DATA;
+    memcpy(&out[1], rgb, len);
+    return 1 + len;
+}
+
+// The encoded frame is part of the staged write; the poi will apply it in order
+static void commit_frame(poi_device_t *dev, const uint8_t *rgb, size_t len, const uint8_t *enc, size_t enc_len) {
+    if (!(dev->caps & POI_CAP_COMPRESSED)) return;
+    uint8_t type = enc[0] == poi_proto::CC_STREAM_COMPRESSED ? enc[1] : (uint8_t)POI_FRAME_KEY_RAW;
+    poi_codec_commit(&dev->codec, rgb, len, type, enc_len - 1);
+}
+
+// Move dev on to to_seq; frames its quality level would have sent count as superseded
+static void skip_frames(poi_device_t *dev, uint32_t to_seq) {
+    for (; dev->next_seq != to_seq; dev->next_seq++) {
+        if (poi_rate_ctl_wants(&dev->rate, dev->next_seq)) dev->tx.frames_superseded++;
+        else dev->rate.thinned++;
+    }
+}
+
+// Build the next write for dev from its backlog into buf (MAX_WRITE_LEN bytes): one frame,
+// or as many as fit in the MTU. Returns its length, 0 if there is nothing to send.
+static uint16_t stage_frames(poi_device_t *dev, int64_t now_us, uint8_t *buf, uint8_t *frames) {
+    uint32_t backlog = frame_seq - dev->next_seq;
+    if (backlog > FRAME_RING_SIZE) { // Fell out of the ring, skip to what we still have
+        dev->tx.frames_superseded += backlog - FRAME_RING_SIZE;
+        dev->next_seq = frame_seq - FRAME_RING_SIZE;
+        backlog = FRAME_RING_SIZE;
+    }
+    bool timed = (dev->caps & POI_CAP_TIMED) && dev->clock.valid;
+    if (timed) { // Don't send what would arrive after its presentation time anyway
+        int64_t arrival_us = now_us + dev->clock.rtt / 2;
+        while (backlog > 1 &&
+               frame_ring[dev->next_seq % FRAME_RING_SIZE].t_us + PLAYOUT_LATENCY_MS * 1000 < arrival_us) {
+            skip_frames(dev, dev->next_seq + 1);
+            backlog--;
+        }
+    }
+    if (!(dev->caps & POI_CAP_BATCH) && backlog > 1) { // One frame per write: send the newest
+        skip_frames(dev, frame_seq - 1);
+        backlog = 1;
+    }
+    while (dev->next_seq != frame_seq && !poi_rate_ctl_wants(&dev->rate, dev->next_seq)) { // Thinned out at this level
+        dev->rate.thinned++;
+        dev->next_seq++;
+    }
+    if (dev->next_seq == frame_seq) {
+        *frames = 0;
+        return 0;
+    }
+
+    // A timed write wraps the plain one, which is built right after its header
+    uint8_t *out = timed ? &buf[POI_TIMED_HDR_LEN] : buf;
+    uint16_t hdr_len = timed ? POI_TIMED_HDR_LEN : 0;
+    const size_t px_len = dev->num_leds * BYTES_PER_PIXEL;
+    uint16_t cap = dev->mtu > 3 ? dev->mtu - 3 : 0; // ATT write command header
+    // Before the MTU exchange completes, still send one frame per write as before
+    const uint16_t single_min = FRAME_WRITE_HDR_LEN + px_len;
+    if (cap < single_min) cap = single_min;
+    if (cap > MAX_WRITE_LEN) cap = MAX_WRITE_LEN;
+    // Last, so no write outgrows the poi; num_leds was clamped for single_min to fit within it
+    if (dev->hardware_buffer_limit > FRAME_WRITE_HDR_LEN && cap > dev->hardware_buffer_limit) cap = dev->hardware_buffer_limit;
+    cap -= hdr_len;
+
+    // Scratch off the stack: only stream_task stages frames
+    static uint8_t frame[1 + 1 + POI_CODEC_MAX_BYTES]; // [cmd][type][body] worst case
+    static uint8_t resampled[MAX_POI_LEDS * BYTES_PER_PIXEL];
+    static uint8_t quantized[MAX_POI_LEDS * BYTES_PER_PIXEL];
+    poi_batch_t batch;
+    poi_batch_begin(&batch, out, cap);
+    const rendered_frame_t *first = &frame_ring[dev->next_seq % FRAME_RING_SIZE];
+    uint32_t first_seq = dev->next_seq;
+    const rendered_frame_t *prev = NULL;
+    while (dev->next_seq != frame_seq) {
+        const rendered_frame_t *f = &frame_ring[dev->next_seq % FRAME_RING_SIZE];
+        if (!poi_rate_ctl_wants(&dev->rate, dev->next_seq)) {
+            // The poi numbers batch frames consecutively, so past a thinned gap seq only orders them; pts stays exact
+            dev->rate.thinned++;
+            dev->next_seq++;
+            continue;
+        }
+        const uint8_t *rgb = frame_pixels(dev, f, resampled);
+        if (dev->rate.reduced_depth) {
+            poi_codec_reduce_depth(rgb, px_len, quantized);
+            rgb = quantized;
+        }
+        size_t len = encode_frame(dev, rgb, px_len, frame, sizeof(frame));
+        uint32_t dt_ms = prev ? (uint32_t)((f->t_us - prev->t_us) / 1000) : 0;
+        if (!poi_batch_add(&batch, dt_ms > 0xFF ? 0xFF : dt_ms, frame[0], &frame[1], len - 1)) break;
+        commit_frame(dev, rgb, px_len, frame, len);
+        prev = f;
+        dev->next_seq++;
+    }
+
+    *frames = batch.count;
+    if (batch.count == 0) return 0;
+    poi_rate_ctl_sample_latency(&dev->rate, (uint32_t)(now_us - first->t_us));
+    // Timed poi show a frame at its pts, the rest when it arrives: half a round trip on, or about a connection interval
+    uint32_t lag_us = timed ? PLAYOUT_LATENCY_MS * 1000
+                            : (uint32_t)(now_us - first->t_us) + (dev->clock.valid ? dev->clock.rtt / 2 : dev->link.conn_itvl * 1250);
+    dev->show_lag_us = dev->show_lag_us ? dev->show_lag_us + ((int32_t)(lag_us - dev->show_lag_us) >> 3) : lag_us;
+
+    uint16_t len;
+    if (batch.count == 1) { // A single frame goes out as its own command, no batch header
+        poi_batch_frame_t bf;
+        size_t off = 0;
+        poi_batch_next(out, batch.len, &off, &bf);
+        len = hdr_len + 2 + bf.len;
+        memmove(&out[2], bf.body, bf.len);
+        out[1] = bf.cmd;
+    } else {
+        len = hdr_len + batch.len;
+    }
+
+    if (timed) {
+        uint32_t pts = poi_clock_sync_to_peer(&dev->clock, first->t_us + PLAYOUT_LATENCY_MS * 1000);
+        poi_timed_hdr(buf, (uint16_t)first_seq, pts);
+    }
+    return len;
+}
+
+// Writes of slot i still queued in the stack: pool blocks come back only once the stack is done with them
+static int link_queue_depth(int i) {
+#ifdef POI_TX_FLAT_COPY
+    return devices[i].tx.in_flight; // No pool to watch, use the scheduler's estimate
+#else
+    return poi_tx_pool_in_use(&tx_pools[i]);
+#endif
+}
+
+// Stage dev's next write and hand it to the stack; returns the NimBLE result (0 if there was nothing to send)
+static int send_frames(poi_device_t *dev, poi_tx_pool_t *pool, uint16_t conn_handle, int64_t now_us) {
+    uint32_t t0 = esp_cpu_get_cycle_count();
+    uint32_t first_seq = dev->next_seq;
+    uint32_t superseded = dev->tx.frames_superseded, thinned = dev->rate.thinned; // stage_frames() counts its skips in these
+    uint8_t frames = 0;
+#ifdef POI_TX_FLAT_COPY
+    (void)pool;
+    uint8_t buf[MAX_WRITE_LEN];
+    uint16_t len = stage_frames(dev, now_us, buf, &frames);
+    int rc = len ? ble_gattc_write_no_rsp_flat(conn_handle, dev->rx_char_handle, buf, len) : 0;
+#else
+    struct os_mbuf *om = poi_tx_pool_get(pool);
+    if (om == NULL) { // Every block of this link is still queued in the stack
+        poi_tx_sched_complete(&dev->tx, POI_TX_BUSY, 0, 0);
+        return 0;
+    }
+    // Build straight into the block's free space, then account for it
+    uint16_t len = stage_frames(dev, now_us, om->om_data, &frames);
+    int rc = 0;
+    if (len == 0 || os_mbuf_extend(om, len) == NULL) {
+        os_mbuf_free_chain(om);
+        len = 0;
+    } else {
+        rc = ble_gattc_write_no_rsp(conn_handle, dev->rx_char_handle, om); // Consumes om, even on error
+    }
+#endif
+    if (len == 0) return 0;
+
+    if (rc == 0) {
+        poi_tx_sched_complete(&dev->tx, POI_TX_OK, frames, len);
+        poi_telem_on_send(&dev->telem, now_us);
+    } else if (rc == BLE_HS_ENOMEM) {
+        // The stack dropped the write for lack of buffers: resend the same frames once it drains,
+        // from a keyframe since the codec already moved past them. The retry skips the same frames
+        // again, so take back what this attempt counted.
+        poi_tx_sched_complete(&dev->tx, POI_TX_BUSY, 0, 0);
+        dev->next_seq = first_seq;
+        dev->tx.frames_superseded = superseded;
+        dev->rate.thinned = thinned;
+        poi_codec_reset(&dev->codec);
+    } else {
+        poi_tx_sched_complete(&dev->tx, POI_TX_ERROR, 0, 0);
+        poi_codec_reset(&dev->codec); // The poi may have missed it, resync on a keyframe
+    }
+    dev->tx_cycles += esp_cpu_get_cycle_count() - t0;
+    return rc;
+}
+
+// True if the poi at addr is connected and streaming
+static bool seq_addr_streaming(const ble_addr_t *addr) {
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        if (poi_conns.slot[i].state == POI_SLOT_STREAMING && ble_addr_cmp(&devices[i].addr, addr) == 0) return true;
+    }
+    return false;
+}
+
+// Upload this poi is part of, or NULL
+static seq_job_t *seq_job_for(const poi_device_t *dev) {
+    for (int j = 0; j < POI_MAX_DEVICES; j++) {
+        if (seq_jobs[j].blob != NULL && ble_addr_cmp(&seq_jobs[j].addr, &dev->addr) == 0) return &seq_jobs[j];
+    }
+    return NULL;
+}
+
+// End the show (or drop unfinished uploads); poi go back to live frames from a keyframe
+static void seq_stop(void) {
+    for (int j = 0; j < POI_MAX_DEVICES; j++) {
+        free(seq_jobs[j].blob);
+        seq_jobs[j].blob = NULL;
+    }
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        poi_codec_reset(&devices[i].codec);
+        devices[i].next_seq = frame_seq;
+    }
+    seq_show_mode = -1;
+    seq_show_start_us = 0;
+}
+
+// Render SEQ_SECONDS of mode offline and queue an upload to every streaming poi that takes sequences
+static void seq_prepare(int mode) {
+    seq_stop();
+    int frames = SEQ_SECONDS * 1000 / FRAME_INTERVAL_MS;
+    uint8_t *raw = (uint8_t *)malloc(frames * NUM_LEDS * 3);
+    if (raw == NULL) {
+        ESP_LOGE(TAG, "No memory to render a sequence");
+        return;
+    }
+
+    // Rendered once at the modes' native 25 fps so every poi plays the same frames, on its own state so the
+    // live stream carries on where it was
+    poi_modes::input still = {};
+    still.imu.accelZ = 1.0f; // Held upright and motionless; the sequence can't follow the wrist
+    still.anim_step_q16 = 1 << 16;
+    audio_snapshot(&still); // And the sound of this moment
+    seq_mode.start(mode % MODE_COUNT);
+    for (int f = 0; f < frames; f++) {
+        uint8_t *rgb = &raw[f * NUM_LEDS * 3];
+        still.random = esp_random();
+        seq_mode.render(still, rgb, NUM_LEDS * 3);
+        for (int j = 0; j < NUM_LEDS * 3; j++) rgb[j] = (uint8_t)((rgb[j] * GLOBAL_BRIGHTNESS) >> 16);
+    }
+
+    uint8_t id = seq_next_id++;
+    int jobs = 0;
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        poi_device_t *dev = &devices[i];
+        if (poi_conns.slot[i].state != POI_SLOT_STREAMING || !(dev->caps & POI_CAP_SEQ)) continue;
+        uint8_t *blob = (uint8_t *)malloc(SEQ_MAX_BYTES);
+        if (blob == NULL) break;
+        poi_seq_builder_t b;
+        poi_seq_builder_init(&b, blob, SEQ_MAX_BYTES);
+        uint8_t buf[MAX_POI_LEDS * BYTES_PER_PIXEL];
+        for (int f = 0; f < frames; f++) {
+            const uint8_t *rgb = &raw[f * NUM_LEDS * 3];
+            if (dev->num_leds != NUM_LEDS) {
+                resample_leds(rgb, NUM_LEDS, buf, dev->num_leds);
+                rgb = buf;
+            }
+            if (!poi_seq_builder_add(&b, rgb, dev->num_leds * BYTES_PER_PIXEL)) break;
+        }
+        if (dev->free_space_kb > 0 && b.len > (uint32_t)dev->free_space_kb * 1024) {
+            ESP_LOGW(TAG, "Poi %d has %d KB free, the sequence needs %lu bytes", i, dev->free_space_kb, b.len);
+            free(blob);
+            continue;
+        }
+        seq_job_t *job = &seq_jobs[jobs++];
+        job->addr = dev->addr;
+        job->blob = blob;
+        poi_seq_upload_init(&job->up, id, blob, b.len, b.frames, 1000 / FRAME_INTERVAL_MS, dev->num_leds);
+        ESP_LOGI(TAG, "Poi %d: sequence %d is %d frames in %lu bytes (%d raw)", i, id, b.frames, b.len,
+                 b.frames * dev->num_leds * BYTES_PER_PIXEL);
+    }
+    free(raw);
+    if (jobs > 0) seq_show_mode = mode;
+}
+
+// Start the show once no upload is in progress; poi whose upload failed stay on live frames
+static void seq_check_start(int64_t now_us) {
+    if (seq_show_mode < 0 || seq_show_start_us != 0) return;
+    int done = 0;
+    for (int j = 0; j < POI_MAX_DEVICES; j++) {
+        // A poi that went away joins the show once its upload resumes and finishes
+        if (seq_jobs[j].blob == NULL || !seq_addr_streaming(&seq_jobs[j].addr)) continue;
+        if (seq_jobs[j].up.state != POI_SEQ_UP_DONE && seq_jobs[j].up.state != POI_SEQ_UP_FAILED) return;
+        if (seq_jobs[j].up.state == POI_SEQ_UP_DONE) done++;
+    }
+    if (done == 0) {
+        ESP_LOGW(TAG, "No poi took the sequence, staying live");
+        seq_stop();
+        return;
+    }
+    seq_show_start_us = now_us + PLAYOUT_LATENCY_MS * 1000;
+    ESP_LOGI(TAG, "Sequence show of %s starts on %d poi", poi_modes::registry[seq_show_mode].name, done);
+}
+
+// Next upload write or play tick for dev; returns the NimBLE result (0 if nothing was due).
+// Sets *live to whether dev should still get live frames.
+static int seq_service(poi_device_t *dev, uint16_t conn_handle, int64_t now_us, bool *live) {
+    *live = true;
+    seq_job_t *job = seq_job_for(dev);
+    if (job == NULL) return 0;
+    poi_seq_upload_t *up = &job->up;
+
+    if (up->state == POI_SEQ_UP_DONE && seq_show_start_us != 0) {
+        *live = false;
+        if (now_us < dev->seq_tick_us) return 0;
+        // Name the frame due one playout latency from now, so the tick arrives before its time
+        int64_t due_us = now_us + PLAYOUT_LATENCY_MS * 1000;
+        int64_t n = (due_us - seq_show_start_us) * up->fps / 1000000;
+        if (n < 0) n = 0;
+        due_us = seq_show_start_us + n * 1000000 / up->fps;
+        uint32_t pts = ((dev->caps & POI_CAP_TIMED) && dev->clock.valid) ? poi_clock_sync_to_peer(&dev->clock, due_us) : 0;
+        uint8_t tick[POI_SEQ_PLAY_LEN];
+        poi_seq_play(up, (uint16_t)(n % up->frames), pts, tick);
+        int rc = ble_gattc_write_no_rsp_flat(conn_handle, dev->rx_char_handle, tick, sizeof(tick));
+        if (rc == 0) dev->seq_tick_us = now_us + SEQ_TICK_MS * 1000;
+        return rc;
+    }
+
+    // Upload in the gaps between live frames
+    poi_seq_upload_poll(up, now_us);
+    if (dev->next_seq != frame_seq || !poi_tx_sched_ready(&dev->tx, now_us, os_msys_num_free())) return 0;
+    uint16_t cap = dev->mtu - 3;
+    if (cap > MAX_WRITE_LEN) cap = MAX_WRITE_LEN;
+    uint8_t buf[MAX_WRITE_LEN];
+    size_t len = poi_seq_upload_next(up, buf, cap);
+    if (len == 0) return 0;
+    int rc = ble_gattc_write_no_rsp_flat(conn_handle, dev->rx_char_handle, buf, len);
+    if (rc == 0) {
+        poi_seq_upload_sent(up, now_us);
+        poi_tx_sched_complete(&dev->tx, POI_TX_OK, 0, len);
+        if (up->state == POI_SEQ_UP_WAIT_END) ESP_LOGI(TAG, "Sequence %d sent (resumed at %lu)", up->id, up->resumed_at);
+    } else {
+        poi_tx_sched_complete(&dev->tx, rc == BLE_HS_ENOMEM ? POI_TX_BUSY : POI_TX_ERROR, 0, 0);
+    }
+    return rc;
+}
+
+// Render as fast as the slowest streaming link can carry, within FPS_MIN..FPS_MAX
+static void choose_frame_rate(void) {
+    int links = poi_conn_mgr_count(&poi_conns, POI_SLOT_DISCOVERING);
+    float fps = FPS_MAX;
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        if (poi_conns.slot[i].state != POI_SLOT_STREAMING) continue;
+        poi_device_t *dev = &devices[i];
+        uint16_t write_len = dev->mtu > 3 ? dev->mtu - 3 : 0;
+        if (write_len > MAX_WRITE_LEN) write_len = MAX_WRITE_LEN;
+        if (dev->hardware_buffer_limit > 0 && write_len > dev->hardware_buffer_limit) write_len = dev->hardware_buffer_limit;
+        float capacity = poi_link_profile_capacity(&dev->link, write_len, links) * LINK_HEADROOM;
+
+        // A link that ran out of stack buffers has shown what it really carries
+        if (dev->tx.busy_count != dev->busy_at_report && dev->tx.bytes_per_s > 0 &&
+            (dev->saturated_bps == 0 || dev->tx.bytes_per_s < dev->saturated_bps)) {
+            dev->saturated_bps = dev->tx.bytes_per_s;
+        }
+        dev->busy_at_report = dev->tx.busy_count;
+        if (dev->saturated_bps > 0 && dev->saturated_bps < capacity) capacity = dev->saturated_bps;
+
+        // Bytes per frame as actually sent, headers and compression included
+        float frame_bytes = dev->tx.frames_sent ? (float)dev->tx.bytes_sent / dev->tx.frames_sent
+                                                : dev->num_leds * BYTES_PER_PIXEL + 2;
+        if (capacity / frame_bytes < fps) fps = capacity / frame_bytes;
+    }
+    if (fps < FPS_MIN) fps = FPS_MIN;
+
+    int64_t interval_us = (int64_t)(1000000.0f / fps);
+    int64_t change_us = interval_us - frame_interval_us;
+    if (change_us > 1000 || change_us < -1000) {
+        ESP_LOGI(TAG, "Frame rate now %.1f fps", 1000000.0f / interval_us);
+        frame_interval_us = interval_us;
+        anim_step_q16 = (int32_t)(((int64_t)interval_us << 16) / (FRAME_INTERVAL_MS * 1000));
+    }
+}
+
+// --- Broadcast: one periodic advertising train that any number of poi sync to ---
+
+static poi_bcast_tx_t bcast_tx;
+static int64_t next_bcast_us = 0;
+static uint32_t bcast_errors = 0;
+
+static int bcast_start(int64_t now_us) {
+    if (!poi_bcast_tx_init(&bcast_tx, BCAST_SLICES, NUM_LEDS, BCAST_REPEAT, FRAME_INTERVAL_MS)) return BLE_HS_EINVAL;
+
+    // Extended adv: carries the slice map and tells scanning poi where the train is
+    struct ble_gap_ext_adv_params ap;
+    memset(&ap, 0, sizeof(ap));
+    ap.own_addr_type = own_addr_type;
+    ap.primary_phy = BLE_HCI_LE_PHY_1M;
+    ap.secondary_phy = BLE_HCI_LE_PHY_1M; // Periodic PDUs too: every poi can follow it, and a frame is ~1.2 ms of air per period
+    ap.sid = BCAST_SID;
+    ap.itvl_min = BCAST_ADV_ITVL_MS * 1000 / 625;
+    ap.itvl_max = ap.itvl_min;
+    ap.tx_power = 127; // Controller default
+    int rc = ble_gap_ext_adv_configure(BCAST_INSTANCE, &ap, NULL, ble_central_event, NULL);
+    if (rc != 0) return rc;
+
+    uint8_t ad[POI_BCAST_MAP_MAX + 8];
+    size_t ad_len = poi_bcast_map_encode(BCAST_SLICES, NULL, 0, ad, sizeof(ad)); // No overrides: odd prop IDs take the mirror
+    struct os_mbuf *om = ble_hs_mbuf_from_flat(ad, ad_len);
+    if (om == NULL) return BLE_HS_ENOMEM;
+    rc = ble_gap_ext_adv_set_data(BCAST_INSTANCE, om);
+    if (rc != 0) return rc;
+
+    struct ble_gap_periodic_adv_params pp;
+    memset(&pp, 0, sizeof(pp));
+    pp.itvl_min = FRAME_INTERVAL_MS * 1000 / 1250;
+    pp.itvl_max = pp.itvl_min;
+    rc = ble_gap_periodic_adv_configure(BCAST_INSTANCE, &pp);
+    if (rc == 0) rc = ble_gap_periodic_adv_start(BCAST_INSTANCE);
+    if (rc == 0) rc = ble_gap_ext_adv_start(BCAST_INSTANCE, 0, 0);
+    if (rc != 0) {
+        ble_gap_periodic_adv_stop(BCAST_INSTANCE);
+        return rc;
+    }
+    next_bcast_us = now_us;
+    ESP_LOGI(TAG, "Broadcasting %d slices of %d LEDs, %s colour, each frame repeated %d frames later, %d-byte PDUs",
+             bcast_tx.slices, bcast_tx.leds, bcast_tx.format == POI_BCAST_PACKED4 ? "4-bit" : "full",
+             bcast_tx.repeat, POI_BCAST_HDR_LEN + bcast_tx.block_len * (bcast_tx.repeat ? 2 : 1));
+    return 0;
+}
+
+static void bcast_stop(void) {
+    ble_gap_ext_adv_stop(BCAST_INSTANCE);
+    ble_gap_periodic_adv_stop(BCAST_INSTANCE);
+    ESP_LOGI(TAG, "Broadcast stopped after %lu frames (%lu bytes, %lu refused)", bcast_tx.frames, bcast_tx.bytes, bcast_errors);
+}
+
+// Newest rendered frame into the periodic adv data; the controller sends it at the next event
+static void bcast_send(void) {
+    const rendered_frame_t *f = &frame_ring[(frame_seq - 1) % FRAME_RING_SIZE];
+    uint8_t rgb[BCAST_SLICES * NUM_LEDS * 3];
+    memcpy(rgb, f->rgb, NUM_LEDS * 3);
+    for (int j = 0; j < NUM_LEDS; j++) { // Slice 1: mirrored, for the poi held the other way round
+        memcpy(&rgb[(NUM_LEDS + j) * 3], &f->rgb[(NUM_LEDS - 1 - j) * 3], 3);
+    }
+    uint8_t pdu[POI_BCAST_PDU_MAX];
+    size_t len = poi_bcast_tx_encode(&bcast_tx, rgb, pdu, sizeof(pdu));
+    struct os_mbuf *om = ble_hs_mbuf_from_flat(pdu, len);
+    if (om == NULL || ble_gap_periodic_adv_set_data(BCAST_INSTANCE, om) != 0) bcast_errors++; // Receivers fill it in from the repeat
+}
+
+// CC_STATUS: the poi's own view of the stream it is playing
+static void poi_status(int slot, const poi_proto::status_reply *st) {
+    poi_device_t *dev = &devices[slot];
+    int64_t now_us = esp_timer_get_time();
+    dev->battery_voltage = st->battery_mv / 1000.0f;
+    dev->free_space_kb = st->free_space_kb;
+    if (dev->status_us != 0) { // The first report only sets the baseline of the late counter
+        uint16_t late = st->late - dev->poi_late;
+        if (late > 0 && poi_conns.slot[slot].state == POI_SLOT_STREAMING) {
+            dev->late_frames += late;
+            poi_rate_ctl_sample_late(&dev->rate, late);
+        }
+    }
+    dev->poi_late = st->late;
+    dev->poi_last_seq = st->last_seq;
+    dev->poi_queued = st->queued;
+    dev->poi_queue_cap = st->queue_cap;
+    dev->status_us = now_us;
+    dev->frames_sent_at_status = dev->tx.frames_sent;
+}
+
+// Frames the poi holds now: what it reported, plus what was sent since, less what it played since.
+// -1 without a recent report.
+static int poi_queue_estimate(const poi_device_t *dev, int64_t now_us) {
+    if (dev->status_us == 0 || dev->poi_queue_cap == 0 || now_us - dev->status_us > 4 * STATUS_PERIOD_MS * 1000) return -1;
+    int64_t frame_us = frame_interval_us * (dev->rate.frame_div > 1 ? dev->rate.frame_div : 1);
+    int played = (int)((now_us - dev->status_us) / frame_us);
+    int est = dev->poi_queued + (int)(dev->tx.frames_sent - dev->frames_sent_at_status) - played;
+    return est > 0 ? est : 0;
+}
+
+// Replies queued by the host task: reassemble and act on them here, where the per-device state is written
+static void notify_drain(void) {
+    const poi_rx_entry_t *e;
+    while ((e = poi_rx_ring_peek(&notify_ring)) != NULL) {
+        int slot = poi_conn_mgr_find(&poi_conns, e->conn_handle);
+        if (slot >= 0 && e->len == 0) { // A notification too long to be a reply was dropped: don't splice around it
+            devices[slot].notify.reset();
+        } else if (slot >= 0) { // Else the link dropped since
+            int64_t t_us = e->t_us;
+            devices[slot].notify.feed(std::span<const uint8_t>(e->data, e->len), [slot, t_us](std::span<const uint8_t> pkt) {
+                poi_proto::config_reply cfg;
+                poi_proto::status_reply st;
+                if (pkt[1] == poi_proto::CC_TIME_SYNC) {
+                    poi_clock_sync_reply(&devices[slot].clock, pkt.data(), pkt.size(), t_us); // Arrival time, not now
+                } else if (poi_proto::decode(pkt, st)) {
+                    poi_status(slot, &st);
+                } else if (poi_proto::decode(pkt, cfg)) {
+                    config_replies[slot] = cfg;
+                    ble_npl_eventq_put(nimble_port_get_dflt_eventq(), &config_reply_event[slot]);
+                } else if (pkt[1] == poi_proto::CC_SEQ_BEGIN || pkt[1] == poi_proto::CC_SEQ_END) {
+                    seq_job_t *job = seq_job_for(&devices[slot]);
+                    if (job != NULL) poi_seq_upload_reply(&job->up, pkt.data(), pkt.size());
+                }
+            });
+        }
+        poi_rx_ring_pop(&notify_ring);
+    }
+}
+
+// Snapshot slot i's counters for the other tasks; RSSI is read from the controller here, once per publish
+static void telemetry_publish(int i, int64_t now_us) {
+    poi_device_t *dev = &devices[i];
+    poi_telem_stats_t s;
+    int8_t rssi;
+    s.uptime_ms = (uint32_t)(now_us / 1000);
+    s.frames_sent = dev->tx.frames_sent;
+    s.writes_sent = dev->tx.writes_sent;
+    s.bytes_sent = dev->tx.bytes_sent;
+    s.enomem = dev->tx.busy_count;
+    s.write_errors = dev->tx.error_count;
+    s.superseded = dev->tx.frames_superseded;
+    s.conn_itvl = dev->link.conn_itvl;
+    s.mtu = dev->mtu;
+    s.tx_phy = dev->link.tx_phy;
+    s.rssi = ble_gap_conn_rssi(poi_conns.slot[i].conn_handle, &rssi) == 0 ? rssi : POI_TELEM_RSSI_UNKNOWN;
+    s.level = dev->rate.level;
+    s.fps_x10 = (uint16_t)(dev->tx.fps * 10);
+    const seq_job_t *job = seq_job_for(dev); // The UI reads upload progress here, not from seq_jobs
+    if (job != NULL && job->up.state < POI_SEQ_UP_DONE) {
+        s.sequence = (uint8_t)(job->up.len ? (uint64_t)job->up.next * 100 / job->up.len : 0);
+    } else if (job != NULL && job->up.state == POI_SEQ_UP_DONE && seq_show_start_us != 0) {
+        s.sequence = POI_TELEM_SEQ_PLAYING;
+    } else {
+        s.sequence = POI_TELEM_SEQ_NONE;
+    }
+    poi_telem_publish(&dev->telem, &s);
+}
+
+// How long after rendering the poi show a frame: every link streams from one ring, so the mean over
+// the links measured so far; broadcast poi and those not yet measured show it PLAYOUT_LATENCY_MS on
+static int32_t display_lead_us(void) {
+    uint32_t sum = 0, n = 0;
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        if (poi_conns.slot[i].state != POI_SLOT_STREAMING || devices[i].show_lag_us == 0) continue;
+        sum += devices[i].show_lag_us;
+        n++;
+    }
+    return n > 0 ? (int32_t)(sum / n) : PLAYOUT_LATENCY_MS * 1000;
+}
+
 void stream_task(void *param) {
-    uint8_t packet[2 + (NUM_LEDS * 3)];
-    packet[0] = START_BYTE;
-    packet[1] = CC_STREAM_DATA;
-    qmi8658_data_t imu_data;
+    poi_modes::input mode_input = {};
+    static poi_imu_predict_t imu_history; // Samples of the modes that read the IMU
+    TickType_t last_wake = xTaskGetTickCount();
+    int64_t next_frame_us = 0;
+    int64_t next_stack_report_us = 0;
 
     while (1) {
-        if (is_streaming) {
-            qmi8658_read_accel(&imu_dev, &imu_data.accelX, &imu_data.accelY, &imu_data.accelZ);
-            qmi8658_read_gyro(&imu_dev, &imu_data.gyroX, &imu_data.gyroY, &imu_data.gyroZ);
-            mode_table[current_mode % MODE_COUNT](&imu_data, &packet[2], NUM_LEDS * 3);
-            // 2. APPLY GLOBAL BRIGHTNESS SCALING
-            // We start at index 2 to skip the header bytes
-            for (int j = 2; j < sizeof(packet); j++) {
-                packet[j] = (uint8_t)(packet[j] * GLOBAL_BRIGHTNESS);
+        notify_drain();
+        int64_t now_us = esp_timer_get_time();
+
+        // Sequence show: requests from the UI, uploads interrupted by a disconnect, the start
+        int req = seq_request;
+        if (req != SEQ_REQUEST_NONE) {
+            seq_request = SEQ_REQUEST_NONE;
+            if (req == SEQ_REQUEST_STOP) seq_stop();
+            else if (is_streaming) seq_prepare(req);
+        }
+        for (int j = 0; j < POI_MAX_DEVICES; j++) {
+            if (seq_jobs[j].blob != NULL && !seq_addr_streaming(&seq_jobs[j].addr)) poi_seq_upload_restart(&seq_jobs[j].up);
+        }
+        seq_check_start(now_us);
+
+        if (bcast_request) {
+            bcast_request = false;
+            if (bcast_on) {
+                bcast_stop();
+                bcast_on = false;
+            } else {
+                int rc = bcast_start(now_us);
+                if (rc != 0) ESP_LOGE(TAG, "Broadcast failed to start: %d", rc);
+                bcast_on = rc == 0;
             }
+        }
 
-            for (int i = 0; i < 2; i++) {
-                if (devices[i].conn_handle != BLE_HS_CONN_HANDLE_NONE && devices[i].discovered) {
+        live_mode.select(current_mode % MODE_COUNT);
+        const poi_modes::descriptor<poi_modes::input> &mode = poi_modes::registry[live_mode.mode()];
+        audio_wanted = (is_streaming || bcast_on) && (mode.needs & poi_modes::NEEDS_AUDIO);
+
+        if (is_streaming || bcast_on) {
+            // 1. RENDER on a fixed cadence so animation speed doesn't depend on link health
+            if (now_us >= next_frame_us) {
+                next_frame_us += frame_interval_us;
+                if (next_frame_us <= now_us) next_frame_us = now_us + frame_interval_us; // Fell behind, resync
+
+                rendered_frame_t *f = &frame_ring[frame_seq % FRAME_RING_SIZE];
+                f->t_us = now_us;
+                int32_t lead_us = display_lead_us();
+                if (mode.needs & poi_modes::NEEDS_IMU) {
+                    qmi8658_data_t imu;
+                    qmi8658_read_accel(&imu_dev, &imu.accelX, &imu.accelY, &imu.accelZ);
+                    qmi8658_read_gyro(&imu_dev, &imu.gyroX, &imu.gyroY, &imu.gyroZ);
+#ifdef IMU_NO_PREDICT
+                    mode_input.imu = imu;
+#else
+                    poi_imu_predict_add(&imu_history, now_us, &imu);
+                    lead_us -= poi_imu_predict(&imu_history, lead_us, &mode_input.imu); // What's left, past the horizon
+#endif
+                }
+                if (mode.needs & poi_modes::NEEDS_AUDIO) audio_snapshot(&mode_input);
+                mode_input.anim_step_q16 = anim_step_q16;
+                mode_input.random = esp_random();
+                mode_input.lead_us = lead_us;
+                live_mode.render(mode_input, f->rgb, NUM_LEDS * 3);
+                // 2. APPLY GLOBAL BRIGHTNESS SCALING
+                for (size_t j = 0; j < sizeof(f->rgb); j++) {
+                    f->rgb[j] = (uint8_t)((f->rgb[j] * GLOBAL_BRIGHTNESS) >> 16);
+                }
+                frame_seq++;
+            }
 
-                    if (!devices[i].stream_started) {
-                        uint8_t sc[] = {START_BYTE, CC_START_STREAM, 0xD1};
-                        if (ble_gattc_write_flat(devices[i].conn_handle, devices[i].rx_char_handle, sc, 3, NULL, NULL) == 0) {
-                            devices[i].stream_started = true;
-                            ESP_LOGI(TAG, "Handshake sent to Poi %d", i);
+            // Broadcast on the periodic adv cadence, whatever the links run at
+            if (bcast_on && frame_seq > 0 && now_us >= next_bcast_us) {
+                next_bcast_us += FRAME_INTERVAL_MS * 1000;
+                if (next_bcast_us <= now_us) next_bcast_us = now_us + FRAME_INTERVAL_MS * 1000;
+                bcast_send();
+            }
+
+            // 3. SEND to every link that has drained enough to take another write
+            // Every link reads the same ring, so N poi cost N encodes and one render.
+            for (int i = 0; i < POI_MAX_DEVICES; i++) {
+                uint8_t state = poi_conns.slot[i].state;
+                uint16_t conn_handle = poi_conns.slot[i].conn_handle;
+                if (state >= POI_SLOT_READY) {
+
+                    if (state == POI_SLOT_READY) {
+                        uint8_t sc[poi_proto::start_stream_req::wire_size];
+                        poi_proto::encode(poi_proto::start_stream_req{}, sc);
+                        if (ble_gattc_write_flat(conn_handle, devices[i].rx_char_handle, sc, sizeof(sc), NULL, NULL) == 0) {
+                            poi_conn_mgr_advance(&poi_conns, i, POI_SLOT_STREAMING);
+                            devices[i].caps = poi_caps_for_version(devices[i].protocol_version);
+                            poi_tx_sched_init(&devices[i].tx, devices[i].tx.conn_itvl_us, now_us);
+                            poi_rate_ctl_init(&devices[i].rate, &devices[i].tx, devices[i].caps & POI_CAP_DEPTH,
+                                              RATE_CTL_LATENCY_MS * 1000, now_us);
+                            poi_telem_reset(&devices[i].telem, now_us);
+                            memset(&devices[i].codec, 0, sizeof(devices[i].codec));
+                            devices[i].codec.packed4 = devices[i].caps & POI_CAP_DEPTH;
+                            devices[i].next_seq = frame_seq;
+                            poi_clock_sync_reset(&devices[i].clock, now_us);
+                            if (devices[i].caps & POI_CAP_STATUS) {
+                                uint8_t sr[poi_proto::status_req::wire_size];
+                                poi_proto::encode(poi_proto::status_req{STATUS_PERIOD_MS}, sr);
+                                ble_gattc_write_flat(conn_handle, devices[i].rx_char_handle, sr, sizeof(sr), NULL, NULL);
+                            }
+                            ESP_LOGI(TAG, "Handshake sent to Poi %d (%s%s%s%s%s stream)", i,
+                                     (devices[i].caps & POI_CAP_COMPRESSED) ? "compressed" : "raw",
+                                     (devices[i].caps & POI_CAP_BATCH) ? ", batched" : "",
+                                     (devices[i].caps & POI_CAP_TIMED) ? ", timed" : "",
+                                     (devices[i].caps & POI_CAP_DEPTH) ? ", 4-bit capable" : "",
+                                     (devices[i].caps & POI_CAP_STATUS) ? ", status" : "");
                         }
+                        continue;
+                    }
+
+                    poi_device_t *dev = &devices[i];
+                    poi_tx_sched_t *tx = &dev->tx;
+                    uint8_t sync_req[POI_TIME_SYNC_LEN];
+                    if ((dev->caps & POI_CAP_TIMED) &&
+                        poi_clock_sync_request(&dev->clock, now_us, sync_req)) {
+                        ble_gattc_write_no_rsp_flat(conn_handle, dev->rx_char_handle, sync_req, sizeof(sync_req)); // A lost ping is just a missing sample
+                    }
+
+                    bool live;
+                    int rc = seq_service(dev, conn_handle, now_us, &live);
+                    if (rc != 0 && rc != BLE_HS_ENOMEM) ESP_LOGW(TAG, "Sequence write error on device %d: %d", i, rc);
+                    if (!live) {
+                        dev->next_seq = frame_seq; // Playing from flash, nothing to catch up on afterwards
+                        // Upload traffic says nothing about live frames: start from full quality afterwards
+                        poi_rate_ctl_init(&dev->rate, tx, dev->caps & POI_CAP_DEPTH, RATE_CTL_LATENCY_MS * 1000, now_us);
                     } else {
-                        // Attempt to write
-                        int rc = ble_gattc_write_no_rsp_flat(devices[i].conn_handle, devices[i].rx_char_handle, packet, sizeof(packet));
-
-                        if (rc == BLE_HS_ENOMEM) {
-                            // Buffer full! Just skip this frame for this device to keep things moving
-                            continue;
-                        } else if (rc != 0) {
-                            ESP_LOGD(TAG, "Write error on device %d: %d", i, rc);
+                        if (dev->next_seq != frame_seq) {
+                            bool ready = poi_tx_sched_ready(tx, now_us, os_msys_num_free());
+                            poi_rate_ctl_sample_depth(&dev->rate, link_queue_depth(i));
+                            if (ready && poi_queue_estimate(dev, now_us) >= dev->poi_queue_cap) {
+                                dev->queue_holds++; // The poi has nowhere to put it yet; a newer frame goes out instead
+                                ready = false;
+                            }
+                            if (ready) {
+                                rc = send_frames(dev, &tx_pools[i], conn_handle, now_us);
+                                if (rc != 0 && rc != BLE_HS_ENOMEM) ESP_LOGW(TAG, "Write error on device %d: %d", i, rc);
+                            }
+                        }
+                        if (poi_rate_ctl_update(&dev->rate, tx, now_us)) {
+                            ESP_LOGI(TAG, "Poi %d: quality level %d (%s colour, 1/%d frames)", i, dev->rate.level,
+                                     dev->rate.reduced_depth ? "4-bit" : "full", dev->rate.frame_div);
+                        }
+                    }
+
+                    if (poi_telem_publish_due(&dev->telem, now_us)) telemetry_publish(i, now_us);
+
+                    if (poi_tx_sched_report_due(tx, now_us)) {
+                        choose_frame_rate();
+                        ESP_LOGI(TAG, "Poi %d: %.1f fps, %.1f writes/s, %.0f B/s, sent %lu, superseded %lu, busy %lu, errors %lu, itvl %lu us, mtu %d, drain %.2f/evt",
+                                 i, tx->fps, tx->writes_per_s, tx->bytes_per_s, tx->frames_sent, tx->frames_superseded,
+                                 tx->busy_count, tx->error_count, tx->conn_itvl_us, dev->mtu, tx->drain_q8 / 256.0f);
+                        if (tx->frames_sent > 0) {
+                            ESP_LOGI(TAG, "Poi %d: %lu cycles/frame to stage and send, %lu pool allocs (%lu missed, %d in use)", i,
+                                     dev->tx_cycles / tx->frames_sent, tx_pools[i].allocs, tx_pools[i].alloc_fails,
+                                     poi_tx_pool_in_use(&tx_pools[i]));
+                        }
+                        ESP_LOGI(TAG, "Poi %d: quality level %d, %lu steps down, %lu up, %lu frames thinned", i,
+                                 dev->rate.level, dev->rate.steps_down, dev->rate.steps_up, dev->rate.thinned);
+                        if ((dev->caps & POI_CAP_TIMED) && dev->clock.valid) {
+                            ESP_LOGI(TAG, "Poi %d: clock offset %ld us, rtt %lu us", i, dev->clock.offset, dev->clock.rtt);
+                        }
+                        if (dev->status_us != 0) {
+                            ESP_LOGI(TAG, "Poi %d: queue %d/%d, acked seq %u, %lu late, %lu sends held, notify ring %lu dropped, %lu oversize (peak %lu)",
+                                     i, dev->poi_queued, dev->poi_queue_cap, dev->poi_last_seq, dev->late_frames, dev->queue_holds,
+                                     notify_ring.dropped, notify_ring.oversize, notify_ring.high_water);
+                        }
+                        if ((dev->caps & POI_CAP_COMPRESSED) && tx->frames_sent > 0) {
+                            ESP_LOGI(TAG, "Poi %d: compression %.2f (%lu/%lu bytes), %lu cycles/frame", i,
+                                     dev->codec.raw_bytes ? (float)dev->codec.coded_bytes / dev->codec.raw_bytes : 1.0f,
+                                     dev->codec.coded_bytes, dev->codec.raw_bytes, dev->codec.encode_cycles / tx->frames_sent);
                         }
                     }
                 }
             }
         }
-        // Let's slow down slightly to 50ms (20fps) to stabilize dual-stream
-        vTaskDelay(pdMS_TO_TICKS(40));
+        if (now_us >= next_stack_report_us) { // For sizing the task: the deepest any path has gone so far
+            next_stack_report_us = now_us + 5000000;
+            ESP_LOGD(TAG, "stream_task: %u bytes of stack never used", (unsigned)uxTaskGetStackHighWaterMark(NULL));
+        }
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(TX_TICK_MS));
     }
 }
 
@@ -1911,6 +2357,10 @@ void audio_fft_task(void *pvParameters)
 
     while (1)
     {
+        if (!audio_wanted) { // No running mode listens: leave the samples in the I2S DMA and skip the FFT
+            vTaskDelay(pdMS_TO_TICKS(AUDIO_IDLE_POLL_MS));
+            continue;
+        }
         ret = bsp_extra_i2s_read(raw_data, N_SAMPLES * CHANNELS * sizeof(int16_t), &bytes_read, portMAX_DELAY);
         if (ret != ESP_OK || bytes_read != N_SAMPLES * CHANNELS * sizeof(int16_t))
         {
@@ -1948,7 +2398,11 @@ void audio_fft_task(void *pvParameters)
                 float imag = fft_buffer[2 * i + 1];
                 float magnitude = sqrtf(real * real + imag * imag);
                 spectrum[i] = 20 * log10f(magnitude / (N_SAMPLES / 2) + 1e-9);
+                spectrum_q8[i] = POI_FX_FROM(spectrum[i], 8);
             }
+            float sum_amplitude = 0.0f;
+            for (int i = 0; i < N_SAMPLES; i++) sum_amplitude += fabsf(audio_buffer[i]);
+            audio_level = (int32_t)(sum_amplitude * (32768.0f / N_SAMPLES) + 0.5f); // Rounded: modes multiply it by up to 20
             xSemaphoreGive(audio_spectrum_buffer_mutex);
         }
     }
@@ -2013,6 +2467,9 @@ void host_task(void *param) {
 
 extern "C" void app_main(void) {
     nvs_flash_init();
+    if (poi_peer_cache_load(&peer_cache) == ESP_OK) ESP_LOGI(TAG, "Poi cache loaded");
+    peer_cache_mutex = xSemaphoreCreateMutex();
+    xTaskCreate(peer_cache_task, "poi_cache", 3072, NULL, 1, &peer_cache_task_handle);
     bsp_display_start();
     bsp_display_backlight_on();
 
@@ -2072,7 +2529,19 @@ extern "C" void app_main(void) {
     pmu.setOffLevel(0); // 0 corresponds to 4 seconds for OFFLEVEL configuration
 
     // Init BLE
+    poi_conn_mgr_init(&poi_conns);
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        static char pool_names[POI_MAX_DEVICES][8];
+        snprintf(pool_names[i], sizeof(pool_names[i]), "poi_tx%d", i);
+        ESP_ERROR_CHECK(poi_tx_pool_init(&tx_pools[i], pool_names[i]));
+    }
     nimble_port_init();
+    ble_npl_callout_init(&candidate_window, nimble_port_get_dflt_eventq(), candidate_window_end, NULL);
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        ble_npl_callout_init(&config_timeout[i], nimble_port_get_dflt_eventq(), config_timeout_end, (void *)(intptr_t)i);
+        ble_npl_event_init(&config_reply_event[i], config_reply_received, (void *)(intptr_t)i);
+        ble_npl_callout_init(&link_timeout[i], nimble_port_get_dflt_eventq(), link_timeout_end, (void *)(intptr_t)i);
+    }
     ble_hs_cfg.sync_cb = on_sync;
 
     //Init display
@@ -2093,9 +2562,23 @@ if (err != ESP_OK) {
 	// 2. Create the UI
 	ui_init();
 
+    poi_modes::init(); // Before anything can render a mode
+    live_mode.bind(mode_arena.alloc());
+    seq_mode.bind(mode_arena.alloc());
+#ifdef POI_PALETTE_BENCH
+    palette_bench();
+#endif
+#ifdef POI_MODE_BENCH
+    poi_mode_bench_run();
+#endif
+#ifdef POI_MODE_GOLDEN
+    int golden_diffs = poi_mode_golden_check();
+    if (golden_diffs) ESP_LOGW(TAG, "Modes differ from their golden frames on %d traces", golden_diffs);
+    else ESP_LOGI(TAG, "Modes match their golden frames");
+#endif
 
     xTaskCreate(button_monitor_task, "btn", 3072, NULL, 5, NULL);
-    xTaskCreate(stream_task, "stream", 4096, NULL, 10, NULL);
+    xTaskCreate(stream_task, "stream", 6144, NULL, 10, NULL); // ~2.7 KB deepest own frames plus newlib printf; what is left is logged at debug level
 
     audio_spectrum_buffer_mutex = xSemaphoreCreateMutex();
     xTaskCreate(audio_fft_task, "audio_fft", 4 * 1024, NULL, 5, NULL);
@@ -0,0 +1,41 @@
+#include "poi_batch.h"
+#include <string.h>
+
+void poi_batch_begin(poi_batch_t *b, uint8_t *buf, uint16_t cap) {
+    b->buf = buf;
+    b->cap = cap;
+    b->count = 0;
+    poi_proto::encode(poi_proto::batch_hdr{0}, {buf, cap});
+    b->len = POI_BATCH_HDR_LEN; // Even if cap is smaller: then nothing fits
+}
+
+bool poi_batch_fits(const poi_batch_t *b, size_t len) {
+    return b->count < POI_BATCH_MAX_FRAMES && len <= 0xFF &&
+           b->len + POI_BATCH_FRAME_HDR_LEN + len <= b->cap;
+}
+
+bool poi_batch_add(poi_batch_t *b, uint8_t dt_ms, uint8_t cmd, const uint8_t *body, size_t len) {
+    if (!poi_batch_fits(b, len)) return false;
+    uint8_t *p = &b->buf[b->len];
+    poi_proto::batch_frame{(uint8_t)(b->count ? dt_ms : 0), cmd, (uint8_t)len}.put(p);
+    memcpy(&p[POI_BATCH_FRAME_HDR_LEN], body, len);
+    b->len += POI_BATCH_FRAME_HDR_LEN + len;
+    poi_proto::batch_hdr{++b->count}.put(&b->buf[poi_proto::HDR_LEN]);
+    return true;
+}
+
+int poi_batch_next(const uint8_t *pkt, size_t len, size_t *off, poi_batch_frame_t *f) {
+    if (len < POI_BATCH_HDR_LEN) return -1;
+    if (*off == 0) *off = POI_BATCH_HDR_LEN;
+    if (*off == len) return 0;
+    if (*off + POI_BATCH_FRAME_HDR_LEN > len) return -1;
+
+    poi_proto::batch_frame h = poi_proto::batch_frame::get(&pkt[*off]);
+    if (*off + POI_BATCH_FRAME_HDR_LEN + h.len > len) return -1;
+    f->dt_ms = h.dt_ms;
+    f->cmd = h.cmd;
+    f->len = h.len;
+    f->body = &pkt[*off + POI_BATCH_FRAME_HDR_LEN];
+    *off += POI_BATCH_FRAME_HDR_LEN + h.len;
+    return 1;
+}
@@ -0,0 +1,56 @@
+#ifndef POI_BATCH_H
+#define POI_BATCH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "poi_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Multi-frame stream packet (CC_STREAM_BATCH), sized to fit one ATT write:
+//   [START_BYTE][CC_STREAM_BATCH][n]
+//   n times: [dt_ms][cmd][len][body (len bytes)]
+// dt_ms is the playback delay after the previous frame (0 for the first),
+// cmd/body are exactly what a single CC_STREAM_DATA / CC_STREAM_COMPRESSED
+// write would carry after its two header bytes. The poi shows frame 0 on
+// arrival and the rest at the given cadence.
+
+#define POI_BATCH_HDR_LEN       poi_proto::batch_hdr::wire_size
+#define POI_BATCH_FRAME_HDR_LEN poi_proto::batch_frame::wire_size
+#define POI_BATCH_MAX_FRAMES    8
+
+typedef struct {
+    uint8_t *buf;
+    uint16_t cap;
+    uint16_t len;
+    uint8_t  count;
+} poi_batch_t;
+
+typedef struct {
+    uint8_t dt_ms;
+    uint8_t cmd;
+    const uint8_t *body;
+    uint8_t len;
+} poi_batch_frame_t;
+
+// Start a batch in buf (cap = usable ATT payload); writes the header
+void poi_batch_begin(poi_batch_t *b, uint8_t *buf, uint16_t cap);
+
+// True if a frame with a body of len bytes still fits
+bool poi_batch_fits(const poi_batch_t *b, size_t len);
+
+// Append one frame; returns false (batch unchanged) if it doesn't fit
+bool poi_batch_add(poi_batch_t *b, uint8_t dt_ms, uint8_t cmd, const uint8_t *body, size_t len);
+
+// Poi-side reference parser: iterate frames of a batch packet starting at *off = 0.
+// Returns 1 with f filled, 0 when done, -1 on a malformed packet.
+int poi_batch_next(const uint8_t *pkt, size_t len, size_t *off, poi_batch_frame_t *f);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_BATCH_H
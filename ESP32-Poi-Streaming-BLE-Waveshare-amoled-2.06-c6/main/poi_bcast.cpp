@@ -0,0 +1,197 @@
+#include "poi_bcast.h"
+#include "poi_frame_codec.h"
+#include <string.h>
+
+#define AD_TYPE_MFG   0xFF
+#define MAGIC_FRAME   'P'
+#define MAGIC_MAP     'M'
+#define MAP_HDR_LEN   8
+
+static uint16_t slice_len_for(uint8_t format, uint8_t leds) {
+    size_t len = (size_t)leds * 3;
+    return (uint16_t)(format == POI_BCAST_PACKED4 ? 1 + (len + 1) / 2 : len);
+}
+
+static size_t frame_len(uint16_t block_len, uint8_t repeat) {
+    return POI_BCAST_HDR_LEN + (size_t)block_len * (repeat ? 2 : 1);
+}
+
+static void put_hdr(uint8_t *out, size_t len, uint8_t magic) {
+    out[0] = (uint8_t)(len - 1); // AD length excludes itself
+    out[1] = AD_TYPE_MFG;
+    out[2] = (uint8_t)POI_BCAST_COMPANY;
+    out[3] = (uint8_t)(POI_BCAST_COMPANY >> 8);
+    out[4] = magic;
+    out[5] = POI_BCAST_VERSION;
+}
+
+// Our AD structure with magic in adv data (len bytes of AD structures); *ad_len gets its length
+static const uint8_t *find_ad(const uint8_t *adv, size_t len, uint8_t magic, size_t *ad_len) {
+    size_t i = 0;
+    while (i < len) {
+        size_t l = adv[i];
+        if (l == 0 || i + 1 + l > len) break;
+        const uint8_t *p = &adv[i];
+        if (l >= 5 && p[1] == AD_TYPE_MFG && (p[2] | p[3] << 8) == POI_BCAST_COMPANY && p[4] == magic) {
+            *ad_len = l + 1;
+            return p;
+        }
+        i += l + 1;
+    }
+    return NULL;
+}
+
+bool poi_bcast_tx_init(poi_bcast_tx_t *tx, uint8_t slices, uint8_t leds, uint8_t repeat, uint8_t frame_ms) {
+    memset(tx, 0, sizeof(*tx));
+    if (slices == 0 || leds == 0 || (size_t)leds * 3 > POI_CODEC_MAX_BYTES || repeat > POI_BCAST_REPEAT_MAX) return false;
+    static const uint8_t formats[] = {POI_BCAST_RAW, POI_BCAST_PACKED4};
+    for (uint8_t format : formats) {
+        size_t block = (size_t)slices * slice_len_for(format, leds);
+        if (frame_len(block, repeat) > POI_BCAST_PDU_MAX) continue;
+        tx->slices = slices;
+        tx->leds = leds;
+        tx->format = format;
+        tx->repeat = repeat;
+        tx->frame_ms = frame_ms;
+        tx->slice_len = slice_len_for(format, leds);
+        tx->block_len = (uint16_t)block;
+        return true;
+    }
+    return false;
+}
+
+size_t poi_bcast_tx_encode(poi_bcast_tx_t *tx, const uint8_t *rgb, uint8_t *out, size_t cap) {
+    size_t len = frame_len(tx->block_len, tx->repeat);
+    if (tx->block_len == 0 || cap < len) return 0;
+    put_hdr(out, len, MAGIC_FRAME);
+    out[6] = (uint8_t)tx->seq;
+    out[7] = (uint8_t)(tx->seq >> 8);
+    out[8] = tx->frame_ms;
+    out[9] = tx->slices;
+    out[10] = tx->leds;
+    out[11] = (uint8_t)(tx->format << 4 | tx->repeat);
+
+    uint8_t *data = &out[POI_BCAST_HDR_LEN];
+    size_t px_len = (size_t)tx->leds * 3;
+    for (int s = 0; s < tx->slices; s++) {
+        const uint8_t *src = &rgb[s * px_len];
+        uint8_t *dst = &data[s * tx->slice_len];
+        if (tx->format == POI_BCAST_PACKED4) poi_codec_pack4(src, px_len, dst);
+        else memcpy(dst, src, px_len);
+    }
+
+    if (tx->repeat > 0) { // Frames before the first go out as black
+        memcpy(&data[tx->block_len], tx->hist[(tx->hist_head + POI_BCAST_REPEAT_MAX - tx->repeat) % POI_BCAST_REPEAT_MAX], tx->block_len);
+        memcpy(tx->hist[tx->hist_head], data, tx->block_len);
+        tx->hist_head = (tx->hist_head + 1) % POI_BCAST_REPEAT_MAX;
+    }
+
+    tx->seq++;
+    tx->frames++;
+    tx->bytes += len;
+    return len;
+}
+
+size_t poi_bcast_map_encode(uint8_t slices, const uint8_t *map, uint8_t n, uint8_t *out, size_t cap) {
+    size_t len = MAP_HDR_LEN + n;
+    if (n > POI_BCAST_MAP_MAX || cap < len) return 0;
+    put_hdr(out, len, MAGIC_MAP);
+    out[6] = slices;
+    out[7] = n;
+    if (n > 0) memcpy(&out[MAP_HDR_LEN], map, n);
+    return len;
+}
+
+int poi_bcast_slice_for(const uint8_t *adv, size_t len, uint8_t prop_id) {
+    size_t n;
+    const uint8_t *p = find_ad(adv, len, MAGIC_MAP, &n);
+    if (p == NULL || n < MAP_HDR_LEN || p[5] != POI_BCAST_VERSION || p[6] == 0 || n < MAP_HDR_LEN + (size_t)p[7]) return -1;
+    uint8_t slices = p[6];
+    return prop_id < p[7] ? p[MAP_HDR_LEN + prop_id] % slices : prop_id % slices;
+}
+
+// --- Receiver ---
+
+static inline int slot_of(uint16_t seq) {
+    return seq & (POI_BCAST_RX_WINDOW - 1);
+}
+
+static bool in_window(const poi_bcast_rx_t *rx, uint16_t seq) {
+    return (uint16_t)(rx->newest - seq) < POI_BCAST_RX_WINDOW && rx->seq_of[slot_of(seq)] == seq;
+}
+
+static bool known(const poi_bcast_rx_t *rx, uint16_t seq) {
+    return in_window(rx, seq) && rx->have[slot_of(seq)];
+}
+
+void poi_bcast_rx_reset(poi_bcast_rx_t *rx) {
+    memset(rx, 0, sizeof(*rx));
+}
+
+int poi_bcast_rx_feed(poi_bcast_rx_t *rx, const uint8_t *adv, size_t len) {
+    size_t n;
+    const uint8_t *p = find_ad(adv, len, MAGIC_FRAME, &n);
+    if (p == NULL) return -1;
+    if (n < POI_BCAST_HDR_LEN || p[5] != POI_BCAST_VERSION) {
+        rx->malformed++;
+        return -1;
+    }
+    uint16_t seq = (uint16_t)(p[6] | p[7] << 8);
+    uint8_t slices = p[9], leds = p[10], format = p[11] >> 4, repeat = p[11] & 0x0F;
+    uint16_t slice_len = slice_len_for(format, leds);
+    size_t block_len = (size_t)slices * slice_len;
+    if (slices == 0 || format > POI_BCAST_PACKED4 || repeat > POI_BCAST_REPEAT_MAX || (size_t)leds * 3 > POI_CODEC_MAX_BYTES ||
+        block_len > POI_BCAST_BLOCK_MAX || n != frame_len((uint16_t)block_len, repeat)) {
+        rx->malformed++;
+        return -1;
+    }
+
+    // A new stream, or the watch changed its layout: what the window holds no longer adds up
+    if (!rx->started || slices != rx->slices || leds != rx->leds || format != rx->format || repeat != rx->repeat) {
+        rx->started = true;
+        rx->slices = slices;
+        rx->leds = leds;
+        rx->format = format;
+        rx->repeat = repeat;
+        rx->slice_len = slice_len;
+        rx->block_len = (uint16_t)block_len;
+        rx->newest = (uint16_t)(seq - POI_BCAST_RX_WINDOW);
+    }
+    rx->frame_ms = p[8];
+
+    // Advance the window: every seq it takes in counts as lost until it or its repeat arrives
+    uint16_t ahead = (uint16_t)(seq - rx->newest);
+    if (ahead != 0 && ahead < 0x8000) {
+        int clear = ahead < POI_BCAST_RX_WINDOW ? ahead : POI_BCAST_RX_WINDOW;
+        for (int k = 0; k < clear; k++) {
+            uint16_t s = (uint16_t)(seq - k);
+            rx->seq_of[slot_of(s)] = s;
+            rx->have[slot_of(s)] = false;
+        }
+        rx->newest = seq;
+    } else if (!in_window(rx, seq)) {
+        return 0; // Too old to matter
+    }
+
+    int slot = slot_of(seq);
+    memcpy(rx->data[slot], &p[POI_BCAST_HDR_LEN], block_len);
+    rx->have[slot] = true;
+    rx->received++;
+
+    uint16_t earlier = (uint16_t)(seq - repeat);
+    if (repeat > 0 && in_window(rx, earlier) && !rx->have[slot_of(earlier)]) {
+        memcpy(rx->data[slot_of(earlier)], &p[POI_BCAST_HDR_LEN + block_len], block_len);
+        rx->have[slot_of(earlier)] = true;
+        rx->recovered++;
+    }
+    return 0;
+}
+
+bool poi_bcast_rx_frame(const poi_bcast_rx_t *rx, uint16_t seq, uint8_t slice, uint8_t *rgb) {
+    if (!rx->started || slice >= rx->slices || !known(rx, seq)) return false;
+    const uint8_t *src = &rx->data[slot_of(seq)][slice * rx->slice_len];
+    size_t px_len = (size_t)rx->leds * 3;
+    if (rx->format == POI_BCAST_PACKED4) poi_codec_unpack4(src, rgb, px_len);
+    else memcpy(rgb, src, px_len);
+    return true;
+}
@@ -0,0 +1,102 @@
+#ifndef POI_BCAST_H
+#define POI_BCAST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Connectionless stream: one periodic advertising train carries every frame
+// for any number of poi, each picking its slice by prop ID. Nothing is acked,
+// so each frame also carries a copy of the frame repeat frames before it: a
+// receiver that lost a frame gets it repeat frames late, which a playout delay
+// of repeat frames hides. Spacing the copy out rides out bursts of loss as
+// well as single drops (a parity over several frames does worse on both).
+//
+// Frame, periodic adv data (one manufacturer specific AD structure):
+//   [len][0xFF][company u16]['P'][version][seq u16][frame_ms][slices][leds][format << 4 | repeat]
+//   [data: slices * slice_len][data of frame seq - repeat, repeat > 0 only]
+// slice: POI_BCAST_RAW leds * 3 RGB bytes, or POI_BCAST_PACKED4 a POI_FRAME_KEY_PACKED4 body
+//
+// Map, extended adv data (what poi scan for before syncing to the train):
+//   [len][0xFF][company u16]['M'][version][slices][n][slice of prop 0 .. n - 1]
+// Props with an ID of n or more take ID % slices.
+
+#define POI_BCAST_COMPANY   0xFFFF // Bluetooth SIG ID reserved for testing
+#define POI_BCAST_VERSION   1
+#define POI_BCAST_PDU_MAX   247    // Adv data that fits one AUX_SYNC_IND, no chaining
+#define POI_BCAST_HDR_LEN   12
+#define POI_BCAST_BLOCK_MAX (POI_BCAST_PDU_MAX - POI_BCAST_HDR_LEN)
+#define POI_BCAST_REPEAT_MAX 4
+#define POI_BCAST_MAP_MAX   32
+#define POI_BCAST_RX_WINDOW 16     // Frames a receiver keeps for recovery (power of 2)
+
+typedef enum {
+    POI_BCAST_RAW     = 0,
+    POI_BCAST_PACKED4 = 1,
+} poi_bcast_format_t;
+
+typedef struct {
+    uint8_t  slices;
+    uint8_t  leds;
+    uint8_t  format;
+    uint8_t  repeat;         // Distance of the copy in frames, 0 = none
+    uint8_t  frame_ms;       // Advertised frame period, receivers' playout step
+    uint16_t slice_len;
+    uint16_t block_len;      // slices * slice_len
+    uint16_t seq;            // Of the next frame
+    uint8_t  hist_head;      // Where the next data block goes
+    uint8_t  hist[POI_BCAST_REPEAT_MAX][POI_BCAST_BLOCK_MAX]; // Data blocks of the last repeat frames
+
+    // Statistics (monotonic)
+    uint32_t frames;
+    uint32_t bytes;
+} poi_bcast_tx_t;
+
+// Set up for slices slices of leds pixels, repeated repeat frames later; raw
+// slices when the frame fits a PDU that way, else 4-bit. False if neither fits.
+bool poi_bcast_tx_init(poi_bcast_tx_t *tx, uint8_t slices, uint8_t leds, uint8_t repeat, uint8_t frame_ms);
+
+// Frame from rgb (slices * leds * 3 bytes, slice after slice) into out; returns its length, 0 if cap is too small
+size_t poi_bcast_tx_encode(poi_bcast_tx_t *tx, const uint8_t *rgb, uint8_t *out, size_t cap);
+
+// Map AD for slices slices, map[prop ID] = slice (n entries); returns its length, 0 if cap is too small
+size_t poi_bcast_map_encode(uint8_t slices, const uint8_t *map, uint8_t n, uint8_t *out, size_t cap);
+
+// Slice prop_id plays according to the map AD in adv data, -1 if there is none
+int poi_bcast_slice_for(const uint8_t *adv, size_t len, uint8_t prop_id);
+
+// Poi-side reference receiver
+typedef struct {
+    uint8_t  slices, leds, format, repeat, frame_ms; // From the last frame
+    uint16_t slice_len;
+    uint16_t block_len;
+    bool     started;
+    uint16_t newest;                               // Highest seq seen
+
+    uint16_t seq_of[POI_BCAST_RX_WINDOW];          // Which seq each slot holds
+    bool     have[POI_BCAST_RX_WINDOW];
+    uint8_t  data[POI_BCAST_RX_WINDOW][POI_BCAST_BLOCK_MAX];
+
+    // Statistics (monotonic)
+    uint32_t received;
+    uint32_t recovered;                            // Lost frames filled in from their repeat
+    uint32_t malformed;
+} poi_bcast_rx_t;
+
+void poi_bcast_rx_reset(poi_bcast_rx_t *rx);
+
+// Periodic adv data as received; 0 if it held a frame, -1 if not
+int poi_bcast_rx_feed(poi_bcast_rx_t *rx, const uint8_t *adv, size_t len);
+
+// Pixels of slice of frame seq into rgb (leds * 3 bytes); false if the frame is lost or left the window
+bool poi_bcast_rx_frame(const poi_bcast_rx_t *rx, uint16_t seq, uint8_t slice, uint8_t *rgb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_BCAST_H
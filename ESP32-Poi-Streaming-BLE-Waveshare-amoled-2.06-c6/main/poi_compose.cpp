@@ -0,0 +1,71 @@
+#include "poi_compose.h"
+
+#define LANES 0x00FF00FFu // R and B, or G and A after >> 8
+
+// 0..255 onto 0..256, so 255 is all of the other side
+static inline uint32_t weight(uint32_t x) {
+    return x + (x >> 7);
+}
+
+// Per channel a * (256 - w) + b * w, w in 0..256
+static inline uint32_t lerp(uint32_t a, uint32_t b, uint32_t w) {
+    uint32_t u = 256 - w;
+    uint32_t rb = ((a & LANES) * u + (b & LANES) * w) >> 8 & LANES;
+    uint32_t ga = ((a >> 8 & LANES) * u + (b >> 8 & LANES) * w) & ~LANES;
+    return rb | ga;
+}
+
+// Per channel min(a + b, 255): a lane's carry out of its low byte becomes 0xFF over it
+static inline uint32_t add_sat(uint32_t a, uint32_t b) {
+    uint32_t rb = (a & LANES) + (b & LANES);
+    uint32_t ga = (a >> 8 & LANES) + (b >> 8 & LANES);
+    uint32_t crb = rb & 0x01000100u, cga = ga & 0x01000100u;
+    rb = (rb | (crb - (crb >> 8))) & LANES;
+    ga = (ga | (cga - (cga >> 8))) & LANES;
+    return rb | ga << 8;
+}
+
+// Per channel a * b / 255, rounding 255 * 255 up to 255; a lane holds one factor,
+// not both, so the channels go one at a time. Alpha is a's.
+static inline uint32_t mul(uint32_t a, uint32_t b) {
+    uint32_t r = ((a & 0xFF) * weight(b & 0xFF)) >> 8;
+    uint32_t g = ((a >> 8 & 0xFF) * weight(b >> 8 & 0xFF)) >> 8;
+    uint32_t bl = ((a >> 16 & 0xFF) * weight(b >> 16 & 0xFF)) >> 8;
+    return r | g << 8 | bl << 16 | (a & 0xFF000000u);
+}
+
+void poi_compose_from_rgb(const uint8_t *rgb, poi_compose_alpha_t alpha, uint32_t *px, int n) {
+    for (int i = 0; i < n; i++, rgb += 3) {
+        uint8_t a = 255;
+        if (alpha == POI_COMPOSE_KEYED) {
+            a = rgb[0] > rgb[1] ? rgb[0] : rgb[1];
+            if (rgb[2] > a) a = rgb[2];
+        }
+        px[i] = poi_compose_pack(rgb[0], rgb[1], rgb[2], a);
+    }
+}
+
+void poi_compose_to_rgb(const uint32_t *px, uint8_t *rgb, int n) {
+    for (int i = 0; i < n; i++, rgb += 3) {
+        rgb[0] = (uint8_t)px[i];
+        rgb[1] = (uint8_t)(px[i] >> 8);
+        rgb[2] = (uint8_t)(px[i] >> 16);
+    }
+}
+
+void poi_compose_blend(uint32_t *dst, const uint32_t *src, poi_compose_op_t op, uint8_t opacity, int n) {
+    if (opacity == 0) return;
+    uint32_t o = weight(opacity);
+    for (int i = 0; i < n; i++) {
+        uint32_t w = weight((src[i] >> 24) * o >> 8);
+        if (w == 0) continue; // Clear here: keyed layers are mostly this
+        uint32_t d = dst[i], s = src[i], x;
+        switch (op) {
+        case POI_COMPOSE_ADD:      x = add_sat(d, s); break;
+        case POI_COMPOSE_MULTIPLY: x = mul(d, s); break;
+        case POI_COMPOSE_SCREEN:   x = ~mul(~d, ~s); break;
+        default:                   x = s; break;
+        }
+        dst[i] = w == 256 ? x : lerp(d, x, w);
+    }
+}
@@ -0,0 +1,50 @@
+#ifndef POI_COMPOSE_H
+#define POI_COMPOSE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Layer compositing for stacked modes (see poi_mode_stack.h). A layer is a
+// strip of RGBA pixels packed 0xAABBGGRR, the palette layout with alpha in
+// the top byte. Blends run two channels per word: R and B sit in the
+// 0x00FF00FF lanes, G and A in the same lanes one byte down, and each lane
+// is 16 bits wide, so an 8-bit channel times a 0..256 weight fits with no
+// carry into its neighbour.
+//
+// Every operator is op(dst, src) faded in over dst by src's alpha times the
+// layer's opacity: lerp(dst, op(dst, src), w). dst's alpha rides along but
+// is never read; the stack's result is opaque.
+
+typedef enum {
+    POI_COMPOSE_ALPHA,    // src
+    POI_COMPOSE_ADD,      // dst + src, saturating
+    POI_COMPOSE_MULTIPLY, // dst * src
+    POI_COMPOSE_SCREEN,   // 1 - (1 - dst) * (1 - src): lightens like ADD without clipping
+} poi_compose_op_t;
+
+typedef enum {
+    POI_COMPOSE_OPAQUE, // Alpha 255
+    POI_COMPOSE_KEYED,  // Alpha is the brightest channel: black is clear, for effects drawn on black
+} poi_compose_alpha_t;
+
+static inline uint32_t poi_compose_pack(uint8_t r, uint8_t g, uint8_t b, uint8_t a) {
+    return r | (uint32_t)g << 8 | (uint32_t)b << 16 | (uint32_t)a << 24;
+}
+
+// n RGB pixels into px
+void poi_compose_from_rgb(const uint8_t *rgb, poi_compose_alpha_t alpha, uint32_t *px, int n);
+
+// n pixels of px out as RGB
+void poi_compose_to_rgb(const uint32_t *px, uint8_t *rgb, int n);
+
+// dst[i] = lerp(dst[i], op(dst[i], src[i]), alpha(src[i]) * opacity), opacity 0..255
+void poi_compose_blend(uint32_t *dst, const uint32_t *src, poi_compose_op_t op, uint8_t opacity, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_COMPOSE_H
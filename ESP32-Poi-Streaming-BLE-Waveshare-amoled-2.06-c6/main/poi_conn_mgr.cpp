@@ -0,0 +1,128 @@
+#include "poi_conn_mgr.h"
+#include <string.h>
+
+void poi_conn_mgr_init(poi_conn_mgr_t *m) {
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        m->slot[i].state = POI_SLOT_FREE;
+        m->slot[i].conn_handle = POI_CONN_NONE;
+    }
+    m->num_cand = 0;
+}
+
+static int find_state(const poi_conn_mgr_t *m, poi_slot_state_t state) {
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        if (m->slot[i].state == state) return i;
+    }
+    return -1;
+}
+
+int poi_conn_mgr_reserve(poi_conn_mgr_t *m) {
+    if (find_state(m, POI_SLOT_CONNECTING) >= 0) return -1;
+    int i = find_state(m, POI_SLOT_FREE);
+    if (i >= 0) m->slot[i].state = POI_SLOT_CONNECTING;
+    return i;
+}
+
+int poi_conn_mgr_connected(poi_conn_mgr_t *m, uint16_t conn_handle) {
+    int i = find_state(m, POI_SLOT_CONNECTING);
+    if (i < 0) return -1;
+    m->slot[i].state = POI_SLOT_DISCOVERING;
+    m->slot[i].conn_handle = conn_handle;
+    return i;
+}
+
+void poi_conn_mgr_connect_failed(poi_conn_mgr_t *m) {
+    int i = find_state(m, POI_SLOT_CONNECTING);
+    if (i >= 0) m->slot[i].state = POI_SLOT_FREE;
+}
+
+int poi_conn_mgr_disconnected(poi_conn_mgr_t *m, uint16_t conn_handle) {
+    int i = poi_conn_mgr_find(m, conn_handle);
+    if (i < 0) return -1;
+    m->slot[i].state = POI_SLOT_FREE;
+    m->slot[i].conn_handle = POI_CONN_NONE;
+    return i;
+}
+
+int poi_conn_mgr_find(const poi_conn_mgr_t *m, uint16_t conn_handle) {
+    if (conn_handle == POI_CONN_NONE) return -1;
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        if (m->slot[i].conn_handle == conn_handle) return i;
+    }
+    return -1;
+}
+
+bool poi_conn_mgr_advance(poi_conn_mgr_t *m, int slot, poi_slot_state_t state) {
+    if (slot < 0 || slot >= POI_MAX_DEVICES) return false;
+    uint8_t cur = m->slot[slot].state;
+    if (cur < POI_SLOT_DISCOVERING || state != cur + 1) return false;
+    m->slot[slot].state = state;
+    return true;
+}
+
+int poi_conn_mgr_count(const poi_conn_mgr_t *m, poi_slot_state_t state) {
+    int n = 0;
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        if (m->slot[i].state >= state) n++;
+    }
+    return n;
+}
+
+bool poi_conn_mgr_want_scan(const poi_conn_mgr_t *m) {
+    return find_state(m, POI_SLOT_CONNECTING) < 0 && find_state(m, POI_SLOT_FREE) >= 0;
+}
+
+int poi_conn_mgr_candidate_add(poi_conn_mgr_t *m, uint8_t addr_type, const uint8_t addr[6], int64_t now_us) {
+    for (int i = 0; i < m->num_cand; i++) {
+        poi_candidate_t *c = &m->cand[i];
+        if (c->addr_type == addr_type && memcmp(c->addr, addr, sizeof(c->addr)) == 0) {
+            c->seen_us = now_us;
+            return m->num_cand;
+        }
+    }
+    if (m->num_cand >= POI_CANDIDATES) return -1;
+    poi_candidate_t *c = &m->cand[m->num_cand++];
+    c->addr_type = addr_type;
+    memcpy(c->addr, addr, sizeof(c->addr));
+    c->seen_us = now_us;
+    return m->num_cand;
+}
+
+bool poi_conn_mgr_candidate_take(poi_conn_mgr_t *m, int64_t now_us, int64_t max_age_us, poi_candidate_t *out) {
+    while (m->num_cand > 0) {
+        poi_candidate_t c = m->cand[0];
+        m->num_cand--;
+        memmove(&m->cand[0], &m->cand[1], m->num_cand * sizeof(m->cand[0]));
+        if (now_us - c.seen_us <= max_age_us) {
+            *out = c;
+            return true;
+        }
+    }
+    return false;
+}
+
+#define AD_INCOMP_UUIDS128 0x06
+#define AD_COMP_UUIDS128   0x07
+#define AD_SHORT_NAME      0x08
+#define AD_COMP_NAME       0x09
+
+bool poi_conn_mgr_adv_is_poi(const uint8_t *data, size_t len, const uint8_t *svc_uuid128, const char *name) {
+    size_t name_len = strlen(name);
+    for (size_t i = 0; i + 1 < len;) {
+        size_t l = data[i];
+        if (l == 0 || i + 1 + l > len) break; // Padding or a truncated report
+        uint8_t type = data[i + 1];
+        const uint8_t *v = &data[i + 2];
+        size_t vlen = l - 1;
+        if (type == AD_INCOMP_UUIDS128 || type == AD_COMP_UUIDS128) {
+            for (size_t k = 0; k + 16 <= vlen; k += 16) {
+                if (memcmp(&v[k], svc_uuid128, 16) == 0) return true;
+            }
+        } else if ((type == AD_SHORT_NAME || type == AD_COMP_NAME) && vlen > 0 && vlen <= name_len &&
+                   memcmp(v, name, vlen) == 0) {
+            return true;
+        }
+        i += l + 1;
+    }
+    return false;
+}
@@ -0,0 +1,93 @@
+#ifndef POI_CONN_MGR_H
+#define POI_CONN_MGR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// How many poi we connect to at once (must not exceed CONFIG_BT_NIMBLE_MAX_CONNECTIONS)
+#ifndef CONFIG_POI_MAX_DEVICES
+#define CONFIG_POI_MAX_DEVICES 6
+#endif
+#define POI_MAX_DEVICES CONFIG_POI_MAX_DEVICES
+
+#define POI_CONN_NONE 0xFFFF // Same value as BLE_HS_CONN_HANDLE_NONE
+#define POI_CANDIDATES 8     // Advertising poi remembered between a scan and their connects
+
+// Per-slot link state. A slot only moves forward until it is released.
+typedef enum {
+    POI_SLOT_FREE = 0,    // Unused
+    POI_SLOT_CONNECTING,  // ble_gap_connect() issued, waiting for BLE_GAP_EVENT_CONNECT
+    POI_SLOT_DISCOVERING, // Connected, finding the RX/TX characteristics and reading the poi config
+    POI_SLOT_READY,       // Characteristics found, stream not started yet
+    POI_SLOT_STREAMING,   // CC_START_STREAM sent, frames flowing
+} poi_slot_state_t;
+
+typedef struct {
+    uint8_t  state;       // poi_slot_state_t
+    uint16_t conn_handle; // POI_CONN_NONE unless DISCOVERING or later
+} poi_slot_t;
+
+// A poi seen advertising, waiting for its turn to connect
+typedef struct {
+    uint8_t  addr_type;   // BLE_ADDR_*
+    uint8_t  addr[6];
+    int64_t  seen_us;     // Last advertisement
+} poi_candidate_t;
+
+typedef struct {
+    poi_slot_t      slot[POI_MAX_DEVICES];
+    poi_candidate_t cand[POI_CANDIDATES]; // Oldest first
+    uint8_t         num_cand;
+} poi_conn_mgr_t;
+
+void poi_conn_mgr_init(poi_conn_mgr_t *m);
+
+// Reserve a free slot for an outgoing connection. NimBLE runs one connect
+// procedure at a time, so this fails while another slot is CONNECTING.
+// Returns the slot index or -1.
+int poi_conn_mgr_reserve(poi_conn_mgr_t *m);
+
+// The pending connection completed (status 0): returns its slot, now DISCOVERING, or -1
+int poi_conn_mgr_connected(poi_conn_mgr_t *m, uint16_t conn_handle);
+
+// The pending connection failed or was cancelled: frees its slot
+void poi_conn_mgr_connect_failed(poi_conn_mgr_t *m);
+
+// Link dropped: frees its slot and returns the index, or -1 if it wasn't ours
+int poi_conn_mgr_disconnected(poi_conn_mgr_t *m, uint16_t conn_handle);
+
+// Slot index owning conn_handle, or -1
+int poi_conn_mgr_find(const poi_conn_mgr_t *m, uint16_t conn_handle);
+
+// Move a connected slot forward (DISCOVERING -> READY -> STREAMING); false if not allowed
+bool poi_conn_mgr_advance(poi_conn_mgr_t *m, int slot, poi_slot_state_t state);
+
+// Number of slots in state or beyond (POI_SLOT_CONNECTING counts everything in use)
+int poi_conn_mgr_count(const poi_conn_mgr_t *m, poi_slot_state_t state);
+
+// True if scanning should continue: a slot is free and no connect is pending
+bool poi_conn_mgr_want_scan(const poi_conn_mgr_t *m);
+
+// Whether an advertising report comes from a poi: it lists svc_uuid128 (16 bytes, little
+// endian) among its 128-bit service UUIDs, or its local name, complete or shortened,
+// starts name. Walks the AD structures in place and stops at the first hit, so the
+// many reports from other devices cost a few byte compares each.
+bool poi_conn_mgr_adv_is_poi(const uint8_t *data, size_t len, const uint8_t *svc_uuid128, const char *name);
+
+// Queue an advertising poi to connect to; refreshes seen_us if it is already queued.
+// Returns the number of candidates queued, or -1 if the queue is full.
+int poi_conn_mgr_candidate_add(poi_conn_mgr_t *m, uint8_t addr_type, const uint8_t addr[6], int64_t now_us);
+
+// Take the oldest candidate seen within max_age_us; staler ones are dropped. False if none.
+bool poi_conn_mgr_candidate_take(poi_conn_mgr_t *m, int64_t now_us, int64_t max_age_us, poi_candidate_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_CONN_MGR_H
@@ -0,0 +1,113 @@
+#include "poi_fixed.h"
+
+// sin over a quarter turn, Q15: sin_table[i] = sin(i / 256 * pi / 2)
+static const uint16_t sin_table[257] = {
+    0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210, 2411, 2611, 2811, 3012,
+    3212, 3412, 3612, 3812, 4011, 4211, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195,
+    6393, 6590, 6787, 6983, 7180, 7376, 7571, 7767, 7962, 8157, 8351, 8546, 8740, 8933, 9127, 9319,
+    9512, 9704, 9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605, 11793, 11980, 12167, 12354,
+    12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828, 14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269,
+    15447, 15624, 15800, 15976, 16151, 16326, 16500, 16673, 16846, 17018, 17190, 17361, 17531, 17700, 17869, 18037,
+    18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001, 20160, 20318, 20475, 20632,
+    20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856, 22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028,
+    23170, 23312, 23453, 23593, 23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680, 24812, 24943, 25073, 25202,
+    25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320, 26439, 26557, 26674, 26791, 26906, 27020, 27133,
+    27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002, 28106, 28209, 28311, 28411, 28511, 28610, 28707, 28803,
+    28899, 28993, 29086, 29178, 29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038, 30118, 30196,
+    30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853, 30920, 30986, 31050, 31114, 31177, 31238, 31298,
+    31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737, 31786, 31834, 31881, 31927, 31972, 32015, 32058, 32099,
+    32138, 32177, 32214, 32251, 32286, 32319, 32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+    32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738, 32746, 32753, 32758, 32762, 32766, 32767,
+    32768,
+};
+
+// atan(i / 256) as a binary angle (1 << 16 = one turn), first octant
+static const uint16_t atan_table[257] = {
+    0, 41, 81, 122, 163, 204, 244, 285, 326, 367, 407, 448, 489, 529, 570, 610,
+    651, 692, 732, 773, 813, 854, 894, 935, 975, 1015, 1056, 1096, 1136, 1177, 1217, 1257,
+    1297, 1337, 1377, 1417, 1457, 1497, 1537, 1577, 1617, 1656, 1696, 1736, 1775, 1815, 1854, 1894,
+    1933, 1973, 2012, 2051, 2090, 2129, 2168, 2207, 2246, 2285, 2324, 2363, 2401, 2440, 2478, 2517,
+    2555, 2594, 2632, 2670, 2708, 2746, 2784, 2822, 2860, 2897, 2935, 2973, 3010, 3047, 3085, 3122,
+    3159, 3196, 3233, 3270, 3307, 3344, 3380, 3417, 3453, 3490, 3526, 3562, 3599, 3635, 3670, 3706,
+    3742, 3778, 3813, 3849, 3884, 3920, 3955, 3990, 4025, 4060, 4095, 4129, 4164, 4199, 4233, 4267,
+    4302, 4336, 4370, 4404, 4438, 4471, 4505, 4539, 4572, 4605, 4639, 4672, 4705, 4738, 4771, 4803,
+    4836, 4869, 4901, 4933, 4966, 4998, 5030, 5062, 5094, 5125, 5157, 5188, 5220, 5251, 5282, 5313,
+    5344, 5375, 5406, 5437, 5467, 5498, 5528, 5559, 5589, 5619, 5649, 5679, 5708, 5738, 5768, 5797,
+    5826, 5856, 5885, 5914, 5943, 5972, 6000, 6029, 6058, 6086, 6114, 6142, 6171, 6199, 6227, 6254,
+    6282, 6310, 6337, 6365, 6392, 6419, 6446, 6473, 6500, 6527, 6554, 6580, 6607, 6633, 6660, 6686,
+    6712, 6738, 6764, 6790, 6815, 6841, 6867, 6892, 6917, 6943, 6968, 6993, 7018, 7043, 7068, 7092,
+    7117, 7141, 7166, 7190, 7214, 7238, 7262, 7286, 7310, 7334, 7358, 7381, 7405, 7428, 7451, 7475,
+    7498, 7521, 7544, 7566, 7589, 7612, 7635, 7657, 7679, 7702, 7724, 7746, 7768, 7790, 7812, 7834,
+    7856, 7877, 7899, 7920, 7942, 7963, 7984, 8005, 8026, 8047, 8068, 8089, 8110, 8131, 8151, 8172,
+    8192,
+};
+
+// e^-x for x = i / 32 over [0, 8], Q15
+static const uint16_t exp_table[257] = {
+    32768, 31760, 30783, 29836, 28918, 28028, 27166, 26330, 25520, 24735, 23974, 23236, 22521, 21828, 21157, 20506,
+    19875, 19263, 18671, 18096, 17539, 17000, 16477, 15970, 15479, 15002, 14541, 14093, 13660, 13239, 12832, 12437,
+    12055, 11684, 11324, 10976, 10638, 10311, 9994, 9686, 9388, 9099, 8819, 8548, 8285, 8030, 7783, 7544,
+    7312, 7087, 6869, 6657, 6452, 6254, 6061, 5875, 5694, 5519, 5349, 5185, 5025, 4871, 4721, 4575,
+    4435, 4298, 4166, 4038, 3914, 3793, 3676, 3563, 3454, 3347, 3244, 3145, 3048, 2954, 2863, 2775,
+    2690, 2607, 2527, 2449, 2374, 2301, 2230, 2161, 2095, 2030, 1968, 1907, 1849, 1792, 1737, 1683,
+    1631, 1581, 1533, 1485, 1440, 1395, 1352, 1311, 1271, 1231, 1194, 1157, 1121, 1087, 1053, 1021,
+    990, 959, 930, 901, 873, 846, 820, 795, 771, 747, 724, 702, 680, 659, 639, 619,
+    600, 582, 564, 546, 530, 513, 498, 482, 467, 453, 439, 426, 412, 400, 387, 376,
+    364, 353, 342, 331, 321, 311, 302, 292, 283, 275, 266, 258, 250, 242, 235, 228,
+    221, 214, 207, 201, 195, 189, 183, 177, 172, 167, 162, 157, 152, 147, 143, 138,
+    134, 130, 126, 122, 118, 115, 111, 108, 104, 101, 98, 95, 92, 89, 86, 84,
+    81, 79, 76, 74, 72, 69, 67, 65, 63, 61, 59, 58, 56, 54, 52, 51,
+    49, 48, 46, 45, 43, 42, 41, 40, 38, 37, 36, 35, 34, 33, 32, 31,
+    30, 29, 28, 27, 26, 26, 25, 24, 23, 23, 22, 21, 21, 20, 19, 19,
+    18, 18, 17, 17, 16, 16, 15, 15, 14, 14, 13, 13, 12, 12, 12, 11,
+    11,
+};
+
+int32_t poi_fx_sin(uint16_t angle) {
+    uint32_t a = angle & 0x3FFF;
+    if (angle & 0x4000) a = 0x4000 - a; // Second and fourth quadrants run the table backwards
+    uint32_t i = a >> 6, frac = a & 63;
+    int32_t v = sin_table[i];
+    if (frac) v += ((sin_table[i + 1] - v) * (int32_t)frac) >> 6;
+    return (angle & 0x8000) ? -v : v;
+}
+
+int32_t poi_fx_atan2(int32_t y, int32_t x) {
+    if (x == 0 && y == 0) return 0;
+    uint32_t ax = x < 0 ? 0u - (uint32_t)x : (uint32_t)x;
+    uint32_t ay = y < 0 ? 0u - (uint32_t)y : (uint32_t)y;
+    uint32_t lo = ax < ay ? ax : ay, hi = ax < ay ? ay : ax;
+    while (hi >= 1u << 15) { // Keep lo << 16 in 32 bits: no 64-bit divide libcall
+        hi >>= 1;
+        lo >>= 1;
+    }
+    uint32_t r = (lo << 16) / hi; // tan of the first-octant angle, Q16
+    uint32_t i = r >> 8, frac = r & 255;
+    int32_t a = atan_table[i];
+    if (frac) a += ((atan_table[i + 1] - a) * (int32_t)frac) >> 8;
+    if (ay > ax) a = 16384 - a;
+    if (x < 0) a = 32768 - a;
+    return y < 0 ? -a : a;
+}
+
+int32_t poi_fx_exp_neg(int32_t x) {
+    if (x <= 0) return POI_FX_ONE;
+    if (x >= 8 << 16) return 0;
+    uint32_t i = (uint32_t)x >> 11, frac = (uint32_t)x & 2047;
+    return exp_table[i] + (((exp_table[i + 1] - exp_table[i]) * (int32_t)frac) >> 11);
+}
+
+uint32_t poi_fx_sqrt(uint64_t v) {
+    uint64_t res = 0, bit = 1ull << 62;
+    while (bit > v) bit >>= 2;
+    while (bit != 0) {
+        if (v >= res + bit) {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint32_t)res;
+}
@@ -0,0 +1,94 @@
+#ifndef POI_FIXED_H
+#define POI_FIXED_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fixed-point math for the render path: the C6 has no FPU, so every float
+// op there is a libgcc call, and sinf/expf/atan2f cost hundreds of cycles.
+//
+// Formats:
+//   Q15   int32_t, POI_FX_ONE = 1.0: factors, brightness, blend weights
+//   Q16   int32_t, 1 << 16 = 1.0: accumulators that need finer steps (hue, phase)
+//   angle binary, 1 << 16 = one turn; poi_fx_atan2 returns [-32768, 32768] = [-pi, pi]
+// Constants are converted at compile time with POI_FX_Q15()/POI_FX_Q16().
+
+#define POI_FX_ONE       32768
+#define POI_FX_Q15(x)    ((int32_t)((x) * 32768.0 + 0.5))
+#define POI_FX_Q16(x)    ((int32_t)((x) * 65536.0 + 0.5))
+#define POI_FX_HUE_TURN  (255 << 16) // The modes' hue circle in Q16: fmodf(hue, 255) in float
+
+// Sensor or audio float to Q<bits>, truncating like a float to int cast; once per frame, not per LED
+#define POI_FX_FROM(x, bits) ((int32_t)((x) * (float)(1 << (bits))))
+
+static inline int32_t poi_fx_mul(int32_t a, int32_t b) { // Q15 * Q15
+    return (int32_t)(((int64_t)a * b) >> 15);
+}
+
+static inline int32_t poi_fx_mul16(int32_t a, int32_t b) { // Q16 * Q16
+    return (int32_t)(((int64_t)a * b) >> 16);
+}
+
+static inline int32_t poi_fx_clamp(int32_t v, int32_t lo, int32_t hi) {
+    return v < lo ? lo : v > hi ? hi : v;
+}
+
+static inline int32_t poi_fx_abs(int32_t v) {
+    return v < 0 ? -v : v;
+}
+
+// c * f, f in [0, POI_FX_ONE]; truncates like (uint8_t)(c * f)
+static inline uint8_t poi_fx_scale8(uint8_t c, int32_t f) {
+    return (uint8_t)((c * f) >> 15);
+}
+
+// a * (1 - t) + b * t, t in [0, POI_FX_ONE]
+static inline uint8_t poi_fx_lerp8(uint8_t a, uint8_t b, int32_t t) {
+    return (uint8_t)((a * (POI_FX_ONE - t) + b * t) >> 15);
+}
+
+// Hue byte of a Q16 hue: (uint8_t)fmodf(h, 255), negative values included
+static inline uint8_t poi_fx_hue(int32_t h) {
+    return (uint8_t)((h % POI_FX_HUE_TURN) / 65536);
+}
+
+// Keep a Q16 hue accumulator on the circle after a step (the modes' "if (h >= 255) h -= 255")
+static inline int32_t poi_fx_hue_wrap(int32_t h) {
+    return h >= POI_FX_HUE_TURN ? h - POI_FX_HUE_TURN : h;
+}
+
+// Radians (Q16) as a binary angle with 1 << 32 = one turn: phase accumulators wrap instead of growing
+static inline uint32_t poi_fx_rad_to_angle32(int32_t rad) {
+    return (uint32_t)(((int64_t)rad * 683565276) >> 16); // 2^32 / 2pi
+}
+
+// Turn (binary angle, 1 << 32 = one turn) covered in us at dps_q8 degrees a second
+static inline uint32_t poi_fx_turn(int32_t dps_q8, int32_t us) {
+    return (uint32_t)(((int64_t)dps_q8 * us * 781875) >> 24); // 2^32 / 360 / 1e6 = 781875 / 2^36
+}
+
+// sin of a binary angle, Q15 (quarter-wave table, interpolated)
+int32_t poi_fx_sin(uint16_t angle);
+
+// atan2(y, x) as a binary angle in [-32768, 32768]; any common scale of y and x
+int32_t poi_fx_atan2(int32_t y, int32_t x);
+
+// e^-x for x >= 0 in Q16, Q15; 0 past x = 8 (under half an LSB of an 8-bit channel)
+int32_t poi_fx_exp_neg(int32_t x);
+
+// floor(sqrt(v))
+uint32_t poi_fx_sqrt(uint64_t v);
+
+// Length of (x, y, z), same format as the inputs
+static inline int32_t poi_fx_hypot3(int32_t x, int32_t y, int32_t z) {
+    return (int32_t)poi_fx_sqrt((uint64_t)((int64_t)x * x) + (uint64_t)((int64_t)y * y) + (uint64_t)((int64_t)z * z));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_FIXED_H
@@ -0,0 +1,191 @@
+#include "poi_frame_codec.h"
+#include <string.h>
+
+#define RLE_RUN_FLAG  0x80
+#define RLE_MAX_COUNT 128
+
+static inline bool same_pixel(const uint8_t *a, const uint8_t *b) {
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+// Returns encoded size, or 0 if it would not fit in cap
+static size_t rle_encode(const uint8_t *px, size_t n, uint8_t *out, size_t cap) {
+    size_t o = 0;
+    size_t i = 0;
+    while (i < n) {
+        size_t run = 1;
+        while (i + run < n && run < RLE_MAX_COUNT && same_pixel(&px[i * 3], &px[(i + run) * 3])) run++;
+
+        if (run >= 2) {
+            if (o + 4 > cap) return 0;
+            out[o++] = RLE_RUN_FLAG | (uint8_t)(run - 1);
+            memcpy(&out[o], &px[i * 3], 3);
+            o += 3;
+            i += run;
+            continue;
+        }
+
+        // Literal: extend until the next pair of identical pixels starts a run
+        size_t lit = 1;
+        while (i + lit < n && lit < RLE_MAX_COUNT &&
+               !(i + lit + 1 < n && same_pixel(&px[(i + lit) * 3], &px[(i + lit + 1) * 3]))) {
+            lit++;
+        }
+        if (o + 1 + lit * 3 > cap) return 0;
+        out[o++] = (uint8_t)(lit - 1);
+        memcpy(&out[o], &px[i * 3], lit * 3);
+        o += lit * 3;
+        i += lit;
+    }
+    return o;
+}
+
+// Returns 0 if exactly n pixels were decoded from in
+static int rle_decode(const uint8_t *in, size_t in_len, uint8_t *px, size_t n) {
+    size_t o = 0;
+    size_t i = 0;
+    while (i < in_len) {
+        uint8_t tok = in[i++];
+        size_t count = (tok & ~RLE_RUN_FLAG) + 1;
+        if (o + count > n) return -1;
+        if (tok & RLE_RUN_FLAG) {
+            if (i + 3 > in_len) return -1;
+            for (size_t k = 0; k < count; k++) memcpy(&px[(o + k) * 3], &in[i], 3);
+            i += 3;
+        } else {
+            if (i + count * 3 > in_len) return -1;
+            memcpy(&px[o * 3], &in[i], count * 3);
+            i += count * 3;
+        }
+        o += count;
+    }
+    return o == n ? 0 : -1;
+}
+
+#define PACK4_LEVELS 15
+
+static uint8_t max_channel(const uint8_t *rgb, size_t len) {
+    uint8_t m = 0;
+    for (size_t k = 0; k < len; k++) {
+        if (rgb[k] > m) m = rgb[k];
+    }
+    return m;
+}
+
+static inline uint8_t pack4_q(uint8_t v, uint8_t scale) {
+    return scale ? (uint8_t)((v * PACK4_LEVELS + scale / 2) / scale) : 0;
+}
+
+static inline uint8_t pack4_v(uint8_t q, uint8_t scale) {
+    return (uint8_t)((q * scale + PACK4_LEVELS / 2) / PACK4_LEVELS);
+}
+
+void poi_codec_reduce_depth(const uint8_t *rgb, size_t len, uint8_t *out) {
+    uint8_t scale = max_channel(rgb, len);
+    for (size_t k = 0; k < len; k++) out[k] = pack4_v(pack4_q(rgb[k], scale), scale);
+}
+
+// Packed body size if every channel survives the 4-bit round trip exactly, else 0
+static size_t pack4_size(const uint8_t *rgb, size_t len) {
+    uint8_t scale = max_channel(rgb, len);
+    for (size_t k = 0; k < len; k++) {
+        if (pack4_v(pack4_q(rgb[k], scale), scale) != rgb[k]) return 0;
+    }
+    return 1 + (len + 1) / 2;
+}
+
+size_t poi_codec_pack4(const uint8_t *rgb, size_t len, uint8_t *out) {
+    uint8_t scale = max_channel(rgb, len);
+    out[0] = scale;
+    for (size_t k = 0; k < len; k += 2) {
+        uint8_t hi = pack4_q(rgb[k], scale);
+        uint8_t lo = k + 1 < len ? pack4_q(rgb[k + 1], scale) : 0;
+        out[1 + k / 2] = (uint8_t)(hi << 4 | lo);
+    }
+    return 1 + (len + 1) / 2;
+}
+
+void poi_codec_unpack4(const uint8_t *in, uint8_t *rgb, size_t len) {
+    for (size_t k = 0; k < len; k++) {
+        uint8_t b = in[1 + k / 2];
+        rgb[k] = pack4_v((k & 1) ? b & 0x0F : b >> 4, in[0]);
+    }
+}
+
+void poi_codec_reset(poi_frame_codec_t *c) {
+    c->ref_len = 0;
+    c->since_key = 0;
+}
+
+size_t poi_codec_encode(const poi_frame_codec_t *c, const uint8_t *rgb, size_t len, uint8_t *out, size_t out_cap) {
+    if (len > POI_CODEC_MAX_BYTES || out_cap < len + 1) return 0;
+    size_t n = len / 3;
+    size_t packed = c->packed4 ? pack4_size(rgb, len) : 0;
+    size_t best = packed ? packed : len; // Raw keyframe body is always available, a packed one at reduced depth
+    uint8_t *body = &out[1];
+
+    // Delta against what the peer already shows
+    if (c->ref_len == len && c->since_key < POI_CODEC_KEY_EVERY) {
+        uint8_t delta[POI_CODEC_MAX_BYTES];
+        for (size_t k = 0; k < len; k++) delta[k] = rgb[k] ^ c->ref[k];
+        size_t sz = rle_encode(delta, n, body, best - 1);
+        if (sz) {
+            out[0] = POI_FRAME_DELTA_RLE;
+            return 1 + sz;
+        }
+    }
+
+    size_t sz = rle_encode(rgb, n, body, best - 1);
+    if (sz) {
+        out[0] = POI_FRAME_KEY_RLE;
+        return 1 + sz;
+    }
+
+    if (packed) {
+        out[0] = POI_FRAME_KEY_PACKED4;
+        poi_codec_pack4(rgb, len, body);
+        return 1 + packed;
+    }
+
+    out[0] = POI_FRAME_KEY_RAW;
+    memcpy(body, rgb, len);
+    return 1 + len;
+}
+
+void poi_codec_commit(poi_frame_codec_t *c, const uint8_t *rgb, size_t len, uint8_t type, size_t coded_len) {
+    if (len > POI_CODEC_MAX_BYTES) return;
+    c->since_key = (type == POI_FRAME_DELTA_RLE) ? c->since_key + 1 : 0;
+    memcpy(c->ref, rgb, len);
+    c->ref_len = (uint16_t)len;
+    c->raw_bytes += len;
+    c->coded_bytes += coded_len;
+}
+
+int poi_codec_decode(poi_frame_codec_t *c, const uint8_t *in, size_t in_len, uint8_t *rgb, size_t len) {
+    if (in_len < 1 || len > POI_CODEC_MAX_BYTES) return -1;
+    size_t n = len / 3;
+
+    switch (in[0]) {
+        case POI_FRAME_KEY_RAW:
+            if (in_len - 1 != len) return -1;
+            memcpy(rgb, &in[1], len);
+            break;
+        case POI_FRAME_KEY_RLE:
+            if (rle_decode(&in[1], in_len - 1, rgb, n) != 0) return -1;
+            break;
+        case POI_FRAME_DELTA_RLE:
+            if (c->ref_len != len) return -1; // No reference: wait for the next keyframe
+            if (rle_decode(&in[1], in_len - 1, rgb, n) != 0) return -1;
+            for (size_t k = 0; k < len; k++) rgb[k] ^= c->ref[k];
+            break;
+        case POI_FRAME_KEY_PACKED4:
+            if (in_len - 1 != 1 + (len + 1) / 2) return -1;
+            poi_codec_unpack4(&in[1], rgb, len);
+            break;
+        default:
+            return -1;
+    }
+    memcpy(c->ref, rgb, len);
+    c->ref_len = (uint16_t)len;
+    return 0;
+}
@@ -0,0 +1,74 @@
+#ifndef POI_FRAME_CODEC_H
+#define POI_FRAME_CODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Compressed frame payload (follows START_BYTE, CC_STREAM_COMPRESSED):
+//   [type][body]
+// type POI_FRAME_KEY_RAW:   body = len raw RGB bytes
+// type POI_FRAME_KEY_RLE:   body = RLE(pixels)
+// type POI_FRAME_DELTA_RLE: body = RLE(pixels XOR previous frame)
+// type POI_FRAME_KEY_PACKED4: body = [scale][channels as 4-bit q, two per byte, high nibble first]
+//                            channel = (q * scale + 7) / 15; poi protocol v6 on
+// RLE token: 0x80|(n-1) followed by one pixel repeated n times,
+//            0x00|(n-1) followed by n literal pixels (n = 1..128)
+// A plain CC_STREAM_DATA frame is also a keyframe and becomes the reference.
+
+#define POI_CODEC_MAX_PIXELS 128
+#define POI_CODEC_MAX_BYTES  (POI_CODEC_MAX_PIXELS * 3)
+#define POI_CODEC_KEY_EVERY  50 // Force a keyframe at least this often (2s at 25fps)
+
+typedef enum {
+    POI_FRAME_KEY_RAW   = 0,
+    POI_FRAME_KEY_RLE   = 1,
+    POI_FRAME_DELTA_RLE = 2,
+    POI_FRAME_KEY_PACKED4 = 3, // Reduced colour depth, see poi_codec_reduce_depth()
+} poi_frame_type_t;
+
+// Per-link codec state; the encoder and decoder keep identical copies
+typedef struct {
+    uint8_t  ref[POI_CODEC_MAX_BYTES]; // Last frame the peer has applied
+    uint16_t ref_len;                  // 0 = no reference, next frame is a keyframe
+    uint8_t  since_key;                // Frames since the last keyframe
+    bool     packed4;                  // Peer decodes POI_FRAME_KEY_PACKED4 (caller sets)
+
+    // Encoder statistics (monotonic)
+    uint32_t raw_bytes;                // What raw CC_STREAM_DATA bodies would have cost
+    uint32_t coded_bytes;              // What was actually committed
+    uint32_t encode_cycles;            // CPU cycles spent in poi_codec_encode (caller fills)
+} poi_frame_codec_t;
+
+// Round len bytes of rgb into out to the 16 levels per channel POI_FRAME_KEY_PACKED4 carries
+// (0 to the frame's brightest channel); the encoder packs such frames at half size
+void poi_codec_reduce_depth(const uint8_t *rgb, size_t len, uint8_t *out);
+
+// POI_FRAME_KEY_PACKED4 body of len bytes of rgb ([scale][nibbles], lossy unless the
+// frame went through poi_codec_reduce_depth()); returns its size, 1 + (len + 1) / 2
+size_t poi_codec_pack4(const uint8_t *rgb, size_t len, uint8_t *out);
+void poi_codec_unpack4(const uint8_t *in, uint8_t *rgb, size_t len);
+
+// Drop the reference so the next frame is a keyframe
+void poi_codec_reset(poi_frame_codec_t *c);
+
+// Encode len bytes of RGB into out as [type][body]; returns bytes written.
+// Does not touch the reference: call poi_codec_commit() once the peer has it.
+size_t poi_codec_encode(const poi_frame_codec_t *c, const uint8_t *rgb, size_t len, uint8_t *out, size_t out_cap);
+
+// The encoded frame (first byte of encoder output is its type) was delivered; make it the new reference
+void poi_codec_commit(poi_frame_codec_t *c, const uint8_t *rgb, size_t len, uint8_t type, size_t coded_len);
+
+// Poi-side reference decoder: applies [type][body] to rgb (len bytes) and updates the reference.
+// Returns 0 on success, -1 on a malformed or out-of-sequence frame.
+int poi_codec_decode(poi_frame_codec_t *c, const uint8_t *in, size_t in_len, uint8_t *rgb, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_FRAME_CODEC_H
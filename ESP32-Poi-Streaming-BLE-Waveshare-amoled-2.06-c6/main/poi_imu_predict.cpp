@@ -0,0 +1,107 @@
+#include "poi_imu_predict.h"
+#include <string.h>
+#include "poi_fixed.h"
+
+#define NEWEST(p) (((p)->next + POI_IMU_PREDICT_HISTORY - 1) % POI_IMU_PREDICT_HISTORY)
+
+// Square of a rate, dps^2
+static inline int64_t rate_sq(int32_t dps_q8) {
+    return ((int64_t)dps_q8 * dps_q8) >> 16;
+}
+
+// (x, y) turned back by angle, which is how gravity moves in the sensor frame as the arm turns by it
+static inline void turn_back(int32_t x, int32_t y, uint16_t angle, int32_t *rx, int32_t *ry) {
+    int32_t c = poi_fx_sin((uint16_t)(angle + 16384)), s = poi_fx_sin(angle);
+    *rx = poi_fx_mul(x, c) + poi_fx_mul(y, s);
+    *ry = poi_fx_mul(y, c) - poi_fx_mul(x, s);
+}
+
+static inline bool clipped(const int32_t *accel) {
+    return poi_fx_abs(accel[0]) >= POI_IMU_PREDICT_ACCEL_MAX || poi_fx_abs(accel[1]) >= POI_IMU_PREDICT_ACCEL_MAX;
+}
+
+// Fits pull to the step from sample i to j: j's accel less i's turned back by the
+// gyro between them is the change in pull, (0, w_j^2) less (0, w_i^2) turned back
+static void fit_pull(poi_imu_predict_t *p, int i, int j) {
+    if (clipped(p->accel_q15[i]) || clipped(p->accel_q15[j])) return;
+    int32_t dt = (int32_t)(p->t_us[j] - p->t_us[i]);
+    uint16_t angle = (uint16_t)(poi_fx_turn((p->gyro_q8[i][2] + p->gyro_q8[j][2]) / 2, dt) >> 16);
+    int32_t gx, gy;
+    turn_back(p->accel_q15[i][0], p->accel_q15[i][1], angle, &gx, &gy);
+    int32_t dx = p->accel_q15[j][0] - gx, dy = p->accel_q15[j][1] - gy;
+    int64_t wi = rate_sq(p->gyro_q8[i][2]), wj = rate_sq(p->gyro_q8[j][2]);
+    int64_t ex = -(wi * poi_fx_sin(angle) >> 15), ey = wj - (wi * poi_fx_sin((uint16_t)(angle + 16384)) >> 15);
+    p->fit_num += ((dx * ex + dy * ey) >> 8) - (p->fit_num >> POI_IMU_PREDICT_FIT_SHIFT);
+    p->fit_den += ((ex * ex + ey * ey) >> 8) - (p->fit_den >> POI_IMU_PREDICT_FIT_SHIFT);
+    p->pull = p->fit_den > 0 ? (int32_t)((p->fit_num << 16) / p->fit_den) : 0;
+}
+
+void poi_imu_predict_reset(poi_imu_predict_t *p) {
+    memset(p, 0, sizeof(*p));
+}
+
+void poi_imu_predict_add(poi_imu_predict_t *p, int64_t t_us, const qmi8658_data_t *s) {
+    if (p->count > 0) {
+        int64_t newest_us = p->t_us[NEWEST(p)];
+        if (t_us <= newest_us || t_us - newest_us > POI_IMU_PREDICT_GAP_US) p->count = 0; // The arm is the same, keep pull
+    }
+    int i = p->next;
+    p->t_us[i] = t_us;
+    p->gyro_q8[i][0] = POI_FX_FROM(s->gyroX, 8);
+    p->gyro_q8[i][1] = POI_FX_FROM(s->gyroY, 8);
+    p->gyro_q8[i][2] = POI_FX_FROM(s->gyroZ, 8);
+    p->accel_q15[i][0] = POI_FX_FROM(s->accelX, 15);
+    p->accel_q15[i][1] = POI_FX_FROM(s->accelY, 15);
+    p->accel_q15[i][2] = POI_FX_FROM(s->accelZ, 15);
+    if (p->count > 0) fit_pull(p, NEWEST(p), i);
+    p->next = (p->next + 1) % POI_IMU_PREDICT_HISTORY;
+    if (p->count < POI_IMU_PREDICT_HISTORY) p->count++;
+}
+
+int32_t poi_imu_predict(const poi_imu_predict_t *p, int32_t lead_us, qmi8658_data_t *out) {
+    if (p->count == 0) {
+        memset(out, 0, sizeof(*out));
+        return 0;
+    }
+    int newest = NEWEST(p);
+    if (lead_us < 0) lead_us = 0;
+    if (lead_us > POI_IMU_PREDICT_MAX_US) lead_us = POI_IMU_PREDICT_MAX_US;
+    if (p->count < 2) lead_us = 0;
+
+    // Least-squares slope of each gyro axis against time before the newest sample, as the change over lead_us
+    int64_t st = 0, stt = 0;
+    int64_t sg[3] = {0, 0, 0}, stg[3] = {0, 0, 0};
+    for (int k = 0; k < p->count; k++) {
+        int i = (newest + POI_IMU_PREDICT_HISTORY - k) % POI_IMU_PREDICT_HISTORY;
+        int64_t t = p->t_us[i] - p->t_us[newest];
+        st += t;
+        stt += t * t;
+        for (int a = 0; a < 3; a++) {
+            sg[a] += p->gyro_q8[i][a];
+            stg[a] += t * p->gyro_q8[i][a];
+        }
+    }
+    int64_t den = p->count * stt - st * st;
+    int32_t gyro[3], mean_z = p->gyro_q8[newest][2];
+    for (int a = 0; a < 3; a++) {
+        int32_t change = den > 0 ? (int32_t)((p->count * stg[a] - st * sg[a]) * lead_us / den) : 0;
+        gyro[a] = p->gyro_q8[newest][a] + change;
+        if (a == 2) mean_z += change / 2;
+    }
+
+    const int32_t *accel = p->accel_q15[newest];
+    int32_t ax = accel[0], ay = accel[1];
+    if (!clipped(accel)) {
+        int32_t pull_now = (int32_t)(p->pull * rate_sq(p->gyro_q8[newest][2]) >> 16);
+        int32_t pull_then = (int32_t)(p->pull * rate_sq(gyro[2]) >> 16);
+        turn_back(ax, ay - pull_now, (uint16_t)(poi_fx_turn(mean_z, lead_us) >> 16), &ax, &ay);
+        ay = poi_fx_clamp(ay + pull_then, -8 * POI_FX_ONE, 8 * POI_FX_ONE); // The IMU's range
+    }
+    out->accelX = ax / 32768.0f;
+    out->accelY = ay / 32768.0f;
+    out->accelZ = accel[2] / 32768.0f;
+    out->gyroX = gyro[0] / 256.0f;
+    out->gyroY = gyro[1] / 256.0f;
+    out->gyroZ = gyro[2] / 256.0f;
+    return lead_us;
+}
@@ -0,0 +1,60 @@
+#ifndef POI_IMU_PREDICT_H
+#define POI_IMU_PREDICT_H
+
+#include <stdint.h>
+#include "qmi8658.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// IMU state carried forward to when the poi will show a frame. A frame is
+// rendered from the IMU as sampled, then spends the playout delay or a few
+// connection intervals on its way, so motion modes draw where the arm was
+// rather than where it is while the frame is up.
+//
+// The gyro is extrapolated along its least-squares trend over the last few
+// timestamped samples. The accel's x/y, where the modes read gravity, is
+// split into gravity, which turns back by the angle the arm covers about z
+// meanwhile, and the centripetal pull along the arm (y), which follows the
+// square of the predicted rate. How much pull a rate gives depends on the
+// arm, so it is fitted as the samples come in: between consecutive samples
+// gravity turns with the integrated gyro, and what it doesn't explain goes
+// to the pull. A clipped accel has lost gravity, so it is carried as it is,
+// as is accelZ.
+//
+// A gap over POI_IMU_PREDICT_GAP_US between samples (the mode stopped reading
+// the IMU) starts the history over, and the horizon is capped at
+// POI_IMU_PREDICT_MAX_US, past which a trend over a swing is a guess.
+
+#define POI_IMU_PREDICT_HISTORY   3      // More smooths gyro noise but lags a swing's turnarounds
+#define POI_IMU_PREDICT_GAP_US    200000
+#define POI_IMU_PREDICT_MAX_US    200000
+#define POI_IMU_PREDICT_ACCEL_MAX 245760 // 7.5 g in Q15: near the IMU's 8 g range the accel is clipped
+#define POI_IMU_PREDICT_FIT_SHIFT 5      // The pull's fit forgets with a time constant of 1 << 5 samples
+
+typedef struct {
+    int64_t t_us[POI_IMU_PREDICT_HISTORY];
+    int32_t gyro_q8[POI_IMU_PREDICT_HISTORY][3];   // dps
+    int32_t accel_q15[POI_IMU_PREDICT_HISTORY][3]; // g
+    uint8_t count;
+    uint8_t next;     // Slot the next sample goes in
+    int64_t fit_num;  // Least-squares sums for pull, kept over history restarts
+    int64_t fit_den;
+    int32_t pull;     // Accel along the arm per dps^2, Q16 of Q15 g
+} poi_imu_predict_t;
+
+void poi_imu_predict_reset(poi_imu_predict_t *p);
+
+// One sample, taken at t_us
+void poi_imu_predict_add(poi_imu_predict_t *p, int64_t t_us, const qmi8658_data_t *s);
+
+// The state lead_us after the newest sample into out (the newest sample as it is with
+// fewer than two in the history). Returns the lead covered, at most POI_IMU_PREDICT_MAX_US.
+int32_t poi_imu_predict(const poi_imu_predict_t *p, int32_t lead_us, qmi8658_data_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_IMU_PREDICT_H
@@ -0,0 +1,109 @@
+#include "poi_link_profile.h"
+#include <string.h>
+
+// Connection interval tiers, fastest first (1.25 ms units)
+typedef struct {
+    uint16_t itvl_min;
+    uint16_t itvl_max;
+} conn_tier_t;
+
+static const conn_tier_t conn_tiers[] = {
+    { 6, 9 },   // 7.5 - 11.25 ms
+    { 12, 24 }, // 15 - 30 ms, what every peripheral accepts
+};
+#define NUM_CONN_TIERS (sizeof(conn_tiers) / sizeof(conn_tiers[0]))
+
+#define SUPERVISION_TIMEOUT 400 // 4 s
+
+// Air time model (us): T_IFS between packets, per-packet overhead in bytes
+// (preamble + access address + header + CRC), L2CAP + ATT write header
+#define T_IFS_US         150
+#define PDU_OVERHEAD_1M  10
+#define PDU_OVERHEAD_2M  11
+#define ATT_WRITE_HDR    7
+
+void poi_link_profile_init(poi_link_profile_t *p, uint16_t conn_itvl) {
+    memset(p, 0, sizeof(*p));
+    p->step = POI_LINK_STEP_PHY;
+    p->tx_phy = POI_LINK_PHY_1M;
+    p->tx_octets = POI_LINK_TX_OCTETS_DFLT;
+    p->conn_itvl = conn_itvl;
+}
+
+// The current step is over, whatever it got
+static void advance(poi_link_profile_t *p) {
+    p->pending = false;
+    if (p->step < POI_LINK_STEP_DONE) p->step++;
+}
+
+// The current step didn't get what it asked for
+static void fall_back(poi_link_profile_t *p) {
+    if (p->step == POI_LINK_STEP_CONN_PARAMS && p->tier + 1 < (int)NUM_CONN_TIERS) {
+        p->tier++; // Retry with a slower interval
+        p->pending = false;
+        return;
+    }
+    advance(p);
+}
+
+bool poi_link_profile_next(poi_link_profile_t *p, int64_t now_us, poi_link_req_t *req) {
+    if (p->pending) {
+        if (now_us < p->deadline_us) return false;
+        fall_back(p);
+    }
+    if (p->step == POI_LINK_STEP_DONE) return false;
+
+    memset(req, 0, sizeof(*req));
+    req->step = p->step;
+    if (p->step == POI_LINK_STEP_CONN_PARAMS) {
+        req->itvl_min = conn_tiers[p->tier].itvl_min;
+        req->itvl_max = conn_tiers[p->tier].itvl_max;
+        req->latency = 0;
+        req->supervision_timeout = SUPERVISION_TIMEOUT;
+    }
+    return true;
+}
+
+void poi_link_profile_issued(poi_link_profile_t *p, int rc, int64_t now_us) {
+    if (rc != 0) {
+        fall_back(p);
+        return;
+    }
+    p->pending = true;
+    p->deadline_us = now_us + POI_LINK_STEP_TIMEOUT_US;
+}
+
+void poi_link_profile_on_phy(poi_link_profile_t *p, int status, uint8_t tx_phy) {
+    if (status == 0) p->tx_phy = tx_phy;
+    if (p->pending && p->step == POI_LINK_STEP_PHY) advance(p);
+}
+
+void poi_link_profile_on_data_len(poi_link_profile_t *p, uint16_t tx_octets) {
+    p->tx_octets = tx_octets;
+    if (p->pending && p->step == POI_LINK_STEP_DATA_LEN) advance(p);
+}
+
+void poi_link_profile_on_conn_update(poi_link_profile_t *p, int status, uint16_t conn_itvl) {
+    if (status == 0) p->conn_itvl = conn_itvl;
+    if (!p->pending || p->step != POI_LINK_STEP_CONN_PARAMS) return;
+    // A peer may settle on another interval than asked for; that is still its answer
+    if (status == 0) advance(p);
+    else fall_back(p);
+}
+
+uint32_t poi_link_profile_capacity(const poi_link_profile_t *p, uint16_t write_len, int links) {
+    if (p->conn_itvl == 0 || write_len == 0) return 0;
+    if (links < 1) links = 1;
+
+    // One data PDU from us and the peer's empty acknowledgement
+    uint32_t us_per_byte = p->tx_phy == POI_LINK_PHY_2M ? 4 : 8;
+    uint32_t overhead = p->tx_phy == POI_LINK_PHY_2M ? PDU_OVERHEAD_2M : PDU_OVERHEAD_1M;
+    uint32_t pair_us = (overhead + p->tx_octets) * us_per_byte + T_IFS_US + overhead * us_per_byte + T_IFS_US;
+
+    uint32_t itvl_us = p->conn_itvl * 1250;
+    uint32_t pdus_per_event = (itvl_us / links) / pair_us;
+    if (pdus_per_event == 0) pdus_per_event = 1; // Every event carries at least one
+
+    uint32_t pdus_per_write = (write_len + ATT_WRITE_HDR + p->tx_octets - 1) / p->tx_octets;
+    return (uint32_t)((uint64_t)pdus_per_event * write_len * 1000000 / ((uint64_t)pdus_per_write * itvl_us));
+}
@@ -0,0 +1,77 @@
+#ifndef POI_LINK_PROFILE_H
+#define POI_LINK_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// After connect each link is pushed towards LE 2M PHY, 251-byte PDUs and a
+// 7.5-11.25 ms connection interval, one request at a time. A request that is
+// rejected, fails to start or gets no answer within POI_LINK_STEP_TIMEOUT_US
+// falls back (1M PHY, 27-byte PDUs, the next slower interval tier) and the
+// next step starts. The values actually in effect are kept per link.
+
+#define POI_LINK_PHY_1M          1 // Same values as BLE_GAP_LE_PHY_1M/2M
+#define POI_LINK_PHY_2M          2
+#define POI_LINK_TX_OCTETS_DFLT  27
+#define POI_LINK_TX_OCTETS_MAX   251
+#define POI_LINK_TX_TIME_MAX     2120 // us, 251 octets on 1M; lets the peer pick either PHY
+#define POI_LINK_STEP_TIMEOUT_US 2000000
+
+typedef enum {
+    POI_LINK_STEP_PHY,         // ble_gap_set_prefered_le_phy(2M)
+    POI_LINK_STEP_DATA_LEN,    // ble_gap_set_data_len(251)
+    POI_LINK_STEP_CONN_PARAMS, // ble_gap_update_params(req.itvl_min..itvl_max)
+    POI_LINK_STEP_DONE,
+} poi_link_step_t;
+
+typedef struct {
+    uint8_t  step;        // poi_link_step_t
+    uint16_t itvl_min;    // 1.25 ms units, POI_LINK_STEP_CONN_PARAMS only
+    uint16_t itvl_max;
+    uint16_t latency;
+    uint16_t supervision_timeout; // 10 ms units
+} poi_link_req_t;
+
+typedef struct {
+    uint8_t  step;        // Current poi_link_step_t
+    uint8_t  tier;        // Connection interval tier being tried
+    bool     pending;     // Request issued, waiting for its event
+    int64_t  deadline_us; // Give up on the pending request after this
+
+    // Profile in effect (updated by any event, ours or the peer's)
+    uint8_t  tx_phy;      // POI_LINK_PHY_*
+    uint16_t tx_octets;   // LL payload bytes per PDU
+    uint16_t conn_itvl;   // 1.25 ms units, 0 until known
+} poi_link_profile_t;
+
+void poi_link_profile_init(poi_link_profile_t *p, uint16_t conn_itvl);
+
+// True if req should be issued now. Also retires a pending request that timed out.
+bool poi_link_profile_next(poi_link_profile_t *p, int64_t now_us, poi_link_req_t *req);
+
+// Return code of the NimBLE call made for req; non-zero falls back immediately
+void poi_link_profile_issued(poi_link_profile_t *p, int rc, int64_t now_us);
+
+// Controller events (status 0 = success)
+void poi_link_profile_on_phy(poi_link_profile_t *p, int status, uint8_t tx_phy);
+void poi_link_profile_on_data_len(poi_link_profile_t *p, uint16_t tx_octets);
+void poi_link_profile_on_conn_update(poi_link_profile_t *p, int status, uint16_t conn_itvl);
+
+static inline bool poi_link_profile_done(const poi_link_profile_t *p) {
+    return p->step == POI_LINK_STEP_DONE;
+}
+
+// Modelled ATT write payload bytes/s for writes of up to write_len bytes when
+// `links` connections share the radio evenly. An upper bound: the real link
+// also loses events to retransmissions and the peer's own scheduling.
+uint32_t poi_link_profile_capacity(const poi_link_profile_t *p, uint16_t write_len, int links);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_LINK_PROFILE_H
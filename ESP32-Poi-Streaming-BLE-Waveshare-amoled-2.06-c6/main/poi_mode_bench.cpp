@@ -0,0 +1,346 @@
+#include "poi_mode_bench.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef ESP_PLATFORM
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "riscv/rv_utils.h"
+#else
+#include <time.h>
+#endif
+#include "poi_compose.h"
+
+#define BENCH_FPS     POI_MODE_BENCH_FPS
+#define BENCH_FRAMES  (10 * BENCH_FPS)
+#define GOLDEN_FRAMES (40 * BENCH_FPS)
+#define GOLDEN_KEY_EVERY (GOLDEN_FRAMES / POI_MODE_GOLDEN_KEYS) // The stored frames end each stretch of this many
+
+// Events the performance counter (mpccr) counts, selected by mpcer. The
+// system leaves it on cycles, the esp_cpu_get_cycle_count() clock.
+#define BENCH_PCER_CYCLES       (1 << 0)
+#define BENCH_PCER_INSTRUCTIONS (1 << 1)
+
+#ifdef ESP_PLATFORM
+#define BENCH_UNIT "cycles"
+#else
+#define BENCH_UNIT "ns" // Host build: CLOCK_MONOTONIC, and no instruction counter
+#endif
+
+typedef struct {
+    const char *name;
+    void (*fill)(int frame, poi_modes::input *in);
+} bench_trace_t;
+
+static poi_modes::arena<poi_modes::registry, 1> bench_arena;
+static poi_modes::instance<poi_modes::registry> bench_mode;
+#ifdef ESP_PLATFORM
+static portMUX_TYPE bench_mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+// The traces are integer arithmetic throughout, and their floats are exact
+// conversions of it, so the target and a PC replay the same inputs.
+
+// A poi at arm angle a (binary, 1 << 16 = one turn) from hanging straight
+// down, turning about z at dps on a half-metre arm. The arm is y: gravity
+// plus the centripetal pull along it, which is near dps^2 / 2 in Q15 g.
+static void bench_motion(poi_modes::input *in, uint16_t a, int32_t dps) {
+    int32_t along = poi_fx_sin((uint16_t)(a + 16384)) + dps * dps / 2;
+    if (along > 8 * POI_FX_ONE) along = 8 * POI_FX_ONE; // The IMU's range
+    in->imu.accelX = poi_fx_sin(a) / 32768.0f;
+    in->imu.accelY = along / 32768.0f;
+    in->imu.accelZ = 0.0f;
+    in->imu.gyroX = 0.0f;
+    in->imu.gyroY = 0.0f;
+    in->imu.gyroZ = (float)dps;
+}
+
+// Room noise: quiet and flat
+static void bench_quiet(poi_modes::input *in) {
+    in->audio_level = POI_FX_Q15(0.002);
+    for (int i = 0; i < POI_MODE_BINS; i++) in->spectrum_q8[i] = -70 * 256;
+}
+
+// 120 bpm: a bass hit on every beat fading over it, and hiss on top that
+// repeats every 64 frames (16-bit LCG)
+static void bench_music(int frame, poi_modes::input *in) {
+    int32_t since_beat = frame % (BENCH_FPS / 2);
+    int32_t decay = POI_FX_ONE - since_beat * (POI_FX_ONE / (BENCH_FPS / 2));
+    uint16_t lcg = (uint16_t)(frame % 64 * 25173 + 13849);
+    in->audio_level = POI_FX_Q15(0.01) + poi_fx_mul(decay, POI_FX_Q15(0.06));
+    for (int i = 0; i < POI_MODE_BINS; i++) {
+        lcg = (uint16_t)(lcg * 25173 + 13849);
+        int32_t base = i < 3 ? -30 * 256 + poi_fx_mul(decay, 24 * 256) : -35 * 256 - i * 256;
+        in->spectrum_q8[i] = base + (lcg & 0x3FF) - 512; // +-2 dB
+    }
+}
+
+// A pendulum at 0.8 Hz, 60 degrees either side
+static void trace_slow_swing(int frame, poi_modes::input *in) {
+    uint16_t phase = (uint16_t)(frame * 2097); // 0.8 turns a second at 25 fps
+    int32_t a = poi_fx_sin(phase) * 10923 / POI_FX_ONE; // 60 degrees
+    bench_motion(in, (uint16_t)a, 302 * poi_fx_sin((uint16_t)(phase + 16384)) / POI_FX_ONE);
+    bench_quiet(in);
+}
+
+// Four turns a second
+static void trace_fast_spin(int frame, poi_modes::input *in) {
+    bench_motion(in, (uint16_t)(frame * 10486), 1440);
+    bench_quiet(in);
+}
+
+// Held still on a silent input
+static void trace_silence(int, poi_modes::input *in) {
+    bench_motion(in, 0, 0);
+    in->audio_level = 0;
+    for (int i = 0; i < POI_MODE_BINS; i++) in->spectrum_q8[i] = -180 * 256; // The FFT's floor
+}
+
+// Swinging to loud music
+static void trace_loud_music(int frame, poi_modes::input *in) {
+    trace_slow_swing(frame, in);
+    bench_music(frame, in);
+}
+
+static const bench_trace_t bench_traces[] = {
+    { "slow_swing", trace_slow_swing },
+    { "fast_spin", trace_fast_spin },
+    { "silence", trace_silence },
+    { "loud_music", trace_loud_music },
+};
+static_assert(sizeof(bench_traces) / sizeof(bench_traces[0]) == POI_MODE_BENCH_TRACES, "One golden row per mode and trace");
+
+static void bench_bind(void) {
+    static void *block = bench_arena.alloc();
+    bench_mode.bind(block);
+}
+
+// Frame f of trace at the 25 fps step, shown 120 ms on like the timed stream, with random bits from a 32-bit LCG in *rng
+static void bench_input(const bench_trace_t *trace, int f, poi_modes::input *in, uint32_t *rng) {
+    trace->fill(f, in);
+    in->anim_step_q16 = 1 << 16;
+    in->lead_us = 120000;
+    *rng = *rng * 1664525 + 1013904223;
+    in->random = *rng;
+}
+
+const char *poi_mode_bench_trace_name(int t) {
+    return bench_traces[t].name;
+}
+
+void poi_mode_bench_input(int t, int f, poi_modes::input *in, uint32_t *rng) {
+    bench_input(&bench_traces[t], f, in, rng);
+}
+
+// The UI label of mode on one line, without the CSV separator
+static void bench_name(int mode, char *name, int size) {
+    int n = 0;
+    for (const char *c = poi_modes::registry[mode].name; *c && n < size - 1; c++) {
+        char ch = *c == '\n' || *c == ',' ? ' ' : *c;
+        if (ch != ' ' || (n && name[n - 1] != ' ')) name[n++] = ch;
+    }
+    name[n] = '\0';
+}
+
+#ifdef ESP_PLATFORM
+// Masks interrupts and starts the performance counter on pcer events; bench_count_end() stops it
+static uint32_t bench_count_begin(uint32_t pcer) {
+    portENTER_CRITICAL(&bench_mux);
+    RV_WRITE_CSR(CSR_PCER_MACHINE, pcer);
+    return RV_READ_CSR(CSR_PCCR_MACHINE);
+}
+
+// Events since t0 from bench_count_begin()
+static uint32_t bench_count_end(uint32_t t0) {
+    uint32_t n = RV_READ_CSR(CSR_PCCR_MACHINE) - t0;
+    RV_WRITE_CSR(CSR_PCER_MACHINE, BENCH_PCER_CYCLES);
+    portEXIT_CRITICAL(&bench_mux);
+    return n;
+}
+
+// Between modes, so the idle task can feed the watchdog
+static void bench_yield(void) {
+    vTaskDelay(1);
+}
+#else
+static uint32_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec);
+}
+
+static uint32_t bench_clock_ns; // What reading the clock twice costs, taken off every count
+
+// Nanoseconds whatever pcer asks for
+static uint32_t bench_count_begin(uint32_t pcer) {
+    (void)pcer;
+    if (!bench_clock_ns) {
+        bench_clock_ns = UINT32_MAX;
+        for (int k = 0; k < 1000; k++) {
+            uint32_t t0 = bench_now_ns(), n = bench_now_ns() - t0;
+            if (n < bench_clock_ns) bench_clock_ns = n;
+        }
+    }
+    return bench_now_ns();
+}
+
+static uint32_t bench_count_end(uint32_t t0) {
+    uint32_t n = bench_now_ns() - t0;
+    return n > bench_clock_ns ? n - bench_clock_ns : 0;
+}
+
+static void bench_yield(void) {}
+#endif
+
+// The counts that end a MODEBENCH or COMPOSEBENCH record, per frame
+static void bench_print_counts(uint64_t total, uint32_t worst, uint64_t insns) {
+#ifdef ESP_PLATFORM
+    printf(",%lu,%lu,%lu\n", (unsigned long)(total / BENCH_FRAMES), (unsigned long)worst, (unsigned long)(insns / BENCH_FRAMES));
+#else
+    (void)insns;
+    printf(",%lu,%lu,-\n", (unsigned long)(total / BENCH_FRAMES), (unsigned long)worst);
+#endif
+}
+
+// Runs mode over trace from its start, counting pcer events per render; returns the total, worst in *worst
+static uint64_t bench_pass(int mode, const bench_trace_t *trace, uint32_t pcer, uint32_t *worst) {
+    static uint8_t rgb[POI_MODE_LEDS * 3];
+    poi_modes::input in = {};
+    uint32_t rng = POI_MODE_BENCH_SEED;
+    uint64_t total = 0;
+    *worst = 0;
+    bench_mode.start(mode);
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        bench_input(trace, f, &in, &rng);
+        uint32_t t0 = bench_count_begin(pcer);
+        bench_mode.render(in, rgb, sizeof(rgb));
+        uint32_t n = bench_count_end(t0);
+        total += n;
+        if (n > *worst) *worst = n;
+    }
+    return total;
+}
+
+// Composites one layer per frame onto a fresh base, counting pcer events for
+// poi_compose_from_rgb() and the blend (op < 0: poi_compose_to_rgb() alone).
+// The layer's LEDs are random, half of them black, at a random opacity.
+static uint64_t compose_pass(int op, poi_compose_alpha_t alpha, uint32_t pcer, uint32_t *worst) {
+    uint8_t rgb[POI_MODE_LEDS * 3];
+    uint32_t base[POI_MODE_LEDS], dst[POI_MODE_LEDS], src[POI_MODE_LEDS];
+    uint32_t rng = POI_MODE_BENCH_SEED;
+    uint64_t total = 0;
+    *worst = 0;
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        for (int i = 0; i < POI_MODE_LEDS; i++) {
+            rng = rng * 1664525 + 1013904223;
+            base[i] = rng | 0xFF000000u;
+            rng = rng * 1664525 + 1013904223;
+            uint32_t c = rng & 0x80 ? rng : 0;
+            rgb[i * 3] = (uint8_t)c;
+            rgb[i * 3 + 1] = (uint8_t)(c >> 8);
+            rgb[i * 3 + 2] = (uint8_t)(c >> 16);
+        }
+        rng = rng * 1664525 + 1013904223;
+        uint8_t opacity = (uint8_t)(rng >> 24);
+        for (int i = 0; i < POI_MODE_LEDS; i++) dst[i] = base[i];
+        uint32_t t0 = bench_count_begin(pcer);
+        if (op < 0) {
+            poi_compose_to_rgb(dst, rgb, POI_MODE_LEDS);
+        } else {
+            poi_compose_from_rgb(rgb, alpha, src, POI_MODE_LEDS);
+            poi_compose_blend(dst, src, (poi_compose_op_t)op, opacity, POI_MODE_LEDS);
+        }
+        uint32_t n = bench_count_end(t0);
+        total += n;
+        if (n > *worst) *worst = n;
+    }
+    return total;
+}
+
+static void compose_bench_run(void) {
+    static const char *const op_names[] = { "alpha", "add", "multiply", "screen" };
+    printf("COMPOSEBENCH,op,alpha,frames," BENCH_UNIT "_mean," BENCH_UNIT "_worst,instructions_mean\n");
+    for (int op = -1; op < 4; op++) {
+        for (int keyed = 0; keyed < (op < 0 ? 1 : 2); keyed++) {
+            poi_compose_alpha_t alpha = keyed ? POI_COMPOSE_KEYED : POI_COMPOSE_OPAQUE;
+            uint32_t worst, worst_insns;
+            uint64_t cycles = compose_pass(op, alpha, BENCH_PCER_CYCLES, &worst);
+            uint64_t insns = compose_pass(op, alpha, BENCH_PCER_INSTRUCTIONS, &worst_insns);
+            printf("COMPOSEBENCH,%s,%s,%d", op < 0 ? "to_rgb" : op_names[op], op < 0 ? "-" : keyed ? "keyed" : "opaque", BENCH_FRAMES);
+            bench_print_counts(cycles, worst, insns);
+        }
+    }
+}
+
+void poi_mode_bench_run(void) {
+    bench_bind();
+    printf("MODEBENCH,mode,name,trace,frames," BENCH_UNIT "_mean," BENCH_UNIT "_worst,instructions_mean\n");
+    for (int m = 0; m < poi_modes::COUNT; m++) {
+        char name[32];
+        bench_name(m, name, sizeof(name));
+        for (const bench_trace_t &trace : bench_traces) {
+            uint32_t worst, worst_insns;
+            uint64_t cycles = bench_pass(m, &trace, BENCH_PCER_CYCLES, &worst);
+            uint64_t insns = bench_pass(m, &trace, BENCH_PCER_INSTRUCTIONS, &worst_insns);
+            printf("MODEBENCH,%d,%s,%s,%d", m, name, trace.name, BENCH_FRAMES);
+            bench_print_counts(cycles, worst, insns);
+        }
+        bench_yield();
+    }
+    compose_bench_run();
+}
+
+// FNV-1a over every byte of every frame of mode on trace; the frames stored in the golden rows in keys
+static uint32_t golden_pass(int mode, const bench_trace_t *trace, uint8_t (*keys)[POI_MODE_LEDS * 3]) {
+    poi_modes::input in = {};
+    uint8_t rgb[POI_MODE_LEDS * 3];
+    uint32_t rng = POI_MODE_BENCH_SEED, hash = 2166136261u;
+    bench_mode.start(mode);
+    for (int f = 0; f < GOLDEN_FRAMES; f++) {
+        bench_input(trace, f, &in, &rng);
+        bench_mode.render(in, rgb, sizeof(rgb));
+        for (int i = 0; i < POI_MODE_LEDS * 3; i++) hash = (hash ^ rgb[i]) * 16777619u;
+        if ((f + 1) % GOLDEN_KEY_EVERY == 0) memcpy(keys[f / GOLDEN_KEY_EVERY], rgb, sizeof(rgb));
+    }
+    return hash;
+}
+
+int poi_mode_golden_check(void) {
+    bench_bind();
+    int differ = 0;
+    printf("MODEGOLDEN,mode,name,trace,status,hash,max_delta,leds_off\n");
+    for (int m = 0; m < poi_modes::COUNT; m++) {
+        char name[32];
+        bench_name(m, name, sizeof(name));
+        for (int t = 0; t < POI_MODE_BENCH_TRACES; t++) {
+            const poi_mode_golden_t *g = &poi_mode_golden[m * POI_MODE_BENCH_TRACES + t];
+            uint8_t keys[POI_MODE_GOLDEN_KEYS][POI_MODE_LEDS * 3];
+            uint32_t hash = golden_pass(m, &bench_traces[t], keys);
+            int max_delta = 0, leds_off = 0;
+            for (int k = 0; k < POI_MODE_GOLDEN_KEYS; k++) {
+                for (int led = 0; led < POI_MODE_LEDS; led++) {
+                    int d = 0;
+                    for (int c = led * 3; c < led * 3 + 3; c++) {
+                        int dc = keys[k][c] > g->key[k][c] ? keys[k][c] - g->key[k][c] : g->key[k][c] - keys[k][c];
+                        if (dc > d) d = dc;
+                    }
+                    leds_off += d > 0;
+                    if (d > max_delta) max_delta = d;
+                }
+            }
+            const char *status = hash == g->hash ? "same" : max_delta <= POI_MODE_GOLDEN_TOL ? "near" : "DIFF";
+            printf("MODEGOLDEN,%d,%s,%s,%s,0x%08lx,%d,%d\n", m, name, bench_traces[t].name, status,
+                   (unsigned long)hash, max_delta, leds_off);
+            if (hash == g->hash) continue;
+            differ++;
+            printf("MODEGOLDEN_ROW    { 0x%08lx, {", (unsigned long)hash);
+            for (int k = 0; k < POI_MODE_GOLDEN_KEYS; k++) {
+                printf(" {");
+                for (int i = 0; i < POI_MODE_LEDS * 3; i++) printf(" 0x%02x%s", keys[k][i], i + 1 < POI_MODE_LEDS * 3 ? "," : "");
+                printf(" }%s", k + 1 < POI_MODE_GOLDEN_KEYS ? "," : "");
+            }
+            printf(" } }, // %d %s, %s\n", m, name, bench_traces[t].name);
+        }
+        bench_yield();
+    }
+    return differ;
+}
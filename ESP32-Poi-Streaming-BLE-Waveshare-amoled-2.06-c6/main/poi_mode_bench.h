@@ -0,0 +1,68 @@
+#ifndef POI_MODE_BENCH_H
+#define POI_MODE_BENCH_H
+
+#include <stdint.h>
+#include "poi_modes.h"
+
+// Every registered mode (see poi_modes.h) replayed over synthetic input
+// traces: slow swing, fast spin, silence and loud music at the modes'
+// native 25 fps. Each mode restarts from its initial state for each trace,
+// and the traces, time steps and random bits are the same on every run and
+// every platform, so results compare across builds.
+//
+// The bench times 10 s of each trace. One CSV record per mode and trace on
+// stdout, for host-side tooling:
+//   MODEBENCH,<mode index>,<mode name>,<trace>,<frames>,<mean cycles>,<worst cycles>,<mean instructions>
+// preceded by a MODEBENCH,mode,... header record. Per-frame figures cover
+// the render call alone, with interrupts masked; the instructions come from a
+// second pass with the CPU performance counter switched to count them. The
+// app version in the boot log ties a run to its commit.
+//
+// Then the compositor (poi_compose.h), one stack layer per operator and
+// alpha kind: poi_compose_from_rgb() and poi_compose_blend() on a strip,
+//   COMPOSEBENCH,<op>,<opaque|keyed>,<frames>,<mean cycles>,<worst cycles>,<mean instructions>
+// and a to_rgb record for the one poi_compose_to_rgb() a stack ends with.
+// A stack of n layers costs its modes' renders, n - 1 layer records and to_rgb.
+//
+// The golden check renders 40 s of each trace and compares a hash of every
+// frame with poi_mode_golden, and the frames the table stores (one every
+// 10 s) LED by LED:
+//   MODEGOLDEN,<mode index>,<mode name>,<trace>,<status>,<hash>,<max delta>,<LEDs off>
+// status is same (every frame matches), near (the hash differs but no
+// channel of any stored frame is more than POI_MODE_GOLDEN_TOL off) or DIFF.
+// The delta and LED count cover every stored frame.
+// Each pair that differs is followed by a MODEGOLDEN_ROW line holding its
+// new row, to paste into poi_mode_golden.cpp when a look changes on purpose.
+//
+// Both also build on a PC, where test/host runs them as test_mode_bench and
+// test_mode_golden. There the per-frame figures are nanoseconds from
+// CLOCK_MONOTONIC less the cost of reading it, headed ns_mean and ns_worst,
+// and the instruction column is "-".
+
+#define POI_MODE_BENCH_TRACES 4
+#define POI_MODE_BENCH_FPS    25
+#define POI_MODE_BENCH_SEED   0x5EED5EEDu // input.random starts here on every replay
+#define POI_MODE_GOLDEN_KEYS  4 // Frames stored per mode and trace, at 10, 20, 30 and 40 s
+#define POI_MODE_GOLDEN_TOL   2 // Channel steps a rewrite may move any stored frame by to count as near
+
+typedef struct {
+    uint32_t hash;                                          // FNV-1a over every frame
+    uint8_t key[POI_MODE_GOLDEN_KEYS][POI_MODE_LEDS * 3];   // The frames ending each 10 s
+} poi_mode_golden_t;
+
+// [mode * POI_MODE_BENCH_TRACES + trace]
+extern const poi_mode_golden_t poi_mode_golden[poi_modes::COUNT * POI_MODE_BENCH_TRACES];
+
+// For tools that replay the traces: trace t's name, and its input for frame f
+// into in. *rng carries the random bits from frame to frame; start it at
+// POI_MODE_BENCH_SEED with f = 0.
+const char *poi_mode_bench_trace_name(int t);
+void poi_mode_bench_input(int t, int f, poi_modes::input *in, uint32_t *rng);
+
+// Runs the bench, blocking for a few seconds; after poi_modes::init()
+void poi_mode_bench_run(void);
+
+// Runs the golden check, blocking for several seconds; after poi_modes::init(). Returns the pairs that differ.
+int poi_mode_golden_check(void);
+
+#endif // POI_MODE_BENCH_H
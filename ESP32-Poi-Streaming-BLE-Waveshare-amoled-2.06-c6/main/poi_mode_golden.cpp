@@ -0,0 +1,100 @@
+#include "poi_mode_bench.h"
+
+// What every mode rendered on the bench traces when its look was last signed
+// off (see poi_mode_golden_check()). Rows are the MODEGOLDEN_ROW lines the
+// check prints, in mode then trace order; replace a row only when its mode
+// is meant to look different.
+const poi_mode_golden_t poi_mode_golden[poi_modes::COUNT * POI_MODE_BENCH_TRACES] = {
+    { 0x2ee90f79, { { 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 } } }, // 0 Gravity Rainbow, slow_swing
+    { 0xb60ed925, { { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 } } }, // 0 Gravity Rainbow, fast_spin
+    { 0xedfebcbd, { { 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0 }, { 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0 }, { 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0 }, { 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0 } } }, // 0 Gravity Rainbow, silence
+    { 0x2ee90f79, { { 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7, 0x48, 0x00, 0xb7 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 }, { 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4, 0x4b, 0x00, 0xb4 } } }, // 0 Gravity Rainbow, loud_music
+    { 0xfbd9b8f9, { { 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00 }, { 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00 }, { 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00 }, { 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00 } } }, // 1 Spin Fire, slow_swing
+    { 0xb194cb55, { { 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00 }, { 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00 }, { 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00 }, { 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00, 0xff, 0x55, 0x00 } } }, // 1 Spin Fire, fast_spin
+    { 0xec07662d, { { 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00 }, { 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00 }, { 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00 }, { 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00, 0x28, 0x0d, 0x00 } } }, // 1 Spin Fire, silence
+    { 0xfbd9b8f9, { { 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00 }, { 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00 }, { 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00 }, { 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00, 0x71, 0x25, 0x00 } } }, // 1 Spin Fire, loud_music
+    { 0x1df5873d, { { 0x00, 0xe1, 0x1e, 0x00, 0xcf, 0x30, 0x00, 0xbd, 0x42, 0x00, 0xab, 0x54, 0x00, 0x99, 0x66, 0x00, 0x87, 0x78, 0x00, 0x75, 0x8a, 0x00, 0x63, 0x9c, 0x00, 0x51, 0xae, 0x00, 0x3f, 0xc0, 0x00, 0x2d, 0xd2, 0x00, 0x1b, 0xe4, 0x00, 0x09, 0xf6, 0x09, 0x00, 0xf6, 0x1b, 0x00, 0xe4, 0x2d, 0x00, 0xd2, 0x3f, 0x00, 0xc0, 0x51, 0x00, 0xae, 0x63, 0x00, 0x9c, 0x75, 0x00, 0x8a, 0x87, 0x00, 0x78 }, { 0x3f, 0x00, 0xc0, 0x51, 0x00, 0xae, 0x63, 0x00, 0x9c, 0x75, 0x00, 0x8a, 0x87, 0x00, 0x78, 0x99, 0x00, 0x66, 0xab, 0x00, 0x54, 0xbd, 0x00, 0x42, 0xcf, 0x00, 0x30, 0xe1, 0x00, 0x1e, 0xf3, 0x00, 0x0c, 0xfc, 0x03, 0x00, 0xea, 0x15, 0x00, 0xd8, 0x27, 0x00, 0xc6, 0x39, 0x00, 0xb4, 0x4b, 0x00, 0xa2, 0x5d, 0x00, 0x90, 0x6f, 0x00, 0x7e, 0x81, 0x00, 0x6c, 0x93, 0x00, 0x5a, 0xa5, 0x00 }, { 0x9f, 0x60, 0x00, 0x8d, 0x72, 0x00, 0x7b, 0x84, 0x00, 0x69, 0x96, 0x00, 0x57, 0xa8, 0x00, 0x45, 0xba, 0x00, 0x33, 0xcc, 0x00, 0x21, 0xde, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xfc, 0x03, 0x00, 0xea, 0x15, 0x00, 0xd8, 0x27, 0x00, 0xc6, 0x39, 0x00, 0xb4, 0x4b, 0x00, 0xa2, 0x5d, 0x00, 0x90, 0x6f, 0x00, 0x7e, 0x81, 0x00, 0x6c, 0x93, 0x00, 0x5a, 0xa5, 0x00, 0x48, 0xb7, 0x00, 0x36, 0xc9 }, { 0x00, 0x7e, 0x81, 0x00, 0x6c, 0x93, 0x00, 0x5a, 0xa5, 0x00, 0x48, 0xb7, 0x00, 0x36, 0xc9, 0x00, 0x24, 0xdb, 0x00, 0x12, 0xed, 0x00, 0x00, 0xff, 0x12, 0x00, 0xed, 0x24, 0x00, 0xdb, 0x36, 0x00, 0xc9, 0x48, 0x00, 0xb7, 0x5a, 0x00, 0xa5, 0x6c, 0x00, 0x93, 0x7e, 0x00, 0x81, 0x90, 0x00, 0x6f, 0xa2, 0x00, 0x5d, 0xb4, 0x00, 0x4b, 0xc6, 0x00, 0x39, 0xd8, 0x00, 0x27, 0xea, 0x00, 0x15 } } }, // 2 Centrifugal Rain, slow_swing
+    { 0x7a1572c9, { { 0x75, 0x00, 0x8a, 0x87, 0x00, 0x78, 0x99, 0x00, 0x66, 0xab, 0x00, 0x54, 0xbd, 0x00, 0x42, 0xcf, 0x00, 0x30, 0xe1, 0x00, 0x1e, 0xf3, 0x00, 0x0c, 0xfc, 0x03, 0x00, 0xea, 0x15, 0x00, 0xd8, 0x27, 0x00, 0xc6, 0x39, 0x00, 0xb4, 0x4b, 0x00, 0xa2, 0x5d, 0x00, 0x90, 0x6f, 0x00, 0x7e, 0x81, 0x00, 0x6c, 0x93, 0x00, 0x5a, 0xa5, 0x00, 0x48, 0xb7, 0x00, 0x36, 0xc9, 0x00, 0x24, 0xdb, 0x00 }, { 0x00, 0x12, 0xed, 0x00, 0x00, 0xff, 0x12, 0x00, 0xed, 0x24, 0x00, 0xdb, 0x36, 0x00, 0xc9, 0x48, 0x00, 0xb7, 0x5a, 0x00, 0xa5, 0x6c, 0x00, 0x93, 0x7e, 0x00, 0x81, 0x90, 0x00, 0x6f, 0xa2, 0x00, 0x5d, 0xb4, 0x00, 0x4b, 0xc6, 0x00, 0x39, 0xd8, 0x00, 0x27, 0xea, 0x00, 0x15, 0xfc, 0x00, 0x03, 0xf3, 0x0c, 0x00, 0xe1, 0x1e, 0x00, 0xcf, 0x30, 0x00, 0xbd, 0x42, 0x00, 0xab, 0x54, 0x00 }, { 0x00, 0x99, 0x66, 0x00, 0x87, 0x78, 0x00, 0x75, 0x8a, 0x00, 0x63, 0x9c, 0x00, 0x51, 0xae, 0x00, 0x3f, 0xc0, 0x00, 0x2d, 0xd2, 0x00, 0x1b, 0xe4, 0x00, 0x09, 0xf6, 0x09, 0x00, 0xf6, 0x1b, 0x00, 0xe4, 0x2d, 0x00, 0xd2, 0x3f, 0x00, 0xc0, 0x51, 0x00, 0xae, 0x63, 0x00, 0x9c, 0x75, 0x00, 0x8a, 0x87, 0x00, 0x78, 0x99, 0x00, 0x66, 0xab, 0x00, 0x54, 0xbd, 0x00, 0x42, 0xcf, 0x00, 0x30 }, { 0x21, 0xde, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xfc, 0x03, 0x00, 0xea, 0x15, 0x00, 0xd8, 0x27, 0x00, 0xc6, 0x39, 0x00, 0xb4, 0x4b, 0x00, 0xa2, 0x5d, 0x00, 0x90, 0x6f, 0x00, 0x7e, 0x81, 0x00, 0x6c, 0x93, 0x00, 0x5a, 0xa5, 0x00, 0x48, 0xb7, 0x00, 0x36, 0xc9, 0x00, 0x24, 0xdb, 0x00, 0x12, 0xed, 0x00, 0x00, 0xff, 0x12, 0x00, 0xed, 0x24, 0x00, 0xdb, 0x36, 0x00, 0xc9, 0x48, 0x00, 0xb7 } } }, // 2 Centrifugal Rain, fast_spin
+    { 0x32a1238d, { { 0xff, 0x00, 0x00, 0xed, 0x12, 0x00, 0xdb, 0x24, 0x00, 0xc9, 0x36, 0x00, 0xb7, 0x48, 0x00, 0xa5, 0x5a, 0x00, 0x93, 0x6c, 0x00, 0x81, 0x7e, 0x00, 0x6f, 0x90, 0x00, 0x5d, 0xa2, 0x00, 0x4b, 0xb4, 0x00, 0x39, 0xc6, 0x00, 0x27, 0xd8, 0x00, 0x15, 0xea, 0x00, 0x03, 0xfc, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0xde, 0x21, 0x00, 0xcc, 0x33, 0x00, 0xba, 0x45, 0x00, 0xa8, 0x57, 0x00, 0x96, 0x69 }, { 0xff, 0x00, 0x00, 0xed, 0x12, 0x00, 0xdb, 0x24, 0x00, 0xc9, 0x36, 0x00, 0xb7, 0x48, 0x00, 0xa5, 0x5a, 0x00, 0x93, 0x6c, 0x00, 0x81, 0x7e, 0x00, 0x6f, 0x90, 0x00, 0x5d, 0xa2, 0x00, 0x4b, 0xb4, 0x00, 0x39, 0xc6, 0x00, 0x27, 0xd8, 0x00, 0x15, 0xea, 0x00, 0x03, 0xfc, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0xde, 0x21, 0x00, 0xcc, 0x33, 0x00, 0xba, 0x45, 0x00, 0xa8, 0x57, 0x00, 0x96, 0x69 }, { 0xff, 0x00, 0x00, 0xed, 0x12, 0x00, 0xdb, 0x24, 0x00, 0xc9, 0x36, 0x00, 0xb7, 0x48, 0x00, 0xa5, 0x5a, 0x00, 0x93, 0x6c, 0x00, 0x81, 0x7e, 0x00, 0x6f, 0x90, 0x00, 0x5d, 0xa2, 0x00, 0x4b, 0xb4, 0x00, 0x39, 0xc6, 0x00, 0x27, 0xd8, 0x00, 0x15, 0xea, 0x00, 0x03, 0xfc, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0xde, 0x21, 0x00, 0xcc, 0x33, 0x00, 0xba, 0x45, 0x00, 0xa8, 0x57, 0x00, 0x96, 0x69 }, { 0xff, 0x00, 0x00, 0xed, 0x12, 0x00, 0xdb, 0x24, 0x00, 0xc9, 0x36, 0x00, 0xb7, 0x48, 0x00, 0xa5, 0x5a, 0x00, 0x93, 0x6c, 0x00, 0x81, 0x7e, 0x00, 0x6f, 0x90, 0x00, 0x5d, 0xa2, 0x00, 0x4b, 0xb4, 0x00, 0x39, 0xc6, 0x00, 0x27, 0xd8, 0x00, 0x15, 0xea, 0x00, 0x03, 0xfc, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0xde, 0x21, 0x00, 0xcc, 0x33, 0x00, 0xba, 0x45, 0x00, 0xa8, 0x57, 0x00, 0x96, 0x69 } } }, // 2 Centrifugal Rain, silence
+    { 0x1df5873d, { { 0x00, 0xe1, 0x1e, 0x00, 0xcf, 0x30, 0x00, 0xbd, 0x42, 0x00, 0xab, 0x54, 0x00, 0x99, 0x66, 0x00, 0x87, 0x78, 0x00, 0x75, 0x8a, 0x00, 0x63, 0x9c, 0x00, 0x51, 0xae, 0x00, 0x3f, 0xc0, 0x00, 0x2d, 0xd2, 0x00, 0x1b, 0xe4, 0x00, 0x09, 0xf6, 0x09, 0x00, 0xf6, 0x1b, 0x00, 0xe4, 0x2d, 0x00, 0xd2, 0x3f, 0x00, 0xc0, 0x51, 0x00, 0xae, 0x63, 0x00, 0x9c, 0x75, 0x00, 0x8a, 0x87, 0x00, 0x78 }, { 0x3f, 0x00, 0xc0, 0x51, 0x00, 0xae, 0x63, 0x00, 0x9c, 0x75, 0x00, 0x8a, 0x87, 0x00, 0x78, 0x99, 0x00, 0x66, 0xab, 0x00, 0x54, 0xbd, 0x00, 0x42, 0xcf, 0x00, 0x30, 0xe1, 0x00, 0x1e, 0xf3, 0x00, 0x0c, 0xfc, 0x03, 0x00, 0xea, 0x15, 0x00, 0xd8, 0x27, 0x00, 0xc6, 0x39, 0x00, 0xb4, 0x4b, 0x00, 0xa2, 0x5d, 0x00, 0x90, 0x6f, 0x00, 0x7e, 0x81, 0x00, 0x6c, 0x93, 0x00, 0x5a, 0xa5, 0x00 }, { 0x9f, 0x60, 0x00, 0x8d, 0x72, 0x00, 0x7b, 0x84, 0x00, 0x69, 0x96, 0x00, 0x57, 0xa8, 0x00, 0x45, 0xba, 0x00, 0x33, 0xcc, 0x00, 0x21, 0xde, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xfc, 0x03, 0x00, 0xea, 0x15, 0x00, 0xd8, 0x27, 0x00, 0xc6, 0x39, 0x00, 0xb4, 0x4b, 0x00, 0xa2, 0x5d, 0x00, 0x90, 0x6f, 0x00, 0x7e, 0x81, 0x00, 0x6c, 0x93, 0x00, 0x5a, 0xa5, 0x00, 0x48, 0xb7, 0x00, 0x36, 0xc9 }, { 0x00, 0x7e, 0x81, 0x00, 0x6c, 0x93, 0x00, 0x5a, 0xa5, 0x00, 0x48, 0xb7, 0x00, 0x36, 0xc9, 0x00, 0x24, 0xdb, 0x00, 0x12, 0xed, 0x00, 0x00, 0xff, 0x12, 0x00, 0xed, 0x24, 0x00, 0xdb, 0x36, 0x00, 0xc9, 0x48, 0x00, 0xb7, 0x5a, 0x00, 0xa5, 0x6c, 0x00, 0x93, 0x7e, 0x00, 0x81, 0x90, 0x00, 0x6f, 0xa2, 0x00, 0x5d, 0xb4, 0x00, 0x4b, 0xc6, 0x00, 0x39, 0xd8, 0x00, 0x27, 0xea, 0x00, 0x15 } } }, // 2 Centrifugal Rain, loud_music
+    { 0xab8f9875, { { 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49 }, { 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49 }, { 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49 }, { 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49 } } }, // 3 Flow Trail, slow_swing
+    { 0x6c137945, { { 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff }, { 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff }, { 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff }, { 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff, 0x00, 0xff, 0xff } } }, // 3 Flow Trail, fast_spin
+    { 0xdb9f0ca5, { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } } }, // 3 Flow Trail, silence
+    { 0xab8f9875, { { 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49 }, { 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49 }, { 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49 }, { 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49, 0x00, 0x49, 0x49 } } }, // 3 Flow Trail, loud_music
+    { 0xe2495765, { { 0x48, 0x00, 0xb7, 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 } } }, // 4 Gravity Compass, slow_swing
+    { 0x423a6e85, { { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 } } }, // 4 Gravity Compass, fast_spin
+    { 0x89f2747d, { { 0x3f, 0x00, 0xc0, 0x42, 0x00, 0xbd, 0x45, 0x00, 0xba, 0x48, 0x00, 0xb7, 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84 }, { 0x3f, 0x00, 0xc0, 0x42, 0x00, 0xbd, 0x45, 0x00, 0xba, 0x48, 0x00, 0xb7, 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84 }, { 0x3f, 0x00, 0xc0, 0x42, 0x00, 0xbd, 0x45, 0x00, 0xba, 0x48, 0x00, 0xb7, 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84 }, { 0x3f, 0x00, 0xc0, 0x42, 0x00, 0xbd, 0x45, 0x00, 0xba, 0x48, 0x00, 0xb7, 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84 } } }, // 4 Gravity Compass, silence
+    { 0xe2495765, { { 0x48, 0x00, 0xb7, 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 }, { 0x4b, 0x00, 0xb4, 0x4e, 0x00, 0xb1, 0x51, 0x00, 0xae, 0x54, 0x00, 0xab, 0x57, 0x00, 0xa8, 0x5a, 0x00, 0xa5, 0x5d, 0x00, 0xa2, 0x60, 0x00, 0x9f, 0x63, 0x00, 0x9c, 0x66, 0x00, 0x99, 0x69, 0x00, 0x96, 0x6c, 0x00, 0x93, 0x6f, 0x00, 0x90, 0x72, 0x00, 0x8d, 0x75, 0x00, 0x8a, 0x78, 0x00, 0x87, 0x7b, 0x00, 0x84, 0x7e, 0x00, 0x81, 0x81, 0x00, 0x7e, 0x84, 0x00, 0x7b, 0x87, 0x00, 0x78 } } }, // 4 Gravity Compass, loud_music
+    { 0x43d57947, { { 0x00, 0x7c, 0x1a, 0x00, 0x79, 0x1e, 0x00, 0x73, 0x23, 0x00, 0x70, 0x27, 0x00, 0x6a, 0x2c, 0x00, 0x67, 0x30, 0x00, 0x61, 0x35, 0x00, 0x5e, 0x39, 0x00, 0x59, 0x3e, 0x00, 0x55, 0x41, 0x00, 0x50, 0x47, 0x00, 0x4c, 0x4a, 0x00, 0x47, 0x50, 0x00, 0x43, 0x53, 0x00, 0x3e, 0x59, 0x00, 0x3a, 0x5c, 0x00, 0x35, 0x61, 0x00, 0x31, 0x65, 0x00, 0x2c, 0x6a, 0x00, 0x28, 0x6e, 0x00, 0x23, 0x73 }, { 0x30, 0x00, 0x67, 0x35, 0x00, 0x61, 0x38, 0x00, 0x5e, 0x3e, 0x00, 0x59, 0x41, 0x00, 0x55, 0x47, 0x00, 0x50, 0x4a, 0x00, 0x4c, 0x50, 0x00, 0x47, 0x53, 0x00, 0x43, 0x59, 0x00, 0x3e, 0x5c, 0x00, 0x3a, 0x61, 0x00, 0x35, 0x65, 0x00, 0x31, 0x6a, 0x00, 0x2c, 0x6e, 0x00, 0x28, 0x73, 0x00, 0x23, 0x77, 0x00, 0x20, 0x7c, 0x00, 0x1a, 0x80, 0x00, 0x17, 0x85, 0x00, 0x11, 0x89, 0x00, 0x0e }, { 0x50, 0x47, 0x00, 0x4a, 0x4c, 0x00, 0x47, 0x50, 0x00, 0x41, 0x55, 0x00, 0x3e, 0x59, 0x00, 0x38, 0x5e, 0x00, 0x35, 0x61, 0x00, 0x30, 0x67, 0x00, 0x2c, 0x6a, 0x00, 0x27, 0x70, 0x00, 0x23, 0x73, 0x00, 0x1e, 0x79, 0x00, 0x1a, 0x7c, 0x00, 0x15, 0x81, 0x00, 0x11, 0x85, 0x00, 0x0c, 0x8a, 0x00, 0x08, 0x8e, 0x00, 0x03, 0x93, 0x00, 0x00, 0x97, 0x00, 0x00, 0x92, 0x05, 0x00, 0x8e, 0x08 }, { 0x00, 0x38, 0x5e, 0x00, 0x33, 0x63, 0x00, 0x30, 0x67, 0x00, 0x2a, 0x6c, 0x00, 0x27, 0x70, 0x00, 0x21, 0x75, 0x00, 0x1e, 0x79, 0x00, 0x18, 0x7e, 0x00, 0x15, 0x81, 0x00, 0x10, 0x87, 0x00, 0x0c, 0x8a, 0x00, 0x07, 0x90, 0x00, 0x03, 0x93, 0x01, 0x00, 0x95, 0x05, 0x00, 0x91, 0x0a, 0x00, 0x8c, 0x0e, 0x00, 0x89, 0x13, 0x00, 0x83, 0x17, 0x00, 0x80, 0x1c, 0x00, 0x7a, 0x20, 0x00, 0x77 } } }, // 5 Velocity Prism, slow_swing
+    { 0xa0932579, { { 0x00, 0x00, 0xff, 0x09, 0x00, 0xf6, 0x0f, 0x00, 0xf0, 0x18, 0x00, 0xe7, 0x1e, 0x00, 0xe1, 0x27, 0x00, 0xd8, 0x2d, 0x00, 0xd2, 0x36, 0x00, 0xc9, 0x3c, 0x00, 0xc3, 0x45, 0x00, 0xba, 0x4b, 0x00, 0xb4, 0x54, 0x00, 0xab, 0x5a, 0x00, 0xa5, 0x63, 0x00, 0x9c, 0x69, 0x00, 0x96, 0x72, 0x00, 0x8d, 0x78, 0x00, 0x87, 0x81, 0x00, 0x7e, 0x87, 0x00, 0x78, 0x90, 0x00, 0x6f, 0x96, 0x00, 0x69 }, { 0x2d, 0xd2, 0x00, 0x24, 0xdb, 0x00, 0x1e, 0xe1, 0x00, 0x15, 0xea, 0x00, 0x0f, 0xf0, 0x00, 0x06, 0xf9, 0x00, 0x00, 0xff, 0x00, 0x00, 0xf6, 0x09, 0x00, 0xf0, 0x0f, 0x00, 0xe7, 0x18, 0x00, 0xe1, 0x1e, 0x00, 0xd8, 0x27, 0x00, 0xd2, 0x2d, 0x00, 0xc9, 0x36, 0x00, 0xc3, 0x3c, 0x00, 0xba, 0x45, 0x00, 0xb4, 0x4b, 0x00, 0xab, 0x54, 0x00, 0xa5, 0x5a, 0x00, 0x9c, 0x63, 0x00, 0x96, 0x69 }, { 0xa5, 0x00, 0x5a, 0xae, 0x00, 0x51, 0xb4, 0x00, 0x4b, 0xbd, 0x00, 0x42, 0xc3, 0x00, 0x3c, 0xcc, 0x00, 0x33, 0xd2, 0x00, 0x2d, 0xdb, 0x00, 0x24, 0xe1, 0x00, 0x1e, 0xea, 0x00, 0x15, 0xf0, 0x00, 0x0f, 0xf9, 0x00, 0x06, 0xff, 0x00, 0x00, 0xf6, 0x09, 0x00, 0xf0, 0x0f, 0x00, 0xe7, 0x18, 0x00, 0xe1, 0x1e, 0x00, 0xd8, 0x27, 0x00, 0xd2, 0x2d, 0x00, 0xc9, 0x36, 0x00, 0xc3, 0x3c, 0x00 }, { 0x00, 0x87, 0x78, 0x00, 0x7e, 0x81, 0x00, 0x78, 0x87, 0x00, 0x6f, 0x90, 0x00, 0x69, 0x96, 0x00, 0x60, 0x9f, 0x00, 0x5a, 0xa5, 0x00, 0x51, 0xae, 0x00, 0x4b, 0xb4, 0x00, 0x42, 0xbd, 0x00, 0x3c, 0xc3, 0x00, 0x33, 0xcc, 0x00, 0x2d, 0xd2, 0x00, 0x24, 0xdb, 0x00, 0x1e, 0xe1, 0x00, 0x15, 0xea, 0x00, 0x0f, 0xf0, 0x00, 0x06, 0xf9, 0x00, 0x00, 0xff, 0x09, 0x00, 0xf6, 0x0f, 0x00, 0xf0 } } }, // 5 Velocity Prism, fast_spin
+    { 0xc756d0da, { { 0x2b, 0x3a, 0x00, 0x27, 0x3e, 0x00, 0x25, 0x40, 0x00, 0x21, 0x44, 0x00, 0x1f, 0x46, 0x00, 0x1b, 0x4a, 0x00, 0x19, 0x4c, 0x00, 0x15, 0x50, 0x00, 0x13, 0x52, 0x00, 0x0f, 0x56, 0x00, 0x0d, 0x58, 0x00, 0x09, 0x5c, 0x00, 0x07, 0x5e, 0x00, 0x03, 0x62, 0x00, 0x01, 0x64, 0x00, 0x00, 0x63, 0x02, 0x00, 0x61, 0x04, 0x00, 0x5d, 0x08, 0x00, 0x5b, 0x0a, 0x00, 0x57, 0x0e, 0x00, 0x55, 0x10 }, { 0x00, 0x55, 0x10, 0x00, 0x51, 0x14, 0x00, 0x4f, 0x16, 0x00, 0x4b, 0x1a, 0x00, 0x49, 0x1c, 0x00, 0x45, 0x20, 0x00, 0x43, 0x22, 0x00, 0x3f, 0x26, 0x00, 0x3d, 0x28, 0x00, 0x39, 0x2c, 0x00, 0x37, 0x2e, 0x00, 0x33, 0x32, 0x00, 0x31, 0x34, 0x00, 0x2d, 0x38, 0x00, 0x2b, 0x3a, 0x00, 0x27, 0x3e, 0x00, 0x25, 0x40, 0x00, 0x21, 0x44, 0x00, 0x1f, 0x46, 0x00, 0x1b, 0x4a, 0x00, 0x19, 0x4c }, { 0x00, 0x19, 0x4c, 0x00, 0x15, 0x50, 0x00, 0x13, 0x52, 0x00, 0x0f, 0x56, 0x00, 0x0d, 0x58, 0x00, 0x09, 0x5c, 0x00, 0x07, 0x5e, 0x00, 0x03, 0x62, 0x00, 0x01, 0x64, 0x02, 0x00, 0x63, 0x04, 0x00, 0x61, 0x08, 0x00, 0x5d, 0x0a, 0x00, 0x5b, 0x0e, 0x00, 0x57, 0x10, 0x00, 0x55, 0x14, 0x00, 0x51, 0x16, 0x00, 0x4f, 0x1a, 0x00, 0x4b, 0x1c, 0x00, 0x49, 0x20, 0x00, 0x45, 0x22, 0x00, 0x43 }, { 0x22, 0x00, 0x43, 0x26, 0x00, 0x3f, 0x28, 0x00, 0x3d, 0x2c, 0x00, 0x39, 0x2e, 0x00, 0x37, 0x32, 0x00, 0x33, 0x34, 0x00, 0x31, 0x38, 0x00, 0x2d, 0x3a, 0x00, 0x2b, 0x3e, 0x00, 0x27, 0x40, 0x00, 0x25, 0x44, 0x00, 0x21, 0x46, 0x00, 0x1f, 0x4a, 0x00, 0x1b, 0x4c, 0x00, 0x19, 0x50, 0x00, 0x15, 0x52, 0x00, 0x13, 0x56, 0x00, 0x0f, 0x58, 0x00, 0x0d, 0x5c, 0x00, 0x09, 0x5e, 0x00, 0x07 } } }, // 5 Velocity Prism, silence
+    { 0x43d57947, { { 0x00, 0x7c, 0x1a, 0x00, 0x79, 0x1e, 0x00, 0x73, 0x23, 0x00, 0x70, 0x27, 0x00, 0x6a, 0x2c, 0x00, 0x67, 0x30, 0x00, 0x61, 0x35, 0x00, 0x5e, 0x39, 0x00, 0x59, 0x3e, 0x00, 0x55, 0x41, 0x00, 0x50, 0x47, 0x00, 0x4c, 0x4a, 0x00, 0x47, 0x50, 0x00, 0x43, 0x53, 0x00, 0x3e, 0x59, 0x00, 0x3a, 0x5c, 0x00, 0x35, 0x61, 0x00, 0x31, 0x65, 0x00, 0x2c, 0x6a, 0x00, 0x28, 0x6e, 0x00, 0x23, 0x73 }, { 0x30, 0x00, 0x67, 0x35, 0x00, 0x61, 0x38, 0x00, 0x5e, 0x3e, 0x00, 0x59, 0x41, 0x00, 0x55, 0x47, 0x00, 0x50, 0x4a, 0x00, 0x4c, 0x50, 0x00, 0x47, 0x53, 0x00, 0x43, 0x59, 0x00, 0x3e, 0x5c, 0x00, 0x3a, 0x61, 0x00, 0x35, 0x65, 0x00, 0x31, 0x6a, 0x00, 0x2c, 0x6e, 0x00, 0x28, 0x73, 0x00, 0x23, 0x77, 0x00, 0x20, 0x7c, 0x00, 0x1a, 0x80, 0x00, 0x17, 0x85, 0x00, 0x11, 0x89, 0x00, 0x0e }, { 0x50, 0x47, 0x00, 0x4a, 0x4c, 0x00, 0x47, 0x50, 0x00, 0x41, 0x55, 0x00, 0x3e, 0x59, 0x00, 0x38, 0x5e, 0x00, 0x35, 0x61, 0x00, 0x30, 0x67, 0x00, 0x2c, 0x6a, 0x00, 0x27, 0x70, 0x00, 0x23, 0x73, 0x00, 0x1e, 0x79, 0x00, 0x1a, 0x7c, 0x00, 0x15, 0x81, 0x00, 0x11, 0x85, 0x00, 0x0c, 0x8a, 0x00, 0x08, 0x8e, 0x00, 0x03, 0x93, 0x00, 0x00, 0x97, 0x00, 0x00, 0x92, 0x05, 0x00, 0x8e, 0x08 }, { 0x00, 0x38, 0x5e, 0x00, 0x33, 0x63, 0x00, 0x30, 0x67, 0x00, 0x2a, 0x6c, 0x00, 0x27, 0x70, 0x00, 0x21, 0x75, 0x00, 0x1e, 0x79, 0x00, 0x18, 0x7e, 0x00, 0x15, 0x81, 0x00, 0x10, 0x87, 0x00, 0x0c, 0x8a, 0x00, 0x07, 0x90, 0x00, 0x03, 0x93, 0x01, 0x00, 0x95, 0x05, 0x00, 0x91, 0x0a, 0x00, 0x8c, 0x0e, 0x00, 0x89, 0x13, 0x00, 0x83, 0x17, 0x00, 0x80, 0x1c, 0x00, 0x7a, 0x20, 0x00, 0x77 } } }, // 5 Velocity Prism, loud_music
+    { 0x816494eb, { { 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b }, { 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b }, { 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b }, { 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a } } }, // 6 Warp Speed, slow_swing
+    { 0x9d83688d, { { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }, { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff } } }, // 6 Warp Speed, fast_spin
+    { 0xdb9f0ca5, { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } } }, // 6 Warp Speed, silence
+    { 0x816494eb, { { 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b }, { 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b }, { 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b }, { 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a, 0x3a } } }, // 6 Warp Speed, loud_music
+    { 0xed2e1503, { { 0x42, 0x30, 0x01, 0x37, 0x2a, 0x12, 0x24, 0x22, 0x2d, 0x10, 0x1d, 0x47, 0x01, 0x1d, 0x55, 0x01, 0x1e, 0x55, 0x0e, 0x1e, 0x48, 0x22, 0x22, 0x30, 0x33, 0x2b, 0x15, 0x36, 0x3b, 0x02, 0x2b, 0x47, 0x01, 0x1c, 0x44, 0x13, 0x18, 0x33, 0x2a, 0x23, 0x18, 0x39, 0x38, 0x02, 0x39, 0x44, 0x01, 0x2e, 0x3f, 0x10, 0x24, 0x2b, 0x26, 0x22, 0x13, 0x3a, 0x27, 0x02, 0x47, 0x2b, 0x01, 0x48, 0x2a }, { 0x3a, 0x26, 0x14, 0x40, 0x31, 0x03, 0x36, 0x3d, 0x01, 0x23, 0x3d, 0x13, 0x18, 0x2f, 0x2d, 0x1d, 0x17, 0x3f, 0x2e, 0x03, 0x42, 0x3a, 0x01, 0x39, 0x38, 0x11, 0x2b, 0x28, 0x2a, 0x22, 0x12, 0x40, 0x21, 0x02, 0x4f, 0x22, 0x00, 0x51, 0x22, 0x0e, 0x45, 0x20, 0x24, 0x2e, 0x22, 0x39, 0x14, 0x26, 0x45, 0x03, 0x2c, 0x46, 0x01, 0x2d, 0x3b, 0x10, 0x28, 0x28, 0x29, 0x22, 0x12, 0x3f, 0x22 }, { 0x30, 0x12, 0x31, 0x24, 0x2d, 0x24, 0x11, 0x47, 0x1c, 0x02, 0x58, 0x19, 0x00, 0x5b, 0x18, 0x0c, 0x4d, 0x1b, 0x1e, 0x35, 0x21, 0x30, 0x18, 0x2b, 0x3b, 0x03, 0x35, 0x3d, 0x00, 0x36, 0x34, 0x11, 0x2f, 0x24, 0x2c, 0x23, 0x11, 0x46, 0x1d, 0x03, 0x4f, 0x22, 0x00, 0x47, 0x2d, 0x12, 0x30, 0x31, 0x33, 0x19, 0x27, 0x4b, 0x14, 0x14, 0x52, 0x1e, 0x03, 0x49, 0x2a, 0x01, 0x36, 0x2b, 0x13 }, { 0x33, 0x05, 0x3c, 0x33, 0x00, 0x40, 0x2d, 0x11, 0x35, 0x20, 0x2f, 0x25, 0x10, 0x4c, 0x18, 0x03, 0x58, 0x19, 0x00, 0x50, 0x23, 0x0f, 0x39, 0x2b, 0x30, 0x1e, 0x25, 0x51, 0x10, 0x13, 0x5c, 0x14, 0x03, 0x53, 0x20, 0x00, 0x3e, 0x24, 0x11, 0x26, 0x1b, 0x33, 0x14, 0x0d, 0x52, 0x0a, 0x02, 0x68, 0x08, 0x00, 0x6b, 0x0f, 0x08, 0x5c, 0x1e, 0x17, 0x3f, 0x33, 0x23, 0x1d, 0x42, 0x2c, 0x05 } } }, // 7 Plasma Ghost, slow_swing
+    { 0x03d912f4, { { 0x7c, 0x5b, 0x03, 0x67, 0x50, 0x22, 0x45, 0x40, 0x54, 0x1e, 0x37, 0x84, 0x03, 0x36, 0xa0, 0x02, 0x38, 0x9f, 0x1b, 0x38, 0x87, 0x40, 0x3f, 0x5a, 0x60, 0x51, 0x28, 0x66, 0x6e, 0x05, 0x51, 0x85, 0x03, 0x35, 0x80, 0x24, 0x2c, 0x5f, 0x4e, 0x42, 0x2d, 0x6b, 0x69, 0x05, 0x6b, 0x80, 0x03, 0x56, 0x76, 0x1f, 0x45, 0x51, 0x48, 0x3f, 0x25, 0x6c, 0x49, 0x04, 0x84, 0x51, 0x02, 0x88, 0x4f }, { 0x6c, 0x47, 0x25, 0x77, 0x5d, 0x06, 0x65, 0x72, 0x02, 0x41, 0x73, 0x25, 0x2c, 0x58, 0x54, 0x37, 0x2c, 0x77, 0x57, 0x06, 0x7c, 0x6c, 0x02, 0x6b, 0x69, 0x20, 0x51, 0x4b, 0x4e, 0x40, 0x22, 0x78, 0x3e, 0x05, 0x95, 0x40, 0x01, 0x98, 0x40, 0x1a, 0x82, 0x3d, 0x44, 0x57, 0x3f, 0x6b, 0x26, 0x48, 0x81, 0x06, 0x53, 0x84, 0x02, 0x54, 0x6f, 0x1f, 0x4b, 0x4b, 0x4d, 0x40, 0x23, 0x77, 0x40 }, { 0x5b, 0x21, 0x5d, 0x43, 0x54, 0x43, 0x1f, 0x84, 0x35, 0x05, 0xa5, 0x2f, 0x01, 0xaa, 0x2e, 0x16, 0x90, 0x32, 0x39, 0x63, 0x3e, 0x5b, 0x2d, 0x51, 0x6f, 0x06, 0x64, 0x72, 0x01, 0x65, 0x62, 0x20, 0x58, 0x44, 0x53, 0x42, 0x20, 0x83, 0x37, 0x06, 0x94, 0x40, 0x01, 0x84, 0x54, 0x21, 0x5b, 0x5d, 0x60, 0x30, 0x4a, 0x8c, 0x26, 0x26, 0x99, 0x39, 0x06, 0x89, 0x4e, 0x02, 0x65, 0x51, 0x24 }, { 0x5f, 0x09, 0x71, 0x60, 0x01, 0x77, 0x54, 0x21, 0x64, 0x3c, 0x58, 0x45, 0x1e, 0x8e, 0x2e, 0x06, 0xa4, 0x2f, 0x00, 0x97, 0x42, 0x1c, 0x6b, 0x51, 0x5a, 0x39, 0x46, 0x97, 0x1e, 0x24, 0xac, 0x26, 0x06, 0x9c, 0x3d, 0x01, 0x74, 0x44, 0x21, 0x47, 0x33, 0x5f, 0x26, 0x19, 0x99, 0x13, 0x04, 0xc3, 0x10, 0x00, 0xc9, 0x1d, 0x10, 0xad, 0x39, 0x2b, 0x76, 0x5f, 0x43, 0x38, 0x7d, 0x53, 0x09 } } }, // 7 Plasma Ghost, fast_spin
+    { 0x869825d9, { { 0x35, 0x27, 0x01, 0x2c, 0x22, 0x0e, 0x1d, 0x1b, 0x24, 0x0c, 0x17, 0x38, 0x01, 0x17, 0x44, 0x01, 0x18, 0x44, 0x0b, 0x18, 0x3a, 0x1b, 0x1b, 0x26, 0x29, 0x23, 0x11, 0x2c, 0x2f, 0x02, 0x22, 0x39, 0x01, 0x16, 0x37, 0x0f, 0x13, 0x29, 0x21, 0x1c, 0x13, 0x2d, 0x2d, 0x02, 0x2e, 0x37, 0x01, 0x24, 0x32, 0x0d, 0x1d, 0x23, 0x1f, 0x1b, 0x0f, 0x2e, 0x1f, 0x01, 0x38, 0x22, 0x01, 0x3a, 0x22 }, { 0x2e, 0x1e, 0x10, 0x33, 0x27, 0x02, 0x2b, 0x31, 0x01, 0x1c, 0x31, 0x0f, 0x13, 0x26, 0x24, 0x17, 0x12, 0x33, 0x25, 0x02, 0x35, 0x2e, 0x01, 0x2d, 0x2d, 0x0e, 0x22, 0x20, 0x21, 0x1b, 0x0e, 0x33, 0x1b, 0x02, 0x40, 0x1b, 0x00, 0x41, 0x1b, 0x0b, 0x37, 0x1a, 0x1d, 0x25, 0x1b, 0x2d, 0x10, 0x1f, 0x37, 0x02, 0x23, 0x38, 0x01, 0x24, 0x2f, 0x0d, 0x20, 0x20, 0x21, 0x1b, 0x0f, 0x33, 0x1b }, { 0x27, 0x0e, 0x27, 0x1c, 0x24, 0x1c, 0x0d, 0x38, 0x16, 0x02, 0x47, 0x14, 0x00, 0x49, 0x13, 0x09, 0x3e, 0x15, 0x18, 0x2a, 0x1a, 0x27, 0x13, 0x23, 0x2f, 0x02, 0x2a, 0x31, 0x00, 0x2b, 0x2a, 0x0e, 0x25, 0x1d, 0x23, 0x1c, 0x0e, 0x38, 0x17, 0x02, 0x3f, 0x1b, 0x00, 0x38, 0x24, 0x0e, 0x27, 0x27, 0x29, 0x14, 0x1f, 0x3c, 0x10, 0x10, 0x41, 0x18, 0x02, 0x3a, 0x21, 0x01, 0x2b, 0x22, 0x0f }, { 0x29, 0x04, 0x30, 0x29, 0x00, 0x33, 0x24, 0x0e, 0x2b, 0x19, 0x26, 0x1d, 0x0c, 0x3d, 0x13, 0x02, 0x46, 0x14, 0x00, 0x40, 0x1c, 0x0c, 0x2e, 0x23, 0x26, 0x18, 0x1e, 0x41, 0x0c, 0x0f, 0x49, 0x10, 0x02, 0x42, 0x1a, 0x00, 0x31, 0x1d, 0x0e, 0x1e, 0x16, 0x29, 0x10, 0x0b, 0x41, 0x08, 0x01, 0x53, 0x07, 0x00, 0x56, 0x0c, 0x07, 0x4a, 0x18, 0x12, 0x32, 0x29, 0x1c, 0x18, 0x35, 0x23, 0x04 } } }, // 7 Plasma Ghost, silence
+    { 0xed2e1503, { { 0x42, 0x30, 0x01, 0x37, 0x2a, 0x12, 0x24, 0x22, 0x2d, 0x10, 0x1d, 0x47, 0x01, 0x1d, 0x55, 0x01, 0x1e, 0x55, 0x0e, 0x1e, 0x48, 0x22, 0x22, 0x30, 0x33, 0x2b, 0x15, 0x36, 0x3b, 0x02, 0x2b, 0x47, 0x01, 0x1c, 0x44, 0x13, 0x18, 0x33, 0x2a, 0x23, 0x18, 0x39, 0x38, 0x02, 0x39, 0x44, 0x01, 0x2e, 0x3f, 0x10, 0x24, 0x2b, 0x26, 0x22, 0x13, 0x3a, 0x27, 0x02, 0x47, 0x2b, 0x01, 0x48, 0x2a }, { 0x3a, 0x26, 0x14, 0x40, 0x31, 0x03, 0x36, 0x3d, 0x01, 0x23, 0x3d, 0x13, 0x18, 0x2f, 0x2d, 0x1d, 0x17, 0x3f, 0x2e, 0x03, 0x42, 0x3a, 0x01, 0x39, 0x38, 0x11, 0x2b, 0x28, 0x2a, 0x22, 0x12, 0x40, 0x21, 0x02, 0x4f, 0x22, 0x00, 0x51, 0x22, 0x0e, 0x45, 0x20, 0x24, 0x2e, 0x22, 0x39, 0x14, 0x26, 0x45, 0x03, 0x2c, 0x46, 0x01, 0x2d, 0x3b, 0x10, 0x28, 0x28, 0x29, 0x22, 0x12, 0x3f, 0x22 }, { 0x30, 0x12, 0x31, 0x24, 0x2d, 0x24, 0x11, 0x47, 0x1c, 0x02, 0x58, 0x19, 0x00, 0x5b, 0x18, 0x0c, 0x4d, 0x1b, 0x1e, 0x35, 0x21, 0x30, 0x18, 0x2b, 0x3b, 0x03, 0x35, 0x3d, 0x00, 0x36, 0x34, 0x11, 0x2f, 0x24, 0x2c, 0x23, 0x11, 0x46, 0x1d, 0x03, 0x4f, 0x22, 0x00, 0x47, 0x2d, 0x12, 0x30, 0x31, 0x33, 0x19, 0x27, 0x4b, 0x14, 0x14, 0x52, 0x1e, 0x03, 0x49, 0x2a, 0x01, 0x36, 0x2b, 0x13 }, { 0x33, 0x05, 0x3c, 0x33, 0x00, 0x40, 0x2d, 0x11, 0x35, 0x20, 0x2f, 0x25, 0x10, 0x4c, 0x18, 0x03, 0x58, 0x19, 0x00, 0x50, 0x23, 0x0f, 0x39, 0x2b, 0x30, 0x1e, 0x25, 0x51, 0x10, 0x13, 0x5c, 0x14, 0x03, 0x53, 0x20, 0x00, 0x3e, 0x24, 0x11, 0x26, 0x1b, 0x33, 0x14, 0x0d, 0x52, 0x0a, 0x02, 0x68, 0x08, 0x00, 0x6b, 0x0f, 0x08, 0x5c, 0x1e, 0x17, 0x3f, 0x33, 0x23, 0x1d, 0x42, 0x2c, 0x05 } } }, // 7 Plasma Ghost, loud_music
+    { 0x060215cd, { { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 } } }, // 8 Fire/Ice Split, slow_swing
+    { 0x530fd91d, { { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 } } }, // 8 Fire/Ice Split, fast_spin
+    { 0xd2654665, { { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x3b, 0x11, 0xb1, 0x46, 0x25, 0x92, 0x52, 0x3c, 0x70 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x3b, 0x11, 0xb1, 0x46, 0x25, 0x92, 0x52, 0x3c, 0x70 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x3b, 0x11, 0xb1, 0x46, 0x25, 0x92, 0x52, 0x3c, 0x70 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x3b, 0x11, 0xb1, 0x46, 0x25, 0x92, 0x52, 0x3c, 0x70 } } }, // 8 Fire/Ice Split, silence
+    { 0x060215cd, { { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 }, { 0x96, 0x00, 0x69, 0x90, 0x00, 0x6f, 0x8a, 0x00, 0x75, 0x84, 0x00, 0x7b, 0x7e, 0x00, 0x81, 0x78, 0x00, 0x87, 0x72, 0x00, 0x8d, 0x6c, 0x00, 0x93, 0x66, 0x00, 0x99, 0x60, 0x00, 0x9f, 0x5a, 0x00, 0xa5, 0x54, 0x00, 0xab, 0x4e, 0x00, 0xb1, 0x48, 0x00, 0xb7, 0x42, 0x00, 0xbd, 0x3c, 0x00, 0xc3, 0x36, 0x00, 0xc9, 0x30, 0x00, 0xcf, 0x2a, 0x00, 0xd5, 0x24, 0x00, 0xdb, 0x1e, 0x00, 0xe1 } } }, // 8 Fire/Ice Split, loud_music
+    { 0x2c4adb51, { { 0x27, 0x0c, 0x00, 0x23, 0x0f, 0x00, 0x1f, 0x13, 0x00, 0x1c, 0x16, 0x00, 0x18, 0x1a, 0x00, 0x15, 0x1e, 0x00, 0x1f, 0x3c, 0x00, 0x23, 0x60, 0x00, 0x22, 0x8a, 0x00, 0x1b, 0xba, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x9f, 0x0e, 0x00, 0x70, 0x14, 0x00, 0x47, 0x14, 0x00, 0x24, 0x0f, 0x00, 0x20, 0x12, 0x00, 0x1c, 0x16, 0x00, 0x19, 0x19, 0x00, 0x15, 0x1d, 0x00, 0x12, 0x21 }, { 0x1b, 0x18, 0x00, 0x17, 0x1b, 0x00, 0x13, 0x1f, 0x00, 0x10, 0x22, 0x00, 0x0c, 0x26, 0x00, 0x09, 0x2a, 0x00, 0x09, 0x52, 0x00, 0x04, 0x7f, 0x00, 0x00, 0xa7, 0x06, 0x00, 0xbf, 0x16, 0x00, 0xd2, 0x2d, 0x00, 0xa1, 0x34, 0x00, 0x76, 0x37, 0x00, 0x51, 0x33, 0x00, 0x31, 0x2a, 0x00, 0x18, 0x1b, 0x00, 0x14, 0x1e, 0x00, 0x10, 0x22, 0x00, 0x0d, 0x25, 0x00, 0x09, 0x29, 0x00, 0x06, 0x2d }, { 0x0f, 0x24, 0x00, 0x0b, 0x27, 0x00, 0x07, 0x2b, 0x00, 0x04, 0x2e, 0x00, 0x00, 0x32, 0x00, 0x00, 0x30, 0x03, 0x00, 0x4f, 0x0b, 0x00, 0x6a, 0x1a, 0x00, 0x7e, 0x2e, 0x00, 0x8d, 0x49, 0x00, 0x96, 0x69, 0x00, 0x6e, 0x67, 0x00, 0x4d, 0x5f, 0x00, 0x31, 0x52, 0x00, 0x1c, 0x3f, 0x00, 0x0c, 0x27, 0x00, 0x08, 0x2a, 0x00, 0x04, 0x2e, 0x00, 0x01, 0x31, 0x02, 0x00, 0x30, 0x06, 0x00, 0x2d }, { 0x03, 0x30, 0x00, 0x00, 0x32, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x2b, 0x07, 0x00, 0x27, 0x0b, 0x00, 0x24, 0x0f, 0x00, 0x3a, 0x21, 0x00, 0x4a, 0x39, 0x00, 0x55, 0x57, 0x00, 0x5a, 0x7b, 0x00, 0x5a, 0xa5, 0x00, 0x3c, 0x99, 0x00, 0x24, 0x88, 0x00, 0x12, 0x71, 0x00, 0x06, 0x55, 0x00, 0x00, 0x33, 0x03, 0x00, 0x2f, 0x07, 0x00, 0x2b, 0x0a, 0x00, 0x28, 0x0e, 0x00, 0x24, 0x12, 0x00, 0x21 } } }, // 9 Shifting Horizon, slow_swing
+    { 0x2c4adb51, { { 0x27, 0x0c, 0x00, 0x23, 0x0f, 0x00, 0x1f, 0x13, 0x00, 0x1c, 0x16, 0x00, 0x18, 0x1a, 0x00, 0x15, 0x1e, 0x00, 0x1f, 0x3c, 0x00, 0x23, 0x60, 0x00, 0x22, 0x8a, 0x00, 0x1b, 0xba, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x9f, 0x0e, 0x00, 0x70, 0x14, 0x00, 0x47, 0x14, 0x00, 0x24, 0x0f, 0x00, 0x20, 0x12, 0x00, 0x1c, 0x16, 0x00, 0x19, 0x19, 0x00, 0x15, 0x1d, 0x00, 0x12, 0x21 }, { 0x1b, 0x18, 0x00, 0x17, 0x1b, 0x00, 0x13, 0x1f, 0x00, 0x10, 0x22, 0x00, 0x0c, 0x26, 0x00, 0x09, 0x2a, 0x00, 0x09, 0x52, 0x00, 0x04, 0x7f, 0x00, 0x00, 0xa7, 0x06, 0x00, 0xbf, 0x16, 0x00, 0xd2, 0x2d, 0x00, 0xa1, 0x34, 0x00, 0x76, 0x37, 0x00, 0x51, 0x33, 0x00, 0x31, 0x2a, 0x00, 0x18, 0x1b, 0x00, 0x14, 0x1e, 0x00, 0x10, 0x22, 0x00, 0x0d, 0x25, 0x00, 0x09, 0x29, 0x00, 0x06, 0x2d }, { 0x0f, 0x24, 0x00, 0x0b, 0x27, 0x00, 0x07, 0x2b, 0x00, 0x04, 0x2e, 0x00, 0x00, 0x32, 0x00, 0x00, 0x30, 0x03, 0x00, 0x4f, 0x0b, 0x00, 0x6a, 0x1a, 0x00, 0x7e, 0x2e, 0x00, 0x8d, 0x49, 0x00, 0x96, 0x69, 0x00, 0x6e, 0x67, 0x00, 0x4d, 0x5f, 0x00, 0x31, 0x52, 0x00, 0x1c, 0x3f, 0x00, 0x0c, 0x27, 0x00, 0x08, 0x2a, 0x00, 0x04, 0x2e, 0x00, 0x01, 0x31, 0x02, 0x00, 0x30, 0x06, 0x00, 0x2d }, { 0x03, 0x30, 0x00, 0x00, 0x32, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x2b, 0x07, 0x00, 0x27, 0x0b, 0x00, 0x24, 0x0f, 0x00, 0x3a, 0x21, 0x00, 0x4a, 0x39, 0x00, 0x55, 0x57, 0x00, 0x5a, 0x7b, 0x00, 0x5a, 0xa5, 0x00, 0x3c, 0x99, 0x00, 0x24, 0x88, 0x00, 0x12, 0x71, 0x00, 0x06, 0x55, 0x00, 0x00, 0x33, 0x03, 0x00, 0x2f, 0x07, 0x00, 0x2b, 0x0a, 0x00, 0x28, 0x0e, 0x00, 0x24, 0x12, 0x00, 0x21 } } }, // 9 Shifting Horizon, fast_spin
+    { 0x2c4adb51, { { 0x27, 0x0c, 0x00, 0x23, 0x0f, 0x00, 0x1f, 0x13, 0x00, 0x1c, 0x16, 0x00, 0x18, 0x1a, 0x00, 0x15, 0x1e, 0x00, 0x1f, 0x3c, 0x00, 0x23, 0x60, 0x00, 0x22, 0x8a, 0x00, 0x1b, 0xba, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x9f, 0x0e, 0x00, 0x70, 0x14, 0x00, 0x47, 0x14, 0x00, 0x24, 0x0f, 0x00, 0x20, 0x12, 0x00, 0x1c, 0x16, 0x00, 0x19, 0x19, 0x00, 0x15, 0x1d, 0x00, 0x12, 0x21 }, { 0x1b, 0x18, 0x00, 0x17, 0x1b, 0x00, 0x13, 0x1f, 0x00, 0x10, 0x22, 0x00, 0x0c, 0x26, 0x00, 0x09, 0x2a, 0x00, 0x09, 0x52, 0x00, 0x04, 0x7f, 0x00, 0x00, 0xa7, 0x06, 0x00, 0xbf, 0x16, 0x00, 0xd2, 0x2d, 0x00, 0xa1, 0x34, 0x00, 0x76, 0x37, 0x00, 0x51, 0x33, 0x00, 0x31, 0x2a, 0x00, 0x18, 0x1b, 0x00, 0x14, 0x1e, 0x00, 0x10, 0x22, 0x00, 0x0d, 0x25, 0x00, 0x09, 0x29, 0x00, 0x06, 0x2d }, { 0x0f, 0x24, 0x00, 0x0b, 0x27, 0x00, 0x07, 0x2b, 0x00, 0x04, 0x2e, 0x00, 0x00, 0x32, 0x00, 0x00, 0x30, 0x03, 0x00, 0x4f, 0x0b, 0x00, 0x6a, 0x1a, 0x00, 0x7e, 0x2e, 0x00, 0x8d, 0x49, 0x00, 0x96, 0x69, 0x00, 0x6e, 0x67, 0x00, 0x4d, 0x5f, 0x00, 0x31, 0x52, 0x00, 0x1c, 0x3f, 0x00, 0x0c, 0x27, 0x00, 0x08, 0x2a, 0x00, 0x04, 0x2e, 0x00, 0x01, 0x31, 0x02, 0x00, 0x30, 0x06, 0x00, 0x2d }, { 0x03, 0x30, 0x00, 0x00, 0x32, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x2b, 0x07, 0x00, 0x27, 0x0b, 0x00, 0x24, 0x0f, 0x00, 0x3a, 0x21, 0x00, 0x4a, 0x39, 0x00, 0x55, 0x57, 0x00, 0x5a, 0x7b, 0x00, 0x5a, 0xa5, 0x00, 0x3c, 0x99, 0x00, 0x24, 0x88, 0x00, 0x12, 0x71, 0x00, 0x06, 0x55, 0x00, 0x00, 0x33, 0x03, 0x00, 0x2f, 0x07, 0x00, 0x2b, 0x0a, 0x00, 0x28, 0x0e, 0x00, 0x24, 0x12, 0x00, 0x21 } } }, // 9 Shifting Horizon, silence
+    { 0x2c4adb51, { { 0x27, 0x0c, 0x00, 0x23, 0x0f, 0x00, 0x1f, 0x13, 0x00, 0x1c, 0x16, 0x00, 0x18, 0x1a, 0x00, 0x15, 0x1e, 0x00, 0x1f, 0x3c, 0x00, 0x23, 0x60, 0x00, 0x22, 0x8a, 0x00, 0x1b, 0xba, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x9f, 0x0e, 0x00, 0x70, 0x14, 0x00, 0x47, 0x14, 0x00, 0x24, 0x0f, 0x00, 0x20, 0x12, 0x00, 0x1c, 0x16, 0x00, 0x19, 0x19, 0x00, 0x15, 0x1d, 0x00, 0x12, 0x21 }, { 0x1b, 0x18, 0x00, 0x17, 0x1b, 0x00, 0x13, 0x1f, 0x00, 0x10, 0x22, 0x00, 0x0c, 0x26, 0x00, 0x09, 0x2a, 0x00, 0x09, 0x52, 0x00, 0x04, 0x7f, 0x00, 0x00, 0xa7, 0x06, 0x00, 0xbf, 0x16, 0x00, 0xd2, 0x2d, 0x00, 0xa1, 0x34, 0x00, 0x76, 0x37, 0x00, 0x51, 0x33, 0x00, 0x31, 0x2a, 0x00, 0x18, 0x1b, 0x00, 0x14, 0x1e, 0x00, 0x10, 0x22, 0x00, 0x0d, 0x25, 0x00, 0x09, 0x29, 0x00, 0x06, 0x2d }, { 0x0f, 0x24, 0x00, 0x0b, 0x27, 0x00, 0x07, 0x2b, 0x00, 0x04, 0x2e, 0x00, 0x00, 0x32, 0x00, 0x00, 0x30, 0x03, 0x00, 0x4f, 0x0b, 0x00, 0x6a, 0x1a, 0x00, 0x7e, 0x2e, 0x00, 0x8d, 0x49, 0x00, 0x96, 0x69, 0x00, 0x6e, 0x67, 0x00, 0x4d, 0x5f, 0x00, 0x31, 0x52, 0x00, 0x1c, 0x3f, 0x00, 0x0c, 0x27, 0x00, 0x08, 0x2a, 0x00, 0x04, 0x2e, 0x00, 0x01, 0x31, 0x02, 0x00, 0x30, 0x06, 0x00, 0x2d }, { 0x03, 0x30, 0x00, 0x00, 0x32, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x2b, 0x07, 0x00, 0x27, 0x0b, 0x00, 0x24, 0x0f, 0x00, 0x3a, 0x21, 0x00, 0x4a, 0x39, 0x00, 0x55, 0x57, 0x00, 0x5a, 0x7b, 0x00, 0x5a, 0xa5, 0x00, 0x3c, 0x99, 0x00, 0x24, 0x88, 0x00, 0x12, 0x71, 0x00, 0x06, 0x55, 0x00, 0x00, 0x33, 0x03, 0x00, 0x2f, 0x07, 0x00, 0x2b, 0x0a, 0x00, 0x28, 0x0e, 0x00, 0x24, 0x12, 0x00, 0x21 } } }, // 9 Shifting Horizon, loud_music
+    { 0x8b92533b, { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff } } }, // 10 Gravity Ball, slow_swing
+    { 0x1e8d8fad, { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff } } }, // 10 Gravity Ball, fast_spin
+    { 0x1e8d8fad, { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff } } }, // 10 Gravity Ball, silence
+    { 0x8b92533b, { { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff }, { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff } } }, // 10 Gravity Ball, loud_music
+    { 0x09239d7a, { { 0xbd, 0x0e, 0x00, 0x9e, 0x2d, 0x00, 0x7f, 0x4c, 0x00, 0x62, 0x69, 0x00, 0x43, 0x88, 0x00, 0x23, 0xa7, 0x00, 0x04, 0xc7, 0x00, 0x00, 0xb1, 0x1a, 0x00, 0x94, 0x37, 0x00, 0x75, 0x56, 0x00, 0x56, 0x75, 0x23, 0x37, 0x87, 0x42, 0x2d, 0x8b, 0x53, 0x3e, 0x6c, 0x5a, 0x71, 0x33, 0x42, 0xb2, 0x09, 0x27, 0xc5, 0x11, 0x34, 0xa3, 0x26, 0x66, 0x64, 0x34, 0x9e, 0x2e, 0x23, 0xb1, 0x1b, 0x0a }, { 0xaa, 0x21, 0x00, 0x8d, 0x3e, 0x00, 0x6e, 0x5d, 0x00, 0x4f, 0x7c, 0x00, 0x2f, 0x9b, 0x00, 0x10, 0xbb, 0x00, 0x00, 0xbf, 0x0b, 0x00, 0xa0, 0x2b, 0x00, 0x81, 0x4a, 0x00, 0x62, 0x69, 0x00, 0x43, 0x88, 0x1f, 0x2b, 0x96, 0x3a, 0x28, 0x97, 0x50, 0x4b, 0x62, 0x4e, 0x83, 0x2d, 0x2d, 0xc9, 0x08, 0x18, 0xd7, 0x0e, 0x3b, 0x95, 0x2d, 0x72, 0x58, 0x33, 0xa5, 0x2b, 0x1e, 0xa0, 0x2b, 0x0c }, { 0x99, 0x32, 0x00, 0x7a, 0x51, 0x00, 0x5b, 0x70, 0x00, 0x3e, 0x8d, 0x00, 0x1f, 0xac, 0x00, 0x00, 0xcb, 0x00, 0x00, 0xac, 0x1f, 0x00, 0x8d, 0x3e, 0x00, 0x70, 0x5b, 0x00, 0x51, 0x7a, 0x00, 0x32, 0x99, 0x1b, 0x1e, 0xa8, 0x3a, 0x2b, 0x93, 0x4d, 0x57, 0x59, 0x43, 0x92, 0x28, 0x1b, 0xdc, 0x07, 0x16, 0xcd, 0x1b, 0x42, 0x85, 0x36, 0x7c, 0x4e, 0x33, 0x97, 0x34, 0x24, 0x90, 0x39, 0x0e }, { 0x86, 0x45, 0x00, 0x69, 0x62, 0x00, 0x4a, 0x81, 0x00, 0x2b, 0xa0, 0x00, 0x0b, 0xbf, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x9b, 0x2f, 0x00, 0x7c, 0x4f, 0x00, 0x5d, 0x6e, 0x00, 0x3e, 0x8d, 0x00, 0x1f, 0xac, 0x18, 0x11, 0xb7, 0x3f, 0x33, 0x86, 0x4b, 0x64, 0x4f, 0x37, 0xa4, 0x23, 0x08, 0xed, 0x08, 0x18, 0xbb, 0x2a, 0x49, 0x77, 0x3d, 0x7c, 0x49, 0x38, 0x87, 0x3d, 0x2b, 0x7d, 0x49, 0x11 } } }, // 11 Navigator, slow_swing
+    { 0xa536c875, { { 0xbd, 0x0e, 0x00, 0x9e, 0x2d, 0x00, 0x7f, 0x4c, 0x00, 0x62, 0x69, 0x00, 0x43, 0x88, 0x00, 0x23, 0xa7, 0x00, 0x04, 0xc7, 0x00, 0x00, 0xb1, 0x1a, 0x00, 0x94, 0x37, 0x00, 0x75, 0x56, 0x00, 0x56, 0x75, 0x21, 0x37, 0x87, 0x3f, 0x2d, 0x8b, 0x52, 0x3d, 0x6e, 0x59, 0x6f, 0x35, 0x43, 0xb1, 0x0a, 0x27, 0xc7, 0x10, 0x33, 0xa5, 0x25, 0x64, 0x65, 0x34, 0x9c, 0x2f, 0x24, 0xb1, 0x1c, 0x0b }, { 0xaa, 0x21, 0x00, 0x8d, 0x3e, 0x00, 0x6e, 0x5d, 0x00, 0x4f, 0x7c, 0x00, 0x2f, 0x9b, 0x00, 0x10, 0xbb, 0x00, 0x00, 0xbf, 0x0b, 0x00, 0xa0, 0x2b, 0x00, 0x81, 0x4a, 0x00, 0x62, 0x69, 0x00, 0x43, 0x88, 0x1e, 0x2b, 0x96, 0x38, 0x27, 0x99, 0x50, 0x4b, 0x63, 0x4d, 0x81, 0x2f, 0x2e, 0xc7, 0x09, 0x17, 0xd9, 0x0e, 0x3a, 0x97, 0x2d, 0x70, 0x5a, 0x34, 0xa4, 0x2c, 0x1f, 0x9f, 0x2b, 0x0d }, { 0x99, 0x32, 0x00, 0x7a, 0x51, 0x00, 0x5b, 0x70, 0x00, 0x3e, 0x8d, 0x00, 0x1f, 0xac, 0x00, 0x00, 0xcb, 0x00, 0x00, 0xac, 0x1f, 0x00, 0x8d, 0x3e, 0x00, 0x70, 0x5b, 0x00, 0x51, 0x7a, 0x00, 0x32, 0x99, 0x1a, 0x1d, 0xa8, 0x38, 0x2a, 0x95, 0x4d, 0x56, 0x5a, 0x43, 0x91, 0x29, 0x1b, 0xdb, 0x07, 0x15, 0xce, 0x1a, 0x41, 0x87, 0x36, 0x7b, 0x4f, 0x33, 0x97, 0x34, 0x25, 0x8f, 0x39, 0x0f }, { 0x86, 0x45, 0x00, 0x69, 0x62, 0x00, 0x4a, 0x81, 0x00, 0x2b, 0xa0, 0x00, 0x0b, 0xbf, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x9b, 0x2f, 0x00, 0x7c, 0x4f, 0x00, 0x5d, 0x6e, 0x00, 0x3e, 0x8d, 0x00, 0x1f, 0xac, 0x17, 0x11, 0xb7, 0x3e, 0x32, 0x87, 0x4b, 0x64, 0x4f, 0x37, 0xa3, 0x23, 0x09, 0xec, 0x09, 0x18, 0xbc, 0x2a, 0x48, 0x78, 0x3d, 0x7b, 0x49, 0x39, 0x86, 0x3d, 0x2b, 0x7c, 0x49, 0x11 } } }, // 11 Navigator, fast_spin
+    { 0x14ddc1ee, { { 0x76, 0x09, 0x00, 0x63, 0x1c, 0x00, 0x4f, 0x30, 0x00, 0x3d, 0x42, 0x00, 0x2a, 0x55, 0x00, 0x16, 0x69, 0x00, 0x03, 0x7c, 0x00, 0x00, 0x6f, 0x10, 0x00, 0x5d, 0x22, 0x00, 0x49, 0x36, 0x06, 0x35, 0x49, 0x20, 0x25, 0x57, 0x37, 0x23, 0x5b, 0x49, 0x37, 0x4c, 0x54, 0x6d, 0x23, 0x42, 0xbd, 0x00, 0x28, 0xa6, 0x16, 0x31, 0x79, 0x21, 0x50, 0x3e, 0x25, 0x6f, 0x18, 0x15, 0x74, 0x0d, 0x03 }, { 0x6a, 0x15, 0x00, 0x58, 0x27, 0x00, 0x45, 0x3a, 0x00, 0x31, 0x4e, 0x00, 0x1e, 0x61, 0x00, 0x0a, 0x75, 0x00, 0x00, 0x78, 0x07, 0x00, 0x64, 0x1b, 0x00, 0x51, 0x2e, 0x00, 0x3d, 0x42, 0x05, 0x29, 0x54, 0x1d, 0x1e, 0x61, 0x30, 0x20, 0x64, 0x44, 0x43, 0x44, 0x46, 0x7e, 0x1f, 0x2a, 0xd5, 0x00, 0x1c, 0xb5, 0x12, 0x37, 0x6e, 0x26, 0x5a, 0x37, 0x23, 0x75, 0x17, 0x10, 0x68, 0x18, 0x03 }, { 0x60, 0x1f, 0x00, 0x4c, 0x33, 0x00, 0x39, 0x46, 0x00, 0x27, 0x58, 0x00, 0x13, 0x6c, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x6c, 0x13, 0x00, 0x58, 0x27, 0x00, 0x46, 0x39, 0x00, 0x33, 0x4c, 0x05, 0x1f, 0x5f, 0x19, 0x16, 0x6c, 0x2f, 0x24, 0x61, 0x40, 0x4d, 0x3e, 0x3a, 0x8e, 0x1c, 0x15, 0xea, 0x00, 0x1c, 0xac, 0x1c, 0x3f, 0x62, 0x2a, 0x62, 0x31, 0x20, 0x6b, 0x1e, 0x13, 0x5d, 0x22, 0x04 }, { 0x54, 0x2b, 0x00, 0x42, 0x3d, 0x00, 0x2e, 0x51, 0x00, 0x1b, 0x64, 0x00, 0x07, 0x78, 0x00, 0x00, 0x73, 0x0c, 0x00, 0x61, 0x1e, 0x00, 0x4e, 0x31, 0x00, 0x3a, 0x45, 0x00, 0x27, 0x58, 0x04, 0x14, 0x6b, 0x16, 0x10, 0x76, 0x31, 0x2a, 0x59, 0x3c, 0x59, 0x37, 0x2d, 0xa0, 0x17, 0x00, 0xfc, 0x03, 0x1f, 0x9d, 0x27, 0x45, 0x58, 0x2e, 0x62, 0x2f, 0x23, 0x5f, 0x26, 0x16, 0x52, 0x2e, 0x04 } } }, // 11 Navigator, silence
+    { 0x09239d7a, { { 0xbd, 0x0e, 0x00, 0x9e, 0x2d, 0x00, 0x7f, 0x4c, 0x00, 0x62, 0x69, 0x00, 0x43, 0x88, 0x00, 0x23, 0xa7, 0x00, 0x04, 0xc7, 0x00, 0x00, 0xb1, 0x1a, 0x00, 0x94, 0x37, 0x00, 0x75, 0x56, 0x00, 0x56, 0x75, 0x23, 0x37, 0x87, 0x42, 0x2d, 0x8b, 0x53, 0x3e, 0x6c, 0x5a, 0x71, 0x33, 0x42, 0xb2, 0x09, 0x27, 0xc5, 0x11, 0x34, 0xa3, 0x26, 0x66, 0x64, 0x34, 0x9e, 0x2e, 0x23, 0xb1, 0x1b, 0x0a }, { 0xaa, 0x21, 0x00, 0x8d, 0x3e, 0x00, 0x6e, 0x5d, 0x00, 0x4f, 0x7c, 0x00, 0x2f, 0x9b, 0x00, 0x10, 0xbb, 0x00, 0x00, 0xbf, 0x0b, 0x00, 0xa0, 0x2b, 0x00, 0x81, 0x4a, 0x00, 0x62, 0x69, 0x00, 0x43, 0x88, 0x1f, 0x2b, 0x96, 0x3a, 0x28, 0x97, 0x50, 0x4b, 0x62, 0x4e, 0x83, 0x2d, 0x2d, 0xc9, 0x08, 0x18, 0xd7, 0x0e, 0x3b, 0x95, 0x2d, 0x72, 0x58, 0x33, 0xa5, 0x2b, 0x1e, 0xa0, 0x2b, 0x0c }, { 0x99, 0x32, 0x00, 0x7a, 0x51, 0x00, 0x5b, 0x70, 0x00, 0x3e, 0x8d, 0x00, 0x1f, 0xac, 0x00, 0x00, 0xcb, 0x00, 0x00, 0xac, 0x1f, 0x00, 0x8d, 0x3e, 0x00, 0x70, 0x5b, 0x00, 0x51, 0x7a, 0x00, 0x32, 0x99, 0x1b, 0x1e, 0xa8, 0x3a, 0x2b, 0x93, 0x4d, 0x57, 0x59, 0x43, 0x92, 0x28, 0x1b, 0xdc, 0x07, 0x16, 0xcd, 0x1b, 0x42, 0x85, 0x36, 0x7c, 0x4e, 0x33, 0x97, 0x34, 0x24, 0x90, 0x39, 0x0e }, { 0x86, 0x45, 0x00, 0x69, 0x62, 0x00, 0x4a, 0x81, 0x00, 0x2b, 0xa0, 0x00, 0x0b, 0xbf, 0x00, 0x00, 0xb8, 0x13, 0x00, 0x9b, 0x2f, 0x00, 0x7c, 0x4f, 0x00, 0x5d, 0x6e, 0x00, 0x3e, 0x8d, 0x00, 0x1f, 0xac, 0x18, 0x11, 0xb7, 0x3f, 0x33, 0x86, 0x4b, 0x64, 0x4f, 0x37, 0xa4, 0x23, 0x08, 0xed, 0x08, 0x18, 0xbb, 0x2a, 0x49, 0x77, 0x3d, 0x7c, 0x49, 0x38, 0x87, 0x3d, 0x2b, 0x7d, 0x49, 0x11 } } }, // 11 Navigator, loud_music
+    { 0xceafe2c9, { { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } } }, // 12 POV Heart, slow_swing
+    { 0x51586ba5, { { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x4e, 0xb1, 0x00, 0x33, 0xcc, 0x00, 0x1b, 0xe4, 0x00, 0x00, 0xff }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x4e, 0xb1, 0x00, 0x33, 0xcc, 0x00, 0x1b, 0xe4, 0x00, 0x00, 0xff }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x4e, 0xb1, 0x00, 0x33, 0xcc, 0x00, 0x1b, 0xe4, 0x00, 0x00, 0xff }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x4e, 0xb1, 0x00, 0x33, 0xcc, 0x00, 0x1b, 0xe4, 0x00, 0x00, 0xff } } }, // 12 POV Heart, fast_spin
+    { 0x589565c5, { { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x4e, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x4e, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x4e, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x4e, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } } }, // 12 POV Heart, silence
+    { 0xceafe2c9, { { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, { 0xfc, 0x03, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe7, 0x18, 0x00, 0xcc, 0x33, 0x00, 0xb4, 0x4b, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } } }, // 12 POV Heart, loud_music
+    { 0xd936fbb9, { { 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7, 0x75, 0x0e, 0xb7 }, { 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4 }, { 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4 }, { 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4, 0x78, 0x0e, 0xb4 } } }, // 13 Rainbow Pulse, slow_swing
+    { 0xea3f36fe, { { 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4 }, { 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4 }, { 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4 }, { 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4, 0xff, 0x55, 0xb4 } } }, // 13 Rainbow Pulse, fast_spin
+    { 0xedfebcbd, { { 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0 }, { 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0 }, { 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0 }, { 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0, 0x3f, 0x00, 0xc0 } } }, // 13 Rainbow Pulse, silence
+    { 0x6f7a2131, { { 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf, 0x83, 0x2c, 0xbf }, { 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe, 0x87, 0x32, 0xbe }, { 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf, 0x8a, 0x3e, 0xbf }, { 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2, 0x8b, 0x48, 0xc2 } } }, // 13 Rainbow Pulse, loud_music
+    { 0x822ef83d, { { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 } } }, // 14 Audio Spectrum, slow_swing
+    { 0x822ef83d, { { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 } } }, // 14 Audio Spectrum, fast_spin
+    { 0x822ef83d, { { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 }, { 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19, 0x00, 0x00, 0x19 } } }, // 14 Audio Spectrum, silence
+    { 0xa876e7e1, { { 0xa2, 0x38, 0x00, 0x9f, 0x3b, 0x00, 0x9e, 0x3a, 0x00, 0x9b, 0x3d, 0x00, 0x9b, 0x3d, 0x00, 0x9b, 0x3d, 0x00, 0x8a, 0x47, 0x00, 0x5a, 0x61, 0x00, 0x30, 0x75, 0x00, 0x1a, 0x7d, 0x00, 0x18, 0x7e, 0x00, 0x16, 0x7e, 0x00, 0x14, 0x7f, 0x00, 0x14, 0x7f, 0x00, 0x14, 0x7f, 0x00, 0x11, 0x80, 0x00, 0x0b, 0x81, 0x00, 0x04, 0x83, 0x00, 0x04, 0x83, 0x00, 0x06, 0x82, 0x00, 0x08, 0x82, 0x00 }, { 0xc0, 0x25, 0x00, 0xbc, 0x28, 0x00, 0xbc, 0x28, 0x00, 0xb9, 0x2a, 0x00, 0xbf, 0x25, 0x00, 0xc4, 0x23, 0x00, 0xb1, 0x2f, 0x00, 0x6a, 0x59, 0x00, 0x33, 0x74, 0x00, 0x16, 0x7f, 0x00, 0x14, 0x7f, 0x00, 0x13, 0x7f, 0x00, 0x13, 0x80, 0x00, 0x16, 0x7e, 0x00, 0x18, 0x7e, 0x00, 0x16, 0x7e, 0x00, 0x12, 0x7f, 0x00, 0x0d, 0x81, 0x00, 0x09, 0x82, 0x00, 0x04, 0x83, 0x00, 0x01, 0x83, 0x00 }, { 0xe0, 0x11, 0x00, 0xf0, 0x05, 0x00, 0xfb, 0x00, 0x00, 0xf6, 0x00, 0x09, 0xf7, 0x00, 0x05, 0xfb, 0x00, 0x00, 0xdb, 0x13, 0x00, 0x7c, 0x4f, 0x00, 0x35, 0x73, 0x00, 0x14, 0x7e, 0x00, 0x12, 0x7f, 0x00, 0x0f, 0x81, 0x00, 0x0d, 0x81, 0x00, 0x0b, 0x81, 0x00, 0x08, 0x82, 0x00, 0x06, 0x82, 0x00, 0x04, 0x82, 0x00, 0x01, 0x83, 0x00, 0x00, 0x83, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x7b, 0x04 }, { 0xd5, 0x00, 0x2a, 0xd8, 0x00, 0x27, 0xdb, 0x00, 0x24, 0xde, 0x00, 0x21, 0xde, 0x00, 0x21, 0xde, 0x00, 0x21, 0xf8, 0x00, 0x05, 0x90, 0x43, 0x00, 0x35, 0x73, 0x00, 0x11, 0x80, 0x00, 0x0f, 0x80, 0x00, 0x0d, 0x81, 0x00, 0x0d, 0x80, 0x00, 0x0b, 0x82, 0x00, 0x0b, 0x82, 0x00, 0x0b, 0x81, 0x00, 0x0b, 0x81, 0x00, 0x09, 0x82, 0x00, 0x09, 0x82, 0x00, 0x09, 0x82, 0x00, 0x09, 0x81, 0x00 } } }, // 14 Audio Spectrum, loud_music
+    { 0xa13be6ab, { { 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x00, 0x01, 0x11, 0x00, 0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x01, 0x0f, 0x00, 0x01, 0x0f, 0x00, 0x01, 0x0f, 0x00, 0x01, 0x0f, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x0e, 0x02 }, { 0x05, 0x0a, 0x00, 0x05, 0x0b, 0x00, 0x05, 0x0b, 0x00, 0x04, 0x0c, 0x00, 0x03, 0x0d, 0x00, 0x02, 0x0e, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x10, 0x01, 0x00, 0x0f, 0x03, 0x00, 0x0e, 0x04, 0x00, 0x0d, 0x06, 0x00, 0x0c, 0x08, 0x00, 0x0a, 0x09, 0x00, 0x09, 0x0b, 0x00, 0x08, 0x0c, 0x00, 0x07, 0x0e, 0x00, 0x06, 0x0f, 0x00, 0x05, 0x10, 0x00, 0x04, 0x11 }, { 0x00, 0x10, 0x04, 0x00, 0x0f, 0x05, 0x00, 0x0e, 0x06, 0x00, 0x0d, 0x08, 0x00, 0x0c, 0x09, 0x00, 0x0b, 0x0a, 0x00, 0x0a, 0x0b, 0x00, 0x09, 0x0b, 0x00, 0x09, 0x0c, 0x00, 0x09, 0x0c, 0x00, 0x09, 0x0c, 0x00, 0x08, 0x0c, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x09, 0x0a, 0x00, 0x09, 0x0a, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x08, 0x00, 0x09, 0x08, 0x00, 0x09, 0x07 }, { 0x00, 0x0e, 0x05, 0x00, 0x0e, 0x04, 0x00, 0x0e, 0x04, 0x00, 0x0e, 0x03, 0x00, 0x0e, 0x03, 0x00, 0x0e, 0x03, 0x00, 0x0e, 0x02, 0x00, 0x0e, 0x02, 0x00, 0x0e, 0x02, 0x00, 0x0e, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0d, 0x02, 0x00, 0x0c, 0x03, 0x00, 0x0c, 0x03, 0x00, 0x0b, 0x04, 0x00, 0x0b, 0x05, 0x00, 0x0a, 0x06, 0x00, 0x09, 0x07, 0x00, 0x08, 0x08, 0x00, 0x07, 0x0a, 0x00, 0x06, 0x0b } } }, // 15 Audio Wave, slow_swing
+    { 0x2fd6a4b5, { { 0x00, 0x0c, 0x08, 0x00, 0x0c, 0x08, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x05, 0x00, 0x0d, 0x05, 0x00, 0x0c, 0x05, 0x00, 0x0d, 0x04, 0x00, 0x0c, 0x04, 0x00, 0x0c, 0x04, 0x00, 0x0c, 0x04, 0x00, 0x0c, 0x04, 0x00, 0x0c, 0x04, 0x00, 0x0b, 0x04, 0x00, 0x0b, 0x05, 0x00, 0x0a, 0x06, 0x00, 0x09, 0x06, 0x00, 0x09, 0x07, 0x00, 0x08, 0x08 }, { 0x00, 0x0a, 0x05, 0x00, 0x0a, 0x06, 0x00, 0x09, 0x06, 0x00, 0x09, 0x07, 0x00, 0x08, 0x08, 0x00, 0x07, 0x09, 0x00, 0x06, 0x0a, 0x00, 0x05, 0x0b, 0x00, 0x04, 0x0d, 0x00, 0x03, 0x0e, 0x00, 0x02, 0x10, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x02, 0x00, 0x11, 0x03, 0x00, 0x10, 0x05, 0x00, 0x0f, 0x06, 0x00, 0x0e, 0x07, 0x00, 0x0d, 0x09, 0x00, 0x0c, 0x09, 0x00, 0x0b, 0x0b, 0x00, 0x0a }, { 0x05, 0x00, 0x0e, 0x07, 0x00, 0x0d, 0x08, 0x00, 0x0c, 0x09, 0x00, 0x0b, 0x0a, 0x00, 0x0a, 0x0b, 0x00, 0x09, 0x0c, 0x00, 0x09, 0x0d, 0x00, 0x08, 0x0d, 0x00, 0x08, 0x0d, 0x00, 0x07, 0x0d, 0x00, 0x07, 0x0d, 0x00, 0x07, 0x0d, 0x00, 0x07, 0x0c, 0x00, 0x07, 0x0c, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x08, 0x09, 0x00, 0x08, 0x09, 0x00, 0x08, 0x09, 0x00, 0x08 }, { 0x0d, 0x00, 0x06, 0x0d, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0b, 0x00, 0x06, 0x0b, 0x00, 0x07, 0x0a, 0x00, 0x07, 0x0a, 0x00, 0x07, 0x09, 0x00, 0x07, 0x09, 0x00, 0x07, 0x09, 0x00, 0x07, 0x09, 0x00, 0x06, 0x0a, 0x00, 0x06, 0x0a, 0x00, 0x05, 0x0b, 0x00, 0x05, 0x0b, 0x00, 0x04, 0x0c, 0x00, 0x04, 0x0d, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x10, 0x00, 0x01, 0x12, 0x00, 0x00, 0x11, 0x01, 0x00 } } }, // 15 Audio Wave, fast_spin
+    { 0x3acc2d0c, { { 0x08, 0x0a, 0x00, 0x06, 0x0b, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0f, 0x00, 0x02, 0x11, 0x00, 0x01, 0x12, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x12, 0x02, 0x00, 0x12, 0x03, 0x00, 0x11, 0x04, 0x00, 0x10, 0x05, 0x00, 0x10, 0x05, 0x00, 0x0f, 0x06, 0x00, 0x0f, 0x06, 0x00, 0x0e, 0x06, 0x00, 0x0e, 0x06, 0x00, 0x0e, 0x06, 0x00, 0x0e, 0x06, 0x00, 0x0e, 0x05, 0x00, 0x0e, 0x05 }, { 0x0a, 0x07, 0x00, 0x08, 0x09, 0x00, 0x07, 0x0a, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0f, 0x00, 0x02, 0x11, 0x00, 0x01, 0x13, 0x00, 0x00, 0x14, 0x00, 0x00, 0x14, 0x00, 0x00, 0x13, 0x02, 0x00, 0x12, 0x03, 0x00, 0x11, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10, 0x05, 0x00, 0x0f, 0x05, 0x00, 0x0f, 0x06, 0x00, 0x0f, 0x06, 0x00, 0x0e, 0x06, 0x00, 0x0e, 0x06, 0x00, 0x0e, 0x05 }, { 0x0b, 0x05, 0x00, 0x0a, 0x06, 0x00, 0x09, 0x08, 0x00, 0x08, 0x09, 0x00, 0x07, 0x0a, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0e, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x11, 0x00, 0x01, 0x13, 0x00, 0x00, 0x14, 0x00, 0x00, 0x13, 0x01, 0x00, 0x13, 0x02, 0x00, 0x12, 0x03, 0x00, 0x11, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10, 0x05, 0x00, 0x0f, 0x05, 0x00, 0x0f, 0x06, 0x00, 0x0f, 0x05, 0x00, 0x0f, 0x05 }, { 0x0d, 0x03, 0x00, 0x0c, 0x04, 0x00, 0x0b, 0x05, 0x00, 0x0a, 0x06, 0x00, 0x09, 0x08, 0x00, 0x08, 0x09, 0x00, 0x07, 0x0b, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0e, 0x00, 0x03, 0x10, 0x00, 0x02, 0x11, 0x00, 0x01, 0x13, 0x00, 0x00, 0x14, 0x00, 0x00, 0x13, 0x01, 0x00, 0x12, 0x02, 0x00, 0x12, 0x03, 0x00, 0x11, 0x04, 0x00, 0x10, 0x04, 0x00, 0x10, 0x05, 0x00, 0x0f, 0x05, 0x00, 0x0f, 0x05 } } }, // 15 Audio Wave, silence
+    { 0x1aff6029, { { 0x00, 0x1f, 0x47, 0x00, 0x21, 0x41, 0x00, 0x23, 0x3d, 0x00, 0x23, 0x3a, 0x00, 0x23, 0x3a, 0x00, 0x20, 0x3b, 0x00, 0x1d, 0x3f, 0x00, 0x18, 0x46, 0x00, 0x12, 0x4e, 0x00, 0x0a, 0x59, 0x00, 0x00, 0x68, 0x0b, 0x00, 0x61, 0x17, 0x00, 0x59, 0x26, 0x00, 0x4f, 0x36, 0x00, 0x43, 0x46, 0x00, 0x38, 0x56, 0x00, 0x2c, 0x65, 0x00, 0x21, 0x73, 0x00, 0x16, 0x7d, 0x00, 0x0e, 0x84, 0x00, 0x08 }, { 0x60, 0x55, 0x00, 0x4f, 0x6c, 0x00, 0x3f, 0x81, 0x00, 0x32, 0x91, 0x00, 0x27, 0x9e, 0x00, 0x22, 0xa3, 0x00, 0x22, 0xa1, 0x00, 0x24, 0x9c, 0x00, 0x2a, 0x91, 0x00, 0x33, 0x82, 0x00, 0x3d, 0x70, 0x00, 0x46, 0x60, 0x00, 0x50, 0x4e, 0x00, 0x58, 0x3d, 0x00, 0x5e, 0x30, 0x00, 0x61, 0x26, 0x00, 0x63, 0x1e, 0x00, 0x64, 0x19, 0x00, 0x62, 0x18, 0x00, 0x60, 0x19, 0x00, 0x5c, 0x1e, 0x00 }, { 0x00, 0x7c, 0x4e, 0x00, 0x86, 0x37, 0x00, 0x8e, 0x23, 0x00, 0x94, 0x13, 0x00, 0x95, 0x09, 0x00, 0x97, 0x01, 0x00, 0x93, 0x01, 0x00, 0x91, 0x03, 0x00, 0x8a, 0x0c, 0x00, 0x84, 0x17, 0x00, 0x79, 0x2a, 0x00, 0x69, 0x43, 0x00, 0x54, 0x63, 0x00, 0x3c, 0x88, 0x00, 0x1f, 0xb1, 0x02, 0x00, 0xda, 0x23, 0x00, 0xc5, 0x44, 0x00, 0xad, 0x61, 0x00, 0x98, 0x78, 0x00, 0x87, 0x87, 0x00, 0x78 }, { 0x04, 0x00, 0xad, 0x15, 0x00, 0xa4, 0x33, 0x00, 0x93, 0x5a, 0x00, 0x7b, 0x88, 0x00, 0x5f, 0xc2, 0x00, 0x37, 0xf6, 0x00, 0x09, 0xde, 0x21, 0x00, 0xb7, 0x48, 0x00, 0x99, 0x66, 0x00, 0x81, 0x7e, 0x00, 0x75, 0x8a, 0x00, 0x72, 0x8d, 0x00, 0x78, 0x87, 0x00, 0x87, 0x78, 0x00, 0x9c, 0x63, 0x00, 0xb7, 0x48, 0x00, 0xd7, 0x26, 0x00, 0xe6, 0x05, 0x00, 0xc6, 0x00, 0x14, 0xa0, 0x00, 0x2b } } }, // 15 Audio Wave, loud_music
+    { 0xe3a7aec5, { { 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00 }, { 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00 }, { 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00 }, { 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00 } } }, // 16 Audio Bass Pulse, slow_swing
+    { 0xe3a7aec5, { { 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00 }, { 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00 }, { 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00 }, { 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00 } } }, // 16 Audio Bass Pulse, fast_spin
+    { 0x3d1d1ead, { { 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00 }, { 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00 }, { 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00 }, { 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00 } } }, // 16 Audio Bass Pulse, silence
+    { 0x6253e34d, { { 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c, 0x28, 0x32, 0x2c }, { 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31, 0x2a, 0x38, 0x31 }, { 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31, 0x2d, 0x43, 0x31 }, { 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c, 0x2d, 0x4b, 0x3c } } }, // 16 Audio Bass Pulse, loud_music
+    { 0x40271336, { { 0xc0, 0x3f, 0x00, 0xcf, 0x30, 0x00, 0xf0, 0x0f, 0x00, 0xf3, 0x00, 0x0c, 0xf0, 0x00, 0x0f, 0xf3, 0x0c, 0x00, 0xb7, 0x48, 0x00, 0x69, 0x96, 0x00, 0x21, 0xde, 0x00, 0x00, 0xed, 0x12, 0x00, 0xde, 0x21, 0x00, 0xed, 0x12, 0x0f, 0xf0, 0x00, 0x2a, 0xd5, 0x00, 0x2d, 0xd2, 0x00, 0x12, 0xed, 0x00, 0x00, 0xd5, 0x2a, 0x00, 0x87, 0x78, 0x00, 0x3f, 0xc0, 0x00, 0x0c, 0xf3, 0x03, 0x00, 0xfc }, { 0xcf, 0x30, 0x00, 0xe1, 0x1e, 0x00, 0xff, 0x00, 0x00, 0xe1, 0x00, 0x1e, 0xde, 0x00, 0x21, 0xf9, 0x00, 0x06, 0xc6, 0x39, 0x00, 0x7b, 0x84, 0x00, 0x30, 0xcf, 0x00, 0x00, 0xff, 0x00, 0x00, 0xed, 0x12, 0x00, 0xff, 0x00, 0x1e, 0xe1, 0x00, 0x3c, 0xc3, 0x00, 0x3f, 0xc0, 0x00, 0x24, 0xdb, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0x99, 0x66, 0x00, 0x4e, 0xb1, 0x00, 0x1e, 0xe1, 0x00, 0x0c, 0xf3 }, { 0xe1, 0x1e, 0x00, 0xf0, 0x0f, 0x00, 0xed, 0x00, 0x12, 0xd2, 0x00, 0x2d, 0xcc, 0x00, 0x33, 0xea, 0x00, 0x15, 0xd8, 0x27, 0x00, 0x8a, 0x75, 0x00, 0x42, 0xbd, 0x00, 0x12, 0xed, 0x00, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x30, 0xcf, 0x00, 0x4b, 0xb4, 0x00, 0x51, 0xae, 0x00, 0x33, 0xcc, 0x00, 0x00, 0xf6, 0x09, 0x00, 0xa8, 0x57, 0x00, 0x60, 0x9f, 0x00, 0x30, 0xcf, 0x00, 0x1e, 0xe1 }, { 0xf3, 0x0c, 0x00, 0xfc, 0x00, 0x03, 0xde, 0x00, 0x21, 0xc0, 0x00, 0x3f, 0xbd, 0x00, 0x42, 0xd8, 0x00, 0x27, 0xea, 0x15, 0x00, 0x9c, 0x63, 0x00, 0x54, 0xab, 0x00, 0x21, 0xde, 0x00, 0x12, 0xed, 0x00, 0x21, 0xde, 0x00, 0x3f, 0xc0, 0x00, 0x5d, 0xa2, 0x00, 0x60, 0x9f, 0x00, 0x45, 0xba, 0x00, 0x09, 0xf6, 0x00, 0x00, 0xba, 0x45, 0x00, 0x72, 0x8d, 0x00, 0x3f, 0xc0, 0x00, 0x30, 0xcf } } }, // 17 Audio+Motion, slow_swing
+    { 0xb2e5940f, { { 0x09, 0xf6, 0x00, 0x18, 0xe7, 0x00, 0x39, 0xc6, 0x00, 0x54, 0xab, 0x00, 0x5a, 0xa5, 0x00, 0x3c, 0xc3, 0x00, 0x00, 0xff, 0x00, 0x00, 0xb4, 0x4b, 0x00, 0x69, 0x96, 0x00, 0x39, 0xc6, 0x00, 0x27, 0xd8, 0x00, 0x36, 0xc9, 0x00, 0x57, 0xa8, 0x00, 0x72, 0x8d, 0x00, 0x78, 0x87, 0x00, 0x5a, 0xa5, 0x00, 0x1e, 0xe1, 0x2d, 0x00, 0xd2, 0x78, 0x00, 0x87, 0xa8, 0x00, 0x57, 0xba, 0x00, 0x45 }, { 0x00, 0x63, 0x9c, 0x00, 0x72, 0x8d, 0x00, 0x93, 0x6c, 0x00, 0xae, 0x51, 0x00, 0xb4, 0x4b, 0x00, 0x96, 0x69, 0x00, 0x5a, 0xa5, 0x00, 0x0f, 0xf0, 0x3c, 0x00, 0xc3, 0x6c, 0x00, 0x93, 0x7e, 0x00, 0x81, 0x6f, 0x00, 0x90, 0x4e, 0x00, 0xb1, 0x33, 0x00, 0xcc, 0x2d, 0x00, 0xd2, 0x4b, 0x00, 0xb4, 0x87, 0x00, 0x78, 0xd2, 0x00, 0x2d, 0xe1, 0x1e, 0x00, 0xb1, 0x4e, 0x00, 0x9f, 0x60, 0x00 }, { 0x42, 0x00, 0xbd, 0x33, 0x00, 0xcc, 0x12, 0x00, 0xed, 0x00, 0x09, 0xf6, 0x00, 0x0f, 0xf0, 0x0f, 0x00, 0xf0, 0x4b, 0x00, 0xb4, 0x96, 0x00, 0x69, 0xe1, 0x00, 0x1e, 0xed, 0x12, 0x00, 0xdb, 0x24, 0x00, 0xea, 0x15, 0x00, 0xf3, 0x00, 0x0c, 0xd8, 0x00, 0x27, 0xd2, 0x00, 0x2d, 0xf0, 0x00, 0x0f, 0xd2, 0x2d, 0x00, 0x87, 0x78, 0x00, 0x3c, 0xc3, 0x00, 0x0c, 0xf3, 0x00, 0x00, 0xf9, 0x06 }, { 0xe7, 0x00, 0x18, 0xd8, 0x00, 0x27, 0xb7, 0x00, 0x48, 0x9c, 0x00, 0x63, 0x96, 0x00, 0x69, 0xb4, 0x00, 0x4b, 0xf0, 0x00, 0x0f, 0xc3, 0x3c, 0x00, 0x78, 0x87, 0x00, 0x48, 0xb7, 0x00, 0x36, 0xc9, 0x00, 0x45, 0xba, 0x00, 0x66, 0x99, 0x00, 0x81, 0x7e, 0x00, 0x87, 0x78, 0x00, 0x69, 0x96, 0x00, 0x2d, 0xd2, 0x00, 0x00, 0xe1, 0x1e, 0x00, 0x96, 0x69, 0x00, 0x66, 0x99, 0x00, 0x54, 0xab } } }, // 17 Audio+Motion, fast_spin
+    { 0x36bc1a3d, { { 0x10, 0x07, 0x00, 0x09, 0x0e, 0x00, 0x04, 0x13, 0x00, 0x03, 0x15, 0x00, 0x04, 0x14, 0x00, 0x07, 0x10, 0x00, 0x0a, 0x0e, 0x00, 0x0a, 0x0d, 0x00, 0x08, 0x10, 0x00, 0x02, 0x16, 0x00, 0x00, 0x13, 0x04, 0x00, 0x0c, 0x0c, 0x00, 0x07, 0x10, 0x00, 0x06, 0x12, 0x00, 0x07, 0x11, 0x00, 0x0a, 0x0e, 0x00, 0x0c, 0x0b, 0x00, 0x0d, 0x0a, 0x00, 0x0a, 0x0d, 0x00, 0x05, 0x13, 0x02, 0x00, 0x16 }, { 0x09, 0x0e, 0x00, 0x02, 0x16, 0x00, 0x00, 0x15, 0x02, 0x00, 0x14, 0x04, 0x00, 0x15, 0x02, 0x00, 0x18, 0x00, 0x02, 0x15, 0x00, 0x03, 0x15, 0x00, 0x00, 0x17, 0x00, 0x00, 0x13, 0x04, 0x00, 0x0c, 0x0c, 0x00, 0x05, 0x13, 0x00, 0x00, 0x18, 0x01, 0x00, 0x17, 0x00, 0x00, 0x18, 0x00, 0x03, 0x15, 0x00, 0x05, 0x12, 0x00, 0x06, 0x12, 0x00, 0x03, 0x14, 0x02, 0x00, 0x16, 0x09, 0x00, 0x0f }, { 0x02, 0x16, 0x00, 0x00, 0x13, 0x04, 0x00, 0x0e, 0x09, 0x00, 0x0d, 0x0b, 0x00, 0x0e, 0x0a, 0x00, 0x11, 0x06, 0x00, 0x14, 0x04, 0x00, 0x14, 0x03, 0x00, 0x12, 0x06, 0x00, 0x0c, 0x0c, 0x00, 0x05, 0x13, 0x02, 0x00, 0x16, 0x06, 0x00, 0x11, 0x08, 0x00, 0x10, 0x07, 0x00, 0x11, 0x04, 0x00, 0x14, 0x01, 0x00, 0x17, 0x00, 0x00, 0x17, 0x03, 0x00, 0x15, 0x09, 0x00, 0x0f, 0x10, 0x00, 0x08 }, { 0x00, 0x13, 0x05, 0x00, 0x0c, 0x0c, 0x00, 0x07, 0x10, 0x00, 0x06, 0x12, 0x00, 0x07, 0x11, 0x00, 0x0a, 0x0e, 0x00, 0x0c, 0x0b, 0x00, 0x0d, 0x0a, 0x00, 0x0a, 0x0d, 0x00, 0x05, 0x13, 0x02, 0x00, 0x16, 0x09, 0x00, 0x0f, 0x0e, 0x00, 0x0a, 0x0f, 0x00, 0x08, 0x0e, 0x00, 0x0a, 0x0b, 0x00, 0x0d, 0x08, 0x00, 0x0f, 0x08, 0x00, 0x10, 0x0a, 0x00, 0x0d, 0x10, 0x00, 0x08, 0x17, 0x00, 0x00 } } }, // 17 Audio+Motion, silence
+    { 0xc4967ddc, { { 0x3c, 0xc3, 0x00, 0x4b, 0xb4, 0x00, 0x6c, 0x93, 0x00, 0x00, 0x06, 0xf9, 0x00, 0x09, 0xf6, 0x6f, 0x90, 0x00, 0x33, 0xcc, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0x9c, 0x63, 0x00, 0x69, 0x96, 0x00, 0x5a, 0xa5, 0x00, 0x69, 0x96, 0x00, 0x8a, 0x75, 0x00, 0xa5, 0x5a, 0x00, 0xa8, 0x57, 0x00, 0x8d, 0x72, 0x00, 0x51, 0xae, 0x00, 0x03, 0xfc, 0x45, 0x00, 0xba, 0x06, 0xf9, 0x00, 0x00, 0xf6, 0x09 }, { 0x12, 0xed, 0x00, 0x24, 0xdb, 0x00, 0x42, 0xbd, 0x00, 0x00, 0x7b, 0x84, 0x00, 0x7e, 0x81, 0x00, 0x63, 0x9c, 0x09, 0xf6, 0x00, 0x00, 0xbd, 0x42, 0x00, 0x72, 0x8d, 0x00, 0x42, 0xbd, 0x00, 0x30, 0xcf, 0x00, 0x42, 0xbd, 0x00, 0x60, 0x9f, 0x00, 0x7e, 0x81, 0x00, 0x81, 0x7e, 0x00, 0x66, 0x99, 0x00, 0x27, 0xd8, 0x24, 0x00, 0xdb, 0x6f, 0x00, 0x90, 0x9f, 0x00, 0x60, 0x69, 0x96, 0x00 }, { 0x00, 0xed, 0x12, 0x00, 0xfc, 0x03, 0x00, 0xd2, 0x2d, 0x00, 0xed, 0x12, 0x00, 0xf3, 0x0c, 0x00, 0xd5, 0x2a, 0x00, 0xe4, 0x1b, 0x00, 0x96, 0x69, 0x00, 0x4e, 0xb1, 0x00, 0x1e, 0xe1, 0x00, 0x0c, 0xf3, 0x00, 0x1b, 0xe4, 0x00, 0x3c, 0xc3, 0x00, 0x57, 0xa8, 0x00, 0x5d, 0xa2, 0x00, 0x3f, 0xc0, 0x00, 0x03, 0xfc, 0x4b, 0x00, 0xb4, 0x93, 0x00, 0x6c, 0xc3, 0x00, 0x3c, 0xd5, 0x00, 0x2a }, { 0x00, 0xe4, 0x1b, 0x00, 0xf3, 0x0c, 0x12, 0xed, 0x00, 0x30, 0xcf, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xdb, 0x24, 0x00, 0x8d, 0x72, 0x00, 0x45, 0xba, 0x00, 0x12, 0xed, 0x00, 0x03, 0xfc, 0x00, 0x12, 0xed, 0x00, 0x30, 0xcf, 0x00, 0x4e, 0xb1, 0x00, 0x51, 0xae, 0x00, 0x36, 0xc9, 0x06, 0x00, 0xf9, 0x54, 0x00, 0xab, 0x9c, 0x00, 0x63, 0xcf, 0x00, 0x30, 0xde, 0x00, 0x21 } } }, // 17 Audio+Motion, loud_music
+    { 0x83dc005b, { { 0x05, 0x09, 0x00, 0x04, 0x0a, 0x00, 0x02, 0x0b, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x0b, 0x03, 0x00, 0x0a, 0x04, 0x00, 0x09, 0x05, 0x00, 0x08, 0x06, 0x00, 0x06, 0x08, 0x00, 0x05, 0x09, 0x00, 0x04, 0x0a, 0x00, 0x03, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x0b, 0x04, 0x00, 0x0a }, { 0x00, 0x0a, 0x04, 0x00, 0x09, 0x05, 0x00, 0x08, 0x06, 0x00, 0x07, 0x07, 0x00, 0x05, 0x08, 0x00, 0x04, 0x0a, 0x00, 0x03, 0x0b, 0x00, 0x02, 0x0c, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x0c, 0x03, 0x00, 0x0a, 0x05, 0x00, 0x09, 0x06, 0x00, 0x08, 0x07, 0x00, 0x07, 0x08, 0x00, 0x06, 0x09, 0x00, 0x04, 0x0b, 0x00, 0x03, 0x0c, 0x00, 0x02, 0x0d, 0x00, 0x01 }, { 0x00, 0x01, 0x0d, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x0c, 0x03, 0x00, 0x0b, 0x04, 0x00, 0x0a, 0x05, 0x00, 0x08, 0x07, 0x00, 0x07, 0x08, 0x00, 0x06, 0x09, 0x00, 0x05, 0x0a, 0x00, 0x04, 0x0c, 0x00, 0x02, 0x0d, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x0b, 0x03, 0x00, 0x0a, 0x04, 0x00, 0x09, 0x05, 0x00, 0x07, 0x06, 0x00, 0x06, 0x08, 0x00 }, { 0x08, 0x00, 0x06, 0x09, 0x00, 0x05, 0x0a, 0x00, 0x04, 0x0b, 0x00, 0x03, 0x0c, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x0b, 0x02, 0x00, 0x0a, 0x04, 0x00, 0x09, 0x05, 0x00, 0x08, 0x06, 0x00, 0x06, 0x07, 0x00, 0x05, 0x09, 0x00, 0x04, 0x0a, 0x00, 0x03, 0x0b, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x0c, 0x02 } } }, // 18 Audio Peak, slow_swing
+    { 0x83dc005b, { { 0x05, 0x09, 0x00, 0x04, 0x0a, 0x00, 0x02, 0x0b, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x0b, 0x03, 0x00, 0x0a, 0x04, 0x00, 0x09, 0x05, 0x00, 0x08, 0x06, 0x00, 0x06, 0x08, 0x00, 0x05, 0x09, 0x00, 0x04, 0x0a, 0x00, 0x03, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x0b, 0x04, 0x00, 0x0a }, { 0x00, 0x0a, 0x04, 0x00, 0x09, 0x05, 0x00, 0x08, 0x06, 0x00, 0x07, 0x07, 0x00, 0x05, 0x08, 0x00, 0x04, 0x0a, 0x00, 0x03, 0x0b, 0x00, 0x02, 0x0c, 0x00, 0x01, 0x0d, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x0c, 0x03, 0x00, 0x0a, 0x05, 0x00, 0x09, 0x06, 0x00, 0x08, 0x07, 0x00, 0x07, 0x08, 0x00, 0x06, 0x09, 0x00, 0x04, 0x0b, 0x00, 0x03, 0x0c, 0x00, 0x02, 0x0d, 0x00, 0x01 }, { 0x00, 0x01, 0x0d, 0x00, 0x00, 0x0e, 0x01, 0x00, 0x0d, 0x02, 0x00, 0x0c, 0x03, 0x00, 0x0b, 0x04, 0x00, 0x0a, 0x05, 0x00, 0x08, 0x07, 0x00, 0x07, 0x08, 0x00, 0x06, 0x09, 0x00, 0x05, 0x0a, 0x00, 0x04, 0x0c, 0x00, 0x02, 0x0d, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x0b, 0x03, 0x00, 0x0a, 0x04, 0x00, 0x09, 0x05, 0x00, 0x07, 0x06, 0x00, 0x06, 0x08, 0x00 }, { 0x08, 0x00, 0x06, 0x09, 0x00, 0x05, 0x0a, 0x00, 0x04, 0x0b, 0x00, 0x03, 0x0c, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x0b, 0x02, 0x00, 0x0a, 0x04, 0x00, 0x09, 0x05, 0x00, 0x08, 0x06, 0x00, 0x06, 0x07, 0x00, 0x05, 0x09, 0x00, 0x04, 0x0a, 0x00, 0x03, 0x0b, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x0c, 0x02 } } }, // 18 Audio Peak, fast_spin
+    { 0x04008612, { { 0x05, 0x07, 0x00, 0x04, 0x08, 0x00, 0x03, 0x09, 0x00, 0x02, 0x0a, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x09, 0x02, 0x00, 0x08, 0x04, 0x00, 0x07, 0x05, 0x00, 0x06, 0x06, 0x00, 0x05, 0x07, 0x00, 0x04, 0x08, 0x00, 0x03, 0x09, 0x00, 0x02, 0x0a, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x0a, 0x02, 0x00, 0x09 }, { 0x00, 0x0a, 0x02, 0x00, 0x09, 0x03, 0x00, 0x08, 0x04, 0x00, 0x07, 0x05, 0x00, 0x06, 0x06, 0x00, 0x05, 0x07, 0x00, 0x04, 0x08, 0x00, 0x03, 0x09, 0x00, 0x02, 0x0a, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x0a, 0x02, 0x00, 0x09, 0x04, 0x00, 0x08, 0x05, 0x00, 0x07, 0x06, 0x00, 0x06, 0x07, 0x00, 0x05, 0x08, 0x00, 0x04, 0x09, 0x00, 0x03, 0x0a, 0x00, 0x02 }, { 0x00, 0x03, 0x09, 0x00, 0x02, 0x0a, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x0b, 0x02, 0x00, 0x0a, 0x03, 0x00, 0x09, 0x04, 0x00, 0x08, 0x05, 0x00, 0x07, 0x06, 0x00, 0x06, 0x07, 0x00, 0x05, 0x08, 0x00, 0x04, 0x09, 0x00, 0x03, 0x0a, 0x00, 0x02, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x09, 0x02, 0x00, 0x08, 0x04, 0x00, 0x07, 0x05, 0x00 }, { 0x04, 0x00, 0x08, 0x05, 0x00, 0x07, 0x06, 0x00, 0x06, 0x07, 0x00, 0x05, 0x08, 0x00, 0x04, 0x09, 0x00, 0x03, 0x0a, 0x00, 0x02, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x0a, 0x02, 0x00, 0x09, 0x03, 0x00, 0x08, 0x04, 0x00, 0x07, 0x05, 0x00, 0x06, 0x06, 0x00, 0x05, 0x07, 0x00, 0x04, 0x08, 0x00, 0x03, 0x09, 0x00, 0x02, 0x0a, 0x00, 0x01, 0x0b, 0x00, 0x00, 0x0c, 0x00 } } }, // 18 Audio Peak, silence
+    { 0xe43a1125, { { 0x00, 0x4b, 0x69, 0x00, 0x4b, 0x77, 0x00, 0x45, 0x7e, 0x00, 0x37, 0x7d, 0x00, 0x2a, 0x7d, 0x00, 0x1d, 0x7e, 0x06, 0x19, 0x71, 0x0d, 0x15, 0x64, 0x14, 0x11, 0x57, 0x1a, 0x0f, 0x4c, 0x20, 0x0d, 0x41, 0x26, 0x0b, 0x36, 0x2b, 0x09, 0x2d, 0x30, 0x08, 0x24, 0x34, 0x06, 0x1c, 0x38, 0x05, 0x14, 0x3c, 0x05, 0x0d, 0x40, 0x04, 0x06, 0x3a, 0x08, 0x05, 0x33, 0x0c, 0x04, 0x2d, 0x10, 0x03 }, { 0x57, 0x4b, 0x00, 0x51, 0x5d, 0x00, 0x4a, 0x70, 0x00, 0x44, 0x84, 0x00, 0x3f, 0x99, 0x00, 0x38, 0xa1, 0x00, 0x31, 0x99, 0x00, 0x28, 0x94, 0x00, 0x1f, 0x90, 0x00, 0x15, 0x8e, 0x00, 0x0c, 0x8d, 0x00, 0x0a, 0x7e, 0x07, 0x08, 0x6f, 0x0e, 0x07, 0x62, 0x15, 0x06, 0x55, 0x1c, 0x05, 0x49, 0x22, 0x04, 0x3e, 0x28, 0x04, 0x34, 0x2e, 0x03, 0x2a, 0x33, 0x02, 0x20, 0x38, 0x02, 0x18, 0x3d }, { 0x0c, 0x10, 0xc3, 0x0e, 0x08, 0xd9, 0x0f, 0x02, 0xe9, 0x0d, 0x00, 0xdd, 0x13, 0x00, 0xc8, 0x18, 0x00, 0xb4, 0x1e, 0x00, 0xa0, 0x26, 0x00, 0x8d, 0x2d, 0x00, 0x7a, 0x34, 0x00, 0x6a, 0x3b, 0x00, 0x59, 0x42, 0x00, 0x4a, 0x49, 0x00, 0x3c, 0x4f, 0x00, 0x2f, 0x55, 0x00, 0x23, 0x5a, 0x00, 0x17, 0x51, 0x06, 0x14, 0x48, 0x0e, 0x12, 0x40, 0x14, 0x0f, 0x38, 0x1a, 0x0d, 0x30, 0x20, 0x0c }, { 0xa5, 0x56, 0x00, 0xa4, 0x5a, 0x00, 0xa0, 0x5e, 0x00, 0x96, 0x64, 0x00, 0x82, 0x68, 0x00, 0x6e, 0x6c, 0x00, 0x5b, 0x72, 0x00, 0x49, 0x78, 0x00, 0x38, 0x7c, 0x00, 0x30, 0x71, 0x08, 0x2a, 0x66, 0x11, 0x24, 0x5c, 0x19, 0x1f, 0x51, 0x21, 0x1a, 0x46, 0x29, 0x17, 0x3c, 0x31, 0x14, 0x31, 0x38, 0x11, 0x28, 0x3f, 0x0f, 0x1e, 0x46, 0x0d, 0x16, 0x4c, 0x0b, 0x0d, 0x52, 0x0a, 0x05, 0x59 } } }, // 18 Audio Peak, loud_music
+    { 0x8e563142, { { 0x00, 0x1c, 0x00, 0x00, 0x15, 0x07, 0x00, 0x0c, 0x0f, 0x00, 0x04, 0x18, 0x03, 0x00, 0x19, 0x0b, 0x00, 0x11, 0x14, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00, 0x0c, 0x10, 0x00, 0x04, 0x18, 0x00, 0x00, 0x18, 0x04, 0x00, 0x0f, 0x0c, 0x00, 0x07, 0x15, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x14, 0x11, 0x00, 0x0b, 0x19, 0x00, 0x03, 0x17, 0x05, 0x00, 0x0f, 0x0d, 0x00, 0x07, 0x15, 0x00 }, { 0x00, 0x00, 0x1b, 0x07, 0x00, 0x15, 0x0f, 0x00, 0x0c, 0x17, 0x00, 0x04, 0x18, 0x03, 0x00, 0x10, 0x0c, 0x00, 0x08, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00, 0x0c, 0x10, 0x00, 0x03, 0x18, 0x04, 0x00, 0x18, 0x0c, 0x00, 0x0f, 0x14, 0x00, 0x07, 0x1b, 0x00, 0x00, 0x13, 0x08, 0x00, 0x0b, 0x11, 0x00, 0x03, 0x19, 0x00, 0x00, 0x17, 0x05, 0x00, 0x0f, 0x0d, 0x00, 0x07, 0x15 }, { 0x1c, 0x00, 0x00, 0x15, 0x07, 0x00, 0x0c, 0x0f, 0x00, 0x04, 0x18, 0x00, 0x00, 0x19, 0x03, 0x00, 0x10, 0x0c, 0x00, 0x08, 0x14, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x14, 0x10, 0x00, 0x0c, 0x19, 0x00, 0x03, 0x18, 0x04, 0x00, 0x0f, 0x0c, 0x00, 0x07, 0x15, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x09, 0x00, 0x0b, 0x11, 0x00, 0x03, 0x19, 0x05, 0x00, 0x17, 0x0d, 0x00, 0x0f, 0x15, 0x00, 0x07 }, { 0x00, 0x1c, 0x00, 0x00, 0x15, 0x07, 0x00, 0x0c, 0x0f, 0x00, 0x04, 0x18, 0x03, 0x00, 0x19, 0x0c, 0x00, 0x10, 0x14, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00, 0x0c, 0x10, 0x00, 0x03, 0x19, 0x00, 0x00, 0x18, 0x04, 0x00, 0x0f, 0x0c, 0x00, 0x07, 0x15, 0x00, 0x00, 0x1c, 0x09, 0x00, 0x13, 0x11, 0x00, 0x0b, 0x19, 0x00, 0x03, 0x17, 0x05, 0x00, 0x0f, 0x0d, 0x00, 0x06, 0x16, 0x00 } } }, // 19 Audio Rainbow, slow_swing
+    { 0x8e563142, { { 0x00, 0x1c, 0x00, 0x00, 0x15, 0x07, 0x00, 0x0c, 0x0f, 0x00, 0x04, 0x18, 0x03, 0x00, 0x19, 0x0b, 0x00, 0x11, 0x14, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00, 0x0c, 0x10, 0x00, 0x04, 0x18, 0x00, 0x00, 0x18, 0x04, 0x00, 0x0f, 0x0c, 0x00, 0x07, 0x15, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x14, 0x11, 0x00, 0x0b, 0x19, 0x00, 0x03, 0x17, 0x05, 0x00, 0x0f, 0x0d, 0x00, 0x07, 0x15, 0x00 }, { 0x00, 0x00, 0x1b, 0x07, 0x00, 0x15, 0x0f, 0x00, 0x0c, 0x17, 0x00, 0x04, 0x18, 0x03, 0x00, 0x10, 0x0c, 0x00, 0x08, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00, 0x0c, 0x10, 0x00, 0x03, 0x18, 0x04, 0x00, 0x18, 0x0c, 0x00, 0x0f, 0x14, 0x00, 0x07, 0x1b, 0x00, 0x00, 0x13, 0x08, 0x00, 0x0b, 0x11, 0x00, 0x03, 0x19, 0x00, 0x00, 0x17, 0x05, 0x00, 0x0f, 0x0d, 0x00, 0x07, 0x15 }, { 0x1c, 0x00, 0x00, 0x15, 0x07, 0x00, 0x0c, 0x0f, 0x00, 0x04, 0x18, 0x00, 0x00, 0x19, 0x03, 0x00, 0x10, 0x0c, 0x00, 0x08, 0x14, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x14, 0x10, 0x00, 0x0c, 0x19, 0x00, 0x03, 0x18, 0x04, 0x00, 0x0f, 0x0c, 0x00, 0x07, 0x15, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x09, 0x00, 0x0b, 0x11, 0x00, 0x03, 0x19, 0x05, 0x00, 0x17, 0x0d, 0x00, 0x0f, 0x15, 0x00, 0x07 }, { 0x00, 0x1c, 0x00, 0x00, 0x15, 0x07, 0x00, 0x0c, 0x0f, 0x00, 0x04, 0x18, 0x03, 0x00, 0x19, 0x0c, 0x00, 0x10, 0x14, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00, 0x0c, 0x10, 0x00, 0x03, 0x19, 0x00, 0x00, 0x18, 0x04, 0x00, 0x0f, 0x0c, 0x00, 0x07, 0x15, 0x00, 0x00, 0x1c, 0x09, 0x00, 0x13, 0x11, 0x00, 0x0b, 0x19, 0x00, 0x03, 0x17, 0x05, 0x00, 0x0f, 0x0d, 0x00, 0x06, 0x16, 0x00 } } }, // 19 Audio Rainbow, fast_spin
+    { 0xdb95afcb, { { 0x14, 0x08, 0x00, 0x0c, 0x10, 0x00, 0x04, 0x18, 0x00, 0x00, 0x18, 0x04, 0x00, 0x10, 0x0c, 0x00, 0x08, 0x14, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x14, 0x10, 0x00, 0x0c, 0x18, 0x00, 0x04, 0x18, 0x04, 0x00, 0x10, 0x0c, 0x00, 0x08, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00, 0x0c, 0x10, 0x00, 0x04, 0x18, 0x04, 0x00, 0x18, 0x0c, 0x00, 0x10, 0x14, 0x00, 0x08, 0x1c, 0x00, 0x00 }, { 0x0b, 0x10, 0x00, 0x03, 0x18, 0x00, 0x00, 0x18, 0x04, 0x00, 0x10, 0x0c, 0x00, 0x07, 0x14, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x14, 0x10, 0x00, 0x0b, 0x18, 0x00, 0x03, 0x18, 0x04, 0x00, 0x10, 0x0c, 0x00, 0x07, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00, 0x0b, 0x10, 0x00, 0x03, 0x18, 0x04, 0x00, 0x18, 0x0c, 0x00, 0x10, 0x14, 0x00, 0x07, 0x1c, 0x00, 0x00, 0x14, 0x08, 0x00 }, { 0x03, 0x19, 0x00, 0x00, 0x17, 0x04, 0x00, 0x0f, 0x0c, 0x00, 0x07, 0x14, 0x00, 0x00, 0x1c, 0x08, 0x00, 0x13, 0x10, 0x00, 0x0b, 0x19, 0x00, 0x03, 0x17, 0x04, 0x00, 0x0f, 0x0c, 0x00, 0x07, 0x14, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x08, 0x00, 0x0b, 0x10, 0x00, 0x03, 0x19, 0x04, 0x00, 0x17, 0x0c, 0x00, 0x0f, 0x14, 0x00, 0x07, 0x1c, 0x00, 0x00, 0x13, 0x08, 0x00, 0x0b, 0x10, 0x00 }, { 0x00, 0x17, 0x05, 0x00, 0x0f, 0x0d, 0x00, 0x07, 0x15, 0x00, 0x00, 0x1c, 0x09, 0x00, 0x13, 0x11, 0x00, 0x0b, 0x19, 0x00, 0x03, 0x17, 0x05, 0x00, 0x0f, 0x0d, 0x00, 0x07, 0x15, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x09, 0x00, 0x0b, 0x11, 0x00, 0x03, 0x19, 0x05, 0x00, 0x17, 0x0d, 0x00, 0x0f, 0x15, 0x00, 0x07, 0x1c, 0x00, 0x00, 0x13, 0x09, 0x00, 0x0b, 0x11, 0x00, 0x03, 0x19, 0x00 } } }, // 19 Audio Rainbow, silence
+    { 0x693fd1a7, { { 0x40, 0x00, 0x16, 0x4f, 0x08, 0x00, 0x2f, 0x28, 0x00, 0x10, 0x46, 0x00, 0x00, 0x48, 0x0e, 0x00, 0x2a, 0x2d, 0x00, 0x0a, 0x4d, 0x14, 0x00, 0x42, 0x33, 0x00, 0x23, 0x52, 0x00, 0x05, 0x3d, 0x19, 0x00, 0x1d, 0x39, 0x00, 0x00, 0x56, 0x01, 0x00, 0x37, 0x1f, 0x00, 0x18, 0x3e, 0x06, 0x00, 0x51, 0x26, 0x00, 0x31, 0x44, 0x00, 0x12, 0x4b, 0x0c, 0x00, 0x2c, 0x2b, 0x00, 0x0d, 0x49, 0x00 }, { 0x62, 0x00, 0x06, 0x48, 0x1f, 0x00, 0x22, 0x46, 0x00, 0x00, 0x66, 0x02, 0x00, 0x3f, 0x28, 0x00, 0x19, 0x4e, 0x0b, 0x00, 0x5d, 0x31, 0x00, 0x37, 0x56, 0x00, 0x12, 0x54, 0x13, 0x00, 0x2e, 0x39, 0x00, 0x09, 0x5e, 0x00, 0x00, 0x4c, 0x1c, 0x00, 0x26, 0x42, 0x00, 0x01, 0x67, 0x24, 0x00, 0x43, 0x4b, 0x00, 0x1d, 0x61, 0x07, 0x00, 0x3b, 0x2d, 0x00, 0x14, 0x53, 0x00, 0x00, 0x58, 0x0f }, { 0x6a, 0x0f, 0x00, 0x3d, 0x3c, 0x00, 0x11, 0x68, 0x00, 0x00, 0x5e, 0x1b, 0x00, 0x32, 0x47, 0x00, 0x05, 0x74, 0x26, 0x00, 0x53, 0x53, 0x00, 0x26, 0x74, 0x05, 0x00, 0x49, 0x30, 0x00, 0x1c, 0x5d, 0x00, 0x00, 0x6a, 0x0f, 0x00, 0x3d, 0x3c, 0x00, 0x11, 0x68, 0x1b, 0x00, 0x5e, 0x47, 0x00, 0x32, 0x74, 0x00, 0x05, 0x54, 0x25, 0x00, 0x28, 0x51, 0x00, 0x00, 0x75, 0x04, 0x00, 0x49, 0x30 }, { 0x4c, 0x23, 0x00, 0x23, 0x4c, 0x00, 0x00, 0x6b, 0x05, 0x00, 0x42, 0x2e, 0x00, 0x19, 0x57, 0x0e, 0x00, 0x61, 0x37, 0x00, 0x38, 0x60, 0x00, 0x0f, 0x57, 0x19, 0x00, 0x2e, 0x42, 0x00, 0x05, 0x6b, 0x00, 0x00, 0x4e, 0x22, 0x00, 0x25, 0x4b, 0x03, 0x00, 0x6c, 0x2c, 0x00, 0x43, 0x56, 0x00, 0x1a, 0x63, 0x0d, 0x00, 0x3a, 0x36, 0x00, 0x11, 0x5f, 0x00, 0x00, 0x58, 0x17, 0x00, 0x2f, 0x40 } } }, // 19 Audio Rainbow, loud_music
+    { 0x24ede060, { { 0x0e, 0x03, 0x00, 0x0d, 0x04, 0x00, 0x0c, 0x05, 0x00, 0x0b, 0x06, 0x00, 0x0a, 0x07, 0x00, 0x09, 0x09, 0x00, 0x08, 0x0a, 0x00, 0x07, 0x0b, 0x00, 0x06, 0x0c, 0x00, 0x04, 0x0d, 0x00, 0x03, 0x0e, 0x00, 0x02, 0x0f, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x10, 0x01, 0x00, 0x0f, 0x02, 0x00, 0x0e, 0x03, 0x00, 0x0d, 0x04, 0x00, 0x0c, 0x05, 0x00, 0x0b, 0x06 }, { 0x0b, 0x07, 0x00, 0x0a, 0x08, 0x00, 0x09, 0x09, 0x00, 0x08, 0x0a, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0e, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x10, 0x00, 0x01, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x02, 0x00, 0x0f, 0x03, 0x00, 0x0e, 0x04, 0x00, 0x0d, 0x05, 0x00, 0x0c, 0x06, 0x00, 0x0b, 0x07, 0x00, 0x0a, 0x08, 0x00, 0x09, 0x09, 0x00, 0x08, 0x0a }, { 0x06, 0x0a, 0x00, 0x05, 0x0b, 0x00, 0x04, 0x0c, 0x00, 0x03, 0x0d, 0x00, 0x02, 0x0e, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x0e, 0x02, 0x00, 0x0d, 0x03, 0x00, 0x0c, 0x04, 0x00, 0x0b, 0x05, 0x00, 0x0a, 0x06, 0x00, 0x09, 0x07, 0x00, 0x08, 0x08, 0x00, 0x07, 0x09, 0x00, 0x06, 0x0a, 0x00, 0x05, 0x0b, 0x00, 0x04, 0x0c, 0x00, 0x03, 0x0d }, { 0x02, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x0b, 0x02, 0x00, 0x0a, 0x03, 0x00, 0x09, 0x04, 0x00, 0x09, 0x04, 0x00, 0x08, 0x05, 0x00, 0x07, 0x06, 0x00, 0x06, 0x07, 0x00, 0x05, 0x08, 0x00, 0x04, 0x09, 0x00, 0x04, 0x09, 0x00, 0x03, 0x0a, 0x00, 0x02, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d } } }, // 20 Audio VU Meter, slow_swing
+    { 0x24ede060, { { 0x0e, 0x03, 0x00, 0x0d, 0x04, 0x00, 0x0c, 0x05, 0x00, 0x0b, 0x06, 0x00, 0x0a, 0x07, 0x00, 0x09, 0x09, 0x00, 0x08, 0x0a, 0x00, 0x07, 0x0b, 0x00, 0x06, 0x0c, 0x00, 0x04, 0x0d, 0x00, 0x03, 0x0e, 0x00, 0x02, 0x0f, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x10, 0x01, 0x00, 0x0f, 0x02, 0x00, 0x0e, 0x03, 0x00, 0x0d, 0x04, 0x00, 0x0c, 0x05, 0x00, 0x0b, 0x06 }, { 0x0b, 0x07, 0x00, 0x0a, 0x08, 0x00, 0x09, 0x09, 0x00, 0x08, 0x0a, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0e, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x10, 0x00, 0x01, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x02, 0x00, 0x0f, 0x03, 0x00, 0x0e, 0x04, 0x00, 0x0d, 0x05, 0x00, 0x0c, 0x06, 0x00, 0x0b, 0x07, 0x00, 0x0a, 0x08, 0x00, 0x09, 0x09, 0x00, 0x08, 0x0a }, { 0x06, 0x0a, 0x00, 0x05, 0x0b, 0x00, 0x04, 0x0c, 0x00, 0x03, 0x0d, 0x00, 0x02, 0x0e, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x0e, 0x02, 0x00, 0x0d, 0x03, 0x00, 0x0c, 0x04, 0x00, 0x0b, 0x05, 0x00, 0x0a, 0x06, 0x00, 0x09, 0x07, 0x00, 0x08, 0x08, 0x00, 0x07, 0x09, 0x00, 0x06, 0x0a, 0x00, 0x05, 0x0b, 0x00, 0x04, 0x0c, 0x00, 0x03, 0x0d }, { 0x02, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x0b, 0x02, 0x00, 0x0a, 0x03, 0x00, 0x09, 0x04, 0x00, 0x09, 0x04, 0x00, 0x08, 0x05, 0x00, 0x07, 0x06, 0x00, 0x06, 0x07, 0x00, 0x05, 0x08, 0x00, 0x04, 0x09, 0x00, 0x04, 0x09, 0x00, 0x03, 0x0a, 0x00, 0x02, 0x0b, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x0d } } }, // 20 Audio VU Meter, fast_spin
+    { 0x0f37d1f9, { { 0x0f, 0x02, 0x00, 0x0e, 0x03, 0x00, 0x0c, 0x04, 0x00, 0x0b, 0x05, 0x00, 0x0a, 0x06, 0x00, 0x09, 0x07, 0x00, 0x08, 0x08, 0x00, 0x07, 0x09, 0x00, 0x06, 0x0a, 0x00, 0x05, 0x0b, 0x00, 0x04, 0x0c, 0x00, 0x03, 0x0d, 0x00, 0x02, 0x0e, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x10, 0x01, 0x00, 0x0f, 0x02, 0x00, 0x0e, 0x03, 0x00, 0x0c, 0x04, 0x00, 0x0b, 0x05 }, { 0x0d, 0x05, 0x00, 0x0c, 0x06, 0x00, 0x0b, 0x07, 0x00, 0x0a, 0x08, 0x00, 0x08, 0x0a, 0x00, 0x07, 0x0b, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0e, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x10, 0x00, 0x01, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x01, 0x00, 0x10, 0x02, 0x00, 0x0f, 0x03, 0x00, 0x0e, 0x04, 0x00, 0x0d, 0x05, 0x00, 0x0c, 0x06, 0x00, 0x0b, 0x07, 0x00, 0x0a, 0x08 }, { 0x0a, 0x08, 0x00, 0x09, 0x09, 0x00, 0x08, 0x0a, 0x00, 0x07, 0x0b, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0e, 0x00, 0x02, 0x10, 0x00, 0x01, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x11, 0x01, 0x00, 0x10, 0x02, 0x00, 0x0f, 0x03, 0x00, 0x0e, 0x04, 0x00, 0x0c, 0x06, 0x00, 0x0b, 0x07, 0x00, 0x0a, 0x08, 0x00, 0x09, 0x09, 0x00, 0x08, 0x0a, 0x00, 0x07, 0x0b }, { 0x07, 0x0a, 0x00, 0x06, 0x0b, 0x00, 0x05, 0x0c, 0x00, 0x04, 0x0d, 0x00, 0x03, 0x0e, 0x00, 0x02, 0x0f, 0x00, 0x01, 0x10, 0x00, 0x00, 0x11, 0x00, 0x00, 0x10, 0x01, 0x00, 0x0f, 0x02, 0x00, 0x0e, 0x03, 0x00, 0x0d, 0x04, 0x00, 0x0c, 0x05, 0x00, 0x0b, 0x06, 0x00, 0x0a, 0x07, 0x00, 0x09, 0x08, 0x00, 0x08, 0x09, 0x00, 0x07, 0x0a, 0x00, 0x06, 0x0b, 0x00, 0x05, 0x0c, 0x00, 0x04, 0x0d } } }, // 20 Audio VU Meter, silence
+    { 0x15907e26, { { 0x00, 0xb7, 0x3f, 0x00, 0x9f, 0x57, 0x00, 0x85, 0x71, 0x00, 0x6e, 0x88, 0x00, 0x54, 0xa2, 0x00, 0x3d, 0xba, 0x00, 0x22, 0xd4, 0x00, 0x0b, 0xeb, 0x0e, 0x00, 0xe8, 0x25, 0x00, 0xd1, 0x3f, 0x00, 0xb7, 0x57, 0x00, 0x9f, 0x71, 0x00, 0x85, 0x88, 0x00, 0x6e, 0xa2, 0x00, 0x54, 0x01, 0x00, 0x0a, 0x02, 0x00, 0x0a, 0x03, 0x00, 0x09, 0x04, 0x00, 0x08, 0x04, 0x00, 0x07, 0x05, 0x00, 0x07 }, { 0x87, 0x00, 0x78, 0xa2, 0x00, 0x5d, 0xba, 0x00, 0x45, 0xd5, 0x00, 0x2a, 0xed, 0x00, 0x12, 0xf6, 0x09, 0x00, 0xde, 0x21, 0x00, 0xc3, 0x3c, 0x00, 0xab, 0x54, 0x00, 0x90, 0x6f, 0x00, 0x78, 0x87, 0x00, 0x5d, 0xa2, 0x00, 0x45, 0xba, 0x00, 0x2a, 0xd5, 0x00, 0x12, 0xed, 0x00, 0x00, 0xf6, 0x09, 0x00, 0xde, 0x21, 0x05, 0x06, 0x00, 0x05, 0x07, 0x00, 0x04, 0x08, 0x00, 0x03, 0x08, 0x00 }, { 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x00, 0x00, 0xe4, 0x1b, 0x00, 0xcc, 0x33, 0x00, 0xb1, 0x4e, 0x00, 0x99, 0x66, 0x00, 0x7e, 0x81, 0x00, 0x66, 0x99, 0x00, 0x4b, 0xb4, 0x00, 0x33, 0xcc, 0x00, 0x18, 0xe7, 0x00, 0x00, 0xff, 0x1b, 0x00, 0xe4, 0x33, 0x00, 0xcc, 0x4e, 0x00, 0xb1, 0x66, 0x00, 0x99, 0x81, 0x00, 0x7e, 0x00, 0x01, 0x0c, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x0d }, { 0x15, 0x00, 0xea, 0x2d, 0x00, 0xd2, 0x48, 0x00, 0xb7, 0x60, 0x00, 0x9f, 0x7b, 0x00, 0x84, 0x93, 0x00, 0x6c, 0xae, 0x00, 0x51, 0xc6, 0x00, 0x39, 0xe1, 0x00, 0x1e, 0xf9, 0x00, 0x06, 0xea, 0x15, 0x00, 0xd2, 0x2d, 0x00, 0xb7, 0x48, 0x00, 0x9f, 0x60, 0x00, 0x84, 0x7b, 0x00, 0x6c, 0x93, 0x00, 0x51, 0xae, 0x00, 0x0f, 0x01, 0x00, 0x0e, 0x02, 0x00, 0x0d, 0x03, 0x00, 0x0c, 0x04, 0x00 } } }, // 20 Audio VU Meter, loud_music
+    { 0x1d946fc5, { { 0x2c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00 } } }, // 21 Audio Beat Fade, slow_swing
+    { 0x1d946fc5, { { 0x2c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x2d, 0x00, 0x00 } } }, // 21 Audio Beat Fade, fast_spin
+    { 0x860b30c5, { { 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00 }, { 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x2c, 0x00, 0x00 } } }, // 21 Audio Beat Fade, silence
+    { 0x6872c6e9, { { 0x03, 0x6c, 0x00, 0x04, 0x71, 0x00, 0x04, 0x75, 0x00, 0x04, 0x7a, 0x00, 0x04, 0x7e, 0x00, 0x04, 0x82, 0x00, 0x04, 0x86, 0x00, 0x05, 0x88, 0x00, 0x05, 0x8b, 0x00, 0x05, 0x8c, 0x00, 0x05, 0x8d, 0x00, 0x05, 0x8d, 0x00, 0x05, 0x8c, 0x00, 0x05, 0x8b, 0x00, 0x05, 0x88, 0x00, 0x04, 0x86, 0x00, 0x04, 0x82, 0x00, 0x04, 0x7e, 0x00, 0x04, 0x7a, 0x00, 0x04, 0x75, 0x00, 0x04, 0x71, 0x00 }, { 0x00, 0x1a, 0x69, 0x00, 0x1b, 0x6f, 0x00, 0x1d, 0x75, 0x00, 0x1e, 0x7a, 0x00, 0x1f, 0x7f, 0x00, 0x20, 0x83, 0x00, 0x21, 0x87, 0x00, 0x22, 0x8b, 0x00, 0x23, 0x8d, 0x00, 0x23, 0x8f, 0x00, 0x24, 0x90, 0x00, 0x24, 0x90, 0x00, 0x23, 0x8f, 0x00, 0x23, 0x8d, 0x00, 0x22, 0x8b, 0x00, 0x21, 0x87, 0x00, 0x20, 0x83, 0x00, 0x1f, 0x7f, 0x00, 0x1e, 0x7a, 0x00, 0x1d, 0x75, 0x00, 0x1b, 0x6f }, { 0x00, 0x8b, 0x0c, 0x00, 0x93, 0x0d, 0x00, 0x9c, 0x0e, 0x00, 0xa4, 0x0e, 0x00, 0xab, 0x0f, 0x00, 0xb2, 0x0f, 0x00, 0xb7, 0x10, 0x00, 0xbc, 0x10, 0x00, 0xc0, 0x11, 0x00, 0xc2, 0x11, 0x00, 0xc4, 0x11, 0x00, 0xc4, 0x11, 0x00, 0xc2, 0x11, 0x00, 0xc0, 0x11, 0x00, 0xbc, 0x10, 0x00, 0xb7, 0x10, 0x00, 0xb2, 0x0f, 0x00, 0xab, 0x0f, 0x00, 0xa4, 0x0e, 0x00, 0x9c, 0x0e, 0x00, 0x93, 0x0d }, { 0x00, 0x67, 0x44, 0x00, 0x6d, 0x49, 0x00, 0x74, 0x4d, 0x00, 0x7a, 0x51, 0x00, 0x80, 0x55, 0x00, 0x85, 0x59, 0x00, 0x8a, 0x5c, 0x00, 0x8e, 0x5e, 0x00, 0x91, 0x60, 0x00, 0x93, 0x62, 0x00, 0x94, 0x62, 0x00, 0x94, 0x62, 0x00, 0x93, 0x62, 0x00, 0x91, 0x60, 0x00, 0x8e, 0x5e, 0x00, 0x8a, 0x5c, 0x00, 0x86, 0x59, 0x00, 0x80, 0x55, 0x00, 0x7a, 0x51, 0x00, 0x74, 0x4d, 0x00, 0x6d, 0x49 } } }, // 21 Audio Beat Fade, loud_music
+    { 0xe2c4b299, { { 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x0a, 0x09, 0x00, 0x0a, 0x08, 0x00, 0x0b, 0x08, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0d, 0x06, 0x00, 0x0d, 0x05, 0x00, 0x0e, 0x04, 0x00, 0x0e, 0x04, 0x00, 0x0f, 0x03, 0x00, 0x10, 0x02, 0x00, 0x10, 0x02, 0x00, 0x11, 0x02, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00 }, { 0x06, 0x0d, 0x00, 0x06, 0x0c, 0x00, 0x07, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x0a, 0x08, 0x00, 0x0b, 0x08, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x08, 0x00, 0x0a, 0x08, 0x00 }, { 0x05, 0x0d, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0d, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0e, 0x00, 0x04, 0x0e, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x10, 0x00, 0x02, 0x11, 0x00, 0x01, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x13, 0x00, 0x00, 0x12, 0x00 }, { 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0d, 0x05, 0x00, 0x0e, 0x05, 0x00, 0x0e, 0x04, 0x00, 0x0f, 0x03, 0x00, 0x10, 0x03, 0x00, 0x10, 0x02, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x12, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x12, 0x00 } } }, // 22 Audio Lava, slow_swing
+    { 0xe2c4b299, { { 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x0a, 0x09, 0x00, 0x0a, 0x08, 0x00, 0x0b, 0x08, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0d, 0x06, 0x00, 0x0d, 0x05, 0x00, 0x0e, 0x04, 0x00, 0x0e, 0x04, 0x00, 0x0f, 0x03, 0x00, 0x10, 0x02, 0x00, 0x10, 0x02, 0x00, 0x11, 0x02, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00 }, { 0x06, 0x0d, 0x00, 0x06, 0x0c, 0x00, 0x07, 0x0b, 0x00, 0x08, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x0a, 0x08, 0x00, 0x0b, 0x08, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x08, 0x00, 0x0a, 0x08, 0x00 }, { 0x05, 0x0d, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0d, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0e, 0x00, 0x04, 0x0e, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x10, 0x00, 0x02, 0x11, 0x00, 0x01, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00, 0x00, 0x13, 0x00, 0x00, 0x12, 0x00 }, { 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0d, 0x05, 0x00, 0x0e, 0x05, 0x00, 0x0e, 0x04, 0x00, 0x0f, 0x03, 0x00, 0x10, 0x03, 0x00, 0x10, 0x02, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x12, 0x00, 0x00, 0x13, 0x00, 0x00, 0x13, 0x00, 0x00, 0x12, 0x00 } } }, // 22 Audio Lava, fast_spin
+    { 0xed2c1ddb, { { 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x0a, 0x08, 0x00, 0x0a, 0x08, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0d, 0x05, 0x00, 0x0d, 0x05, 0x00, 0x0e, 0x04, 0x00, 0x0f, 0x04, 0x00, 0x0f, 0x03, 0x00, 0x10, 0x02, 0x00, 0x10, 0x02, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00 }, { 0x05, 0x0d, 0x00, 0x05, 0x0d, 0x00, 0x06, 0x0c, 0x00, 0x07, 0x0b, 0x00, 0x07, 0x0b, 0x00, 0x08, 0x0a, 0x00, 0x09, 0x09, 0x00, 0x09, 0x09, 0x00, 0x0a, 0x08, 0x00, 0x0a, 0x08, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00 }, { 0x04, 0x0e, 0x00, 0x05, 0x0d, 0x00, 0x05, 0x0d, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x06, 0x0c, 0x00, 0x05, 0x0d, 0x00, 0x05, 0x0d, 0x00, 0x04, 0x0e, 0x00, 0x04, 0x0e, 0x00, 0x03, 0x0f, 0x00, 0x02, 0x10, 0x00, 0x02, 0x10, 0x00, 0x01, 0x11, 0x00, 0x00, 0x12, 0x00, 0x00, 0x12, 0x00 }, { 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0b, 0x07, 0x00, 0x0c, 0x06, 0x00, 0x0c, 0x06, 0x00, 0x0d, 0x06, 0x00, 0x0d, 0x05, 0x00, 0x0e, 0x04, 0x00, 0x0e, 0x04, 0x00, 0x0f, 0x03, 0x00, 0x10, 0x02, 0x00, 0x10, 0x02, 0x00, 0x11, 0x01, 0x00, 0x11, 0x01, 0x00, 0x12, 0x00 } } }, // 22 Audio Lava, silence
+    { 0x449dce35, { { 0x68, 0x25, 0x00, 0x6a, 0x22, 0x00, 0x6d, 0x20, 0x00, 0x6e, 0x1e, 0x00, 0x70, 0x1c, 0x00, 0x72, 0x1b, 0x00, 0x73, 0x19, 0x00, 0x43, 0x38, 0x0f, 0x43, 0x38, 0x0f, 0x43, 0x38, 0x0f, 0x43, 0x38, 0x0f, 0x42, 0x39, 0x0f, 0x41, 0x39, 0x0f, 0x40, 0x3a, 0x0f, 0x32, 0x06, 0x0e, 0x31, 0x07, 0x0e, 0x2f, 0x09, 0x0e, 0x2d, 0x0b, 0x0e, 0x2c, 0x0c, 0x0e, 0x2a, 0x0e, 0x0e, 0x28, 0x10, 0x0e }, { 0x38, 0x66, 0x00, 0x39, 0x64, 0x00, 0x3c, 0x61, 0x00, 0x3f, 0x5e, 0x00, 0x42, 0x5c, 0x00, 0x44, 0x59, 0x00, 0x46, 0x57, 0x00, 0x27, 0x4a, 0x2c, 0x29, 0x48, 0x2c, 0x2a, 0x47, 0x2c, 0x2c, 0x45, 0x2c, 0x2e, 0x43, 0x2c, 0x2f, 0x42, 0x2c, 0x2f, 0x41, 0x2c, 0x2a, 0x12, 0x08, 0x2a, 0x12, 0x08, 0x2a, 0x12, 0x08, 0x29, 0x13, 0x08, 0x28, 0x14, 0x08, 0x27, 0x15, 0x08, 0x26, 0x16, 0x08 }, { 0x0b, 0x9c, 0x07, 0x0b, 0x9d, 0x06, 0x0b, 0x9d, 0x06, 0x0b, 0x9f, 0x04, 0x0b, 0xa0, 0x03, 0x0b, 0xa2, 0x01, 0x0c, 0xa3, 0x00, 0x02, 0x5a, 0x5b, 0x05, 0x58, 0x5b, 0x07, 0x56, 0x5b, 0x0a, 0x53, 0x5b, 0x0d, 0x51, 0x5b, 0x0f, 0x4e, 0x5b, 0x12, 0x4b, 0x5b, 0x1b, 0x28, 0x03, 0x1c, 0x27, 0x03, 0x1d, 0x26, 0x03, 0x1e, 0x24, 0x03, 0x1f, 0x24, 0x03, 0x1f, 0x24, 0x03, 0x1f, 0x24, 0x03 }, { 0x00, 0xa1, 0x32, 0x00, 0xa0, 0x33, 0x00, 0x9f, 0x34, 0x00, 0x9e, 0x35, 0x00, 0x9e, 0x35, 0x00, 0x9e, 0x35, 0x00, 0x9e, 0x35, 0x0f, 0x2d, 0x92, 0x0f, 0x2e, 0x91, 0x0f, 0x30, 0x8f, 0x0f, 0x31, 0x8e, 0x0f, 0x34, 0x8b, 0x0f, 0x35, 0x89, 0x0f, 0x39, 0x86, 0x14, 0x35, 0x0d, 0x14, 0x37, 0x0a, 0x14, 0x3a, 0x08, 0x14, 0x3c, 0x05, 0x14, 0x3e, 0x03, 0x14, 0x40, 0x02, 0x14, 0x41, 0x00 } } }, // 22 Audio Lava, loud_music
+};
@@ -0,0 +1,151 @@
+#ifndef POI_MODE_REGISTRY_H
+#define POI_MODE_REGISTRY_H
+
+// Compile-time mode registry: one descriptor per render mode, and state
+// blocks for running modes. Header-only, no ESP-IDF dependencies.
+//
+// A mode is a function
+//   void render(State &st, const Input &in, uint8_t *rgb, size_t len);
+// Everything it remembers between frames lives in State, a default
+// constructible struct whose member initialisers are the mode's start.
+// mode<render>(...) reads State and Input off the signature, so the size
+// and initialiser in the descriptor can't drift from the function.
+//
+// A running mode is an instance: a registry index plus a state block from
+// an arena. Instances don't share state, so one mode can run in several at
+// once, and selecting a different mode starts it from State{}.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <type_traits>
+
+namespace poi_modes {
+
+enum category : uint8_t {
+    MOTION, // Listed on the mode screens only
+    AUDIO,  // Listed on the audio screen
+};
+
+enum : uint8_t {
+    NEEDS_IMU   = 1 << 0, // Reads the accelerometer or gyro from the input
+    NEEDS_AUDIO = 1 << 1, // Reads the audio level or spectrum from the input
+};
+
+// For modes that keep nothing between frames
+struct stateless {};
+
+template <typename Input>
+struct descriptor {
+    using input = Input;
+
+    const char *name; // UI label, '\n' breaks the line
+    category cat;
+    uint8_t needs; // NEEDS_*
+    uint16_t state_size;
+    uint16_t state_align;
+    void (*init)(void *state); // Constructs State{} in the block
+    void (*render)(void *state, const Input &in, uint8_t *rgb, size_t len);
+};
+
+template <typename F>
+struct render_sig;
+
+template <typename State, typename Input>
+struct render_sig<void (*)(State &, const Input &, uint8_t *, size_t)> {
+    using state = State;
+    using input = Input;
+};
+
+// Type-erased entry points for one render function
+template <auto Render>
+struct thunk {
+    using state = typename render_sig<decltype(Render)>::state;
+    using input = typename render_sig<decltype(Render)>::input;
+    static_assert(std::is_default_constructible_v<state>, "Mode state starts from State{}");
+    static_assert(std::is_trivially_destructible_v<state>, "Mode state is dropped without a destructor call");
+
+    static void init(void *s) { ::new (s) state{}; }
+    static void render(void *s, const input &in, uint8_t *rgb, size_t len) {
+        Render(*static_cast<state *>(s), in, rgb, len);
+    }
+};
+
+template <auto Render>
+constexpr descriptor<typename thunk<Render>::input> mode(const char *name, category cat, uint8_t needs) {
+    using t = thunk<Render>;
+    return {name, cat, needs, sizeof(typename t::state), alignof(typename t::state), t::init, t::render};
+}
+
+template <typename D, size_t N>
+constexpr size_t max_state_size(const D (&reg)[N]) {
+    size_t m = 0;
+    for (const D &d : reg) m = d.state_size > m ? d.state_size : m;
+    return m;
+}
+
+template <typename D, size_t N>
+constexpr size_t max_state_align(const D (&reg)[N]) {
+    size_t m = 1;
+    for (const D &d : reg) m = d.state_align > m ? d.state_align : m;
+    return m;
+}
+
+// Modes of cat at index first or later
+template <typename D, size_t N>
+constexpr int count(const D (&reg)[N], category cat, size_t first = 0) {
+    int n = 0;
+    for (size_t i = first; i < N; i++) n += reg[i].cat == cat;
+    return n;
+}
+
+// State blocks that fit any mode in Reg, handed out once and held for good. Zero-initialised.
+template <const auto &Reg, size_t Blocks>
+class arena {
+public:
+    static constexpr size_t block_align = max_state_align(Reg);
+    static constexpr size_t block_size = (max_state_size(Reg) + block_align - 1) / block_align * block_align;
+
+    void *alloc() { return used_ < Blocks ? blocks_[used_++] : nullptr; }
+
+private:
+    alignas(block_align) uint8_t blocks_[Blocks][block_size];
+    size_t used_;
+};
+
+// One running mode of Reg and its state block
+template <const auto &Reg>
+class instance {
+public:
+    using input = typename std::remove_cvref_t<decltype(Reg[0])>::input;
+
+    // Takes a block from an arena of Reg; no mode runs until select()
+    void bind(void *block) {
+        state_ = block;
+        mode_ = -1;
+    }
+
+    // Start mode from its initial state, even if it is already running
+    void start(int mode) {
+        Reg[mode].init(state_);
+        mode_ = mode;
+    }
+
+    // Start mode unless it is already running
+    void select(int mode) {
+        if (mode != mode_) start(mode);
+    }
+
+    int mode() const { return mode_; }
+
+    // The selected mode's next frame
+    void render(const input &in, uint8_t *rgb, size_t len) { Reg[mode_].render(state_, in, rgb, len); }
+
+private:
+    void *state_ = nullptr;
+    int mode_ = -1;
+};
+
+} // namespace poi_modes
+
+#endif // POI_MODE_REGISTRY_H
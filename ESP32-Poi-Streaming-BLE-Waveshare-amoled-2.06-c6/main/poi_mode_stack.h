@@ -0,0 +1,72 @@
+#ifndef POI_MODE_STACK_H
+#define POI_MODE_STACK_H
+
+// Modes built from other modes. Each layer is a render function drawn into
+// its own RGBA strip and blended onto the layers below it (poi_compose.h),
+// at an opacity read off the input each frame. A stack is a render function
+// itself, so it goes into a registry like any mode:
+//   mode<stack<POI_MODE_LEDS, layer<mode_gravity_rainbow>,
+//              layer<mode_audio_bass_pulse, POI_COMPOSE_SCREEN, opacity_bass>>::render>(...)
+// Its State holds every layer's, so each layer animates as it would on its
+// own; a layer is drawn every frame, even while its opacity is 0, so it
+// doesn't jump when it fades back in. The bottom layer is opaque and its
+// operator and opacity are unused. Header-only, no ESP-IDF dependencies.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+#include <type_traits>
+#include "poi_mode_registry.h"
+#include "poi_compose.h"
+
+namespace poi_modes {
+
+// Render drawn with op at opacity(input) (255 when nullptr), its alpha per alpha
+template <auto Render, poi_compose_op_t Op = POI_COMPOSE_ALPHA, auto Opacity = nullptr,
+          poi_compose_alpha_t Alpha = POI_COMPOSE_OPAQUE>
+struct layer {
+    using state = typename render_sig<decltype(Render)>::state;
+    using input = typename render_sig<decltype(Render)>::input;
+    static constexpr poi_compose_op_t op = Op;
+
+    static uint8_t opacity(const input &in) {
+        if constexpr (std::is_null_pointer_v<decltype(Opacity)>) return 255;
+        else return Opacity(in);
+    }
+
+    // Into px, through the RGB strip rgb of n LEDs
+    static void draw(state &st, const input &in, uint8_t *rgb, uint32_t *px, size_t n) {
+        Render(st, in, rgb, n * 3);
+        poi_compose_from_rgb(rgb, Alpha, px, (int)n);
+    }
+};
+
+template <size_t Leds, typename Base, typename... Over>
+struct stack {
+    using input = typename Base::input;
+
+    struct state {
+        typename Base::state base;
+        std::tuple<typename Over::state...> over;
+    };
+
+    // The layers draw a full Leds strip each into scratch; rgb gets the first len / 3 LEDs of the result
+    static void render(state &st, const input &in, uint8_t *rgb, size_t len) {
+        uint8_t strip[Leds * 3];
+        uint32_t dst[Leds], src[Leds];
+        Base::draw(st.base, in, strip, dst, Leds);
+        std::apply([&](auto &...over) { (blend<Over>(over, in, strip, dst, src), ...); }, st.over);
+        poi_compose_to_rgb(dst, rgb, (int)(len / 3 < Leds ? len / 3 : Leds));
+    }
+
+private:
+    template <typename L>
+    static void blend(typename L::state &st, const input &in, uint8_t *rgb, uint32_t *dst, uint32_t *src) {
+        L::draw(st, in, rgb, src, Leds);
+        poi_compose_blend(dst, src, L::op, L::opacity(in), Leds);
+    }
+};
+
+} // namespace poi_modes
+
+#endif // POI_MODE_STACK_H
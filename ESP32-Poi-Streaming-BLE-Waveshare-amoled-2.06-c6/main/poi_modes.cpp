@@ -0,0 +1,891 @@
+#include "poi_modes.h"
+#include <string.h>
+#include "poi_fixed.h"
+#include "poi_palette.h"
+
+#define NUM_LEDS       POI_MODE_LEDS
+#define N_SAMPLES      (POI_MODE_BINS * 2) // The audio FFT the bin arithmetic below was written for
+#define MIN_BRIGHTNESS POI_FX_Q15(0.05)    // Minimum brightness to ensure LEDs are never completely off
+#define FRAME_US       40000               // The frame interval at anim_step_q16 = 1 << 16
+
+#define POV_COLUMN_BITS 7   // Image columns per turn, as a power of two
+#define POV_COLUMNS     (1 << POV_COLUMN_BITS)
+#define POV_IMAGE_SIZE  32  // Source images are square, one uint32_t per row
+#define POV_SPIN_DPS    90  // Slower than this the accel is gravity alone, and the arm angle comes from it directly
+#define POV_ACCEL_MAX   POI_FX_Q15(7.5) // Near the IMU's 8 g range gravity is clipped off the accel along the arm
+#define POV_ALONG_US    2000000 // Time constant of the averages the arm radius comes from: gravity must cancel over it even at a turn a second
+#define POV_GRAVITY_US  250000  // Time constant of the pull towards gravity: long enough to smooth its noise out
+#define POV_RAD_Q16     1144    // pi / 180: dps to rad/s
+
+namespace poi_modes {
+
+// dB (Q8) mapped onto 0..1 (Q15) over floor_db dB below full scale: clamp((db + floor_db) / floor_db)
+static inline int32_t db_norm(int32_t db_q8, int32_t floor_db) {
+    return poi_fx_clamp((db_q8 + floor_db * 256) * 128 / floor_db, 0, POI_FX_ONE);
+}
+
+// Mean audio amplitude times gain, capped at 1 (Q15)
+static inline int32_t audio_norm(const input &in, int32_t gain) {
+    return in.audio_level * gain < POI_FX_ONE ? in.audio_level * gain : POI_FX_ONE;
+}
+
+// A per-frame step (Q16) at the current frame rate
+static inline int32_t anim(const input &in, int32_t step) {
+    return poi_fx_mul16(step, in.anim_step_q16);
+}
+
+// LEDs a render into len bytes writes: len / 3, at most NUM_LEDS
+static inline int leds(size_t len) {
+    return (int)(len / 3 < NUM_LEDS ? len / 3 : NUM_LEDS);
+}
+
+// Colour palettes the modes index (see poi_palette.h), built by init()
+static poi_palette_t pal_rainbow; // The hue wheel
+static poi_palette_t pal_ember;   // Black to orange: (i, i / 3, 0)
+static poi_palette_t pal_aqua;    // Black to cyan: (0, i, i)
+static poi_palette_t pal_white;   // Black to white: (i, i, i)
+static poi_palette_t pal_pov;     // Black at 0, then the hue wheel
+
+// A heart, 1 bit per pixel, row 0 at the top and the MSB at the left
+static const uint32_t pov_heart[POV_IMAGE_SIZE] = {
+    0x00000000, 0x00000000, 0x01F00F80, 0x07FC3FE0,
+    0x0FFFFFF0, 0x1FFFFFF8, 0x3FFFFFFC, 0x3FFFFFFC,
+    0x3FFFFFFC, 0x3FFFFFFC, 0x7FFFFFFE, 0x7FFFFFFE,
+    0x3FFFFFFC, 0x3FFFFFFC, 0x3FFFFFFC, 0x3FFFFFFC,
+    0x1FFFFFF8, 0x1FFFFFF8, 0x0FFFFFF0, 0x0FFFFFF0,
+    0x07FFFFE0, 0x07FFFFE0, 0x03FFFFC0, 0x01FFFF80,
+    0x00FFFF00, 0x007FFE00, 0x001FF800, 0x000FF000,
+    0x0007E000, 0x00018000, 0x00000000, 0x00000000,
+};
+
+// The image as seen along each of POV_COLUMNS arm angles, pal_pov indices
+static uint8_t pov_columns[POV_COLUMNS][NUM_LEDS];
+
+// Sample image along every column: the hand at its centre, LED 0 nearest it,
+// the arm hanging straight down at column 0 and turning towards the image's
+// right. Lit pixels take a hue by distance from the hand.
+static void pov_rasterize(const uint32_t *image) {
+    for (int c = 0; c < POV_COLUMNS; c++) {
+        uint16_t a = (uint16_t)(c << (16 - POV_COLUMN_BITS));
+        int32_t s = poi_fx_sin(a), co = poi_fx_sin((uint16_t)(a + 16384));
+        for (int led = 0; led < NUM_LEDS; led++) {
+            int32_t r = (2 * led + 1) * POV_IMAGE_SIZE * 128 / (2 * NUM_LEDS); // LED centre from the hand, image pixels, Q8
+            int32_t u = (POV_IMAGE_SIZE * 128 + ((r * s) >> 15)) >> 8;
+            int32_t v = (POV_IMAGE_SIZE * 128 + ((r * co) >> 15)) >> 8;
+            bool lit = u >= 0 && u < POV_IMAGE_SIZE && v >= 0 && v < POV_IMAGE_SIZE && ((image[v] << u) & 0x80000000u);
+            pov_columns[c][led] = lit ? (uint8_t)(1 + led * 169 / (NUM_LEDS - 1)) : 0; // Red at the hand to blue at the tip
+        }
+    }
+}
+
+void init(void) {
+    static const poi_palette_stop_t ember[] = { { 0, 0, 0, 0 }, { 255, 255, 85, 0 } };
+    static const poi_palette_stop_t aqua[] = { { 0, 0, 0, 0 }, { 255, 0, 255, 255 } };
+    static const poi_palette_stop_t white[] = { { 0, 0, 0, 0 }, { 255, 255, 255, 255 } };
+    poi_palette_rainbow(&pal_rainbow);
+    poi_palette_gradient(&pal_ember, ember, 2);
+    poi_palette_gradient(&pal_aqua, aqua, 2);
+    poi_palette_gradient(&pal_white, white, 2);
+    pal_pov = pal_rainbow;
+    pal_pov.rgb[0] = 0;
+    pov_rasterize(pov_heart);
+}
+
+// =============================================================================
+// POI MODE FUNCTION DEFINITIONS
+// =============================================================================
+// Integer only per LED (see poi_fixed.h); IMU floats are converted once per frame on entry.
+// Accel is taken in Q15 for angles and tilt, Q10 for magnitudes; gyro in Q8.
+// Each mode fills per-LED palette indices and Q15 levels, then one poi_palette_* call writes the first leds(l) of them.
+
+void mode_gravity_rainbow(stateless &, const input &in, uint8_t *p, size_t l) {
+    int32_t angle = poi_fx_atan2(POI_FX_FROM(in.imu.accelY, 15), POI_FX_FROM(in.imu.accelX, 15));
+    uint8_t hue[NUM_LEDS];
+    memset(hue, (uint8_t)(((angle + 32768) * 255) >> 16), NUM_LEDS);
+    poi_palette_map(&pal_rainbow, hue, NULL, p, leds(l));
+}
+
+void mode_spin_fire(stateless &, const input &in, uint8_t *p, size_t l) {
+    // Increase sensitivity: Divide by 4 instead of 64
+    // Add +40 so it's always a little bit visible even when still
+    int32_t val = poi_fx_abs(POI_FX_FROM(in.imu.gyroZ, 8)) / (4 * 256) + 40;
+    uint8_t intensity[NUM_LEDS];
+    memset(intensity, val < 255 ? val : 255, NUM_LEDS);
+
+    poi_palette_map(&pal_ember, intensity, NULL, p, leds(l)); // Red, with green at a third for the orange tint
+}
+
+
+void mode_centrifugal_rainbow(centrifugal_rainbow_state &st, const input &in, uint8_t *p, size_t l) {
+    // Lowered divisor from 2000 to 500 for more "pop"
+    st.hue += anim(in, poi_fx_abs(POI_FX_FROM(in.imu.gyroZ, 8)) * 256 / 500);
+
+    st.hue = poi_fx_hue_wrap(st.hue); // Use subtraction to keep it smooth
+    uint8_t led_hue[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        // Adding (i/3) creates a slight gradient across the 12 LEDs
+        led_hue[led_idx] = (uint8_t)((st.hue >> 16) + led_idx * 6);
+    }
+    poi_palette_map(&pal_rainbow, led_hue, NULL, p, leds(l));
+}
+
+void mode_flow_trail(stateless &, const input &in, uint8_t *p, size_t l) {
+    // Brightness based on spin speed
+    int32_t v = poi_fx_abs(POI_FX_FROM(in.imu.gyroZ, 8)) / (4 * 256);
+    uint8_t br[NUM_LEDS];
+    memset(br, v < 255 ? v : 255, NUM_LEDS);
+    poi_palette_map(&pal_aqua, br, NULL, p, leds(l));
+}
+
+void mode_gravity_compass(stateless &, const input &in, uint8_t *p, size_t l) {
+    int32_t angle = poi_fx_atan2(POI_FX_FROM(in.imu.accelY, 15), POI_FX_FROM(in.imu.accelX, 15));
+    uint8_t hue = (uint8_t)(((angle + 32768) * 255) >> 16);
+    uint8_t led_hue[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) led_hue[led_idx] = hue + led_idx;
+    poi_palette_map(&pal_rainbow, led_hue, NULL, p, leds(l));
+}
+
+void mode_velocity_prism(velocity_prism_state &st, const input &in, uint8_t *p, size_t l) {
+    int32_t current_vel = poi_fx_hypot3(POI_FX_FROM(in.imu.gyroX, 8), POI_FX_FROM(in.imu.gyroY, 8), POI_FX_FROM(in.imu.gyroZ, 8)); // Use all gyro axes for velocity
+
+    // Smooth the velocity to reduce flashiness
+    st.smoothed_vel = (st.smoothed_vel * 9 + current_vel + 5) / 10; // Exponential moving average
+
+    // Map st.smoothed_vel to a dynamic range for hue, making it less direct and more subtle
+    // Max vel could be around 2000-3000, so a divisor of 100.0f will give 0-30 hue range
+    int32_t dynamic_hue_base = poi_fx_clamp(st.smoothed_vel * 256 / 50, 0, 255 << 16); // Adjust divisor for desired sensitivity
+
+    // Slowly shift hue offset for a flowing effect
+    st.hue_offset += anim(in, POI_FX_Q16(0.2) + dynamic_hue_base / 20); // Faster shift with higher velocity
+    st.hue_offset = poi_fx_hue_wrap(st.hue_offset);
+
+    // Brightness can also be influenced by smoothed velocity, but gently
+    int32_t brightness = POI_FX_Q15(0.4) + poi_fx_clamp(st.smoothed_vel * 128 / 1000, 0, POI_FX_Q15(0.6)); // Base brightness with gentle boost from velocity
+    brightness = poi_fx_clamp(brightness, MIN_BRIGHTNESS, POI_FX_ONE);
+
+    uint8_t hue[NUM_LEDS];
+    uint16_t level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        // Create a subtle wave or gradient across the LEDs, influenced by st.hue_offset and velocity
+        hue[led_idx] = poi_fx_hue(dynamic_hue_base + led_idx * (50 << 16) / (NUM_LEDS - 1) + st.hue_offset); // 50 for spread
+        level[led_idx] = brightness;
+    }
+    poi_palette_map(&pal_rainbow, hue, level, p, leds(l));
+}
+
+void mode_warp_speed(stateless &, const input &in, uint8_t *p, size_t l) {
+    // Brightness flashes based on Gyro Z (spin speed)
+    // Creates a "strobe" effect the faster you spin
+    int32_t v = poi_fx_abs(POI_FX_FROM(in.imu.gyroZ, 8)) / (5 * 256);
+    uint8_t flash[NUM_LEDS];
+    memset(flash, v < 255 ? v : 255, NUM_LEDS);
+    poi_palette_map(&pal_white, flash, NULL, p, leds(l));
+}
+
+void mode_plasma_ghost(plasma_ghost_state &st, const input &in, uint8_t *p, size_t l) {
+    // Global hue shifts slowly, creating a "breathing" color effect
+    st.global_hue = poi_fx_hue_wrap(st.global_hue + anim(in, POI_FX_Q16(0.1)));
+
+    // Plasma movement seed (subtle variation)
+    st.plasma_seed += poi_fx_rad_to_angle32(anim(in, POI_FX_Q16(0.01)));
+
+    // Overall acceleration magnitude for intensity
+    int32_t accel_mag = poi_fx_hypot3(POI_FX_FROM(in.imu.accelX, 10), POI_FX_FROM(in.imu.accelY, 10), POI_FX_FROM(in.imu.accelZ, 10));
+    int32_t intensity_boost = poi_fx_clamp(accel_mag * 32 / 10, 0, POI_FX_ONE); // Boost intensity with movement
+
+    // Overall brightness, with a boost from movement
+    int32_t brightness = POI_FX_Q15(0.3) + poi_fx_mul(intensity_boost, POI_FX_Q15(0.7));
+    brightness = poi_fx_clamp(brightness, MIN_BRIGHTNESS, POI_FX_ONE);
+
+    uint16_t seed = (uint16_t)(st.plasma_seed >> 16);
+    uint8_t base_hue[NUM_LEDS], secondary_hue[NUM_LEDS];
+    uint16_t blend_factor[NUM_LEDS], level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        uint16_t turn = (uint16_t)(led_idx * 65536 / (NUM_LEDS - 1)); // led_pos_norm * 2 pi
+
+        // Base hue for the "plasma" effect, influenced by st.global_hue and LED position
+        base_hue[led_idx] = poi_fx_hue(st.global_hue + led_idx * (80 << 16) / (NUM_LEDS - 1) + poi_fx_sin(seed + turn) * 40);
+
+        // A "ghostly" complementary color that blends in
+        secondary_hue[led_idx] = (uint8_t)((base_hue[led_idx] + 120) % 255);
+
+        // Blend the colors, with blending factor subtly varied by a sine wave for "plasma" feel
+        blend_factor[led_idx] = (poi_fx_sin((uint16_t)(seed * 2 + turn * 2)) + POI_FX_ONE) / 2; // 0 to 1
+        level[led_idx] = brightness;
+    }
+    poi_palette_blend(&pal_rainbow, base_hue, secondary_hue, blend_factor, level, p, leds(l));
+}
+
+void mode_fire_ice_split(stateless &, const input &in, uint8_t *p, size_t l) {
+    int32_t tilt_norm = (POI_FX_FROM(in.imu.accelY, 15) + POI_FX_ONE) / 2; // Normalized tilt from 0.0 to 1.0
+
+    // Determine the "balance" between fire and ice for each LED
+    // Create a blend zone that moves with tilt_norm
+    const int32_t blend_width = POI_FX_Q15(0.3); // Width of the blend zone
+    int32_t blend_start = tilt_norm - blend_width / 2;
+    int32_t blend_end = tilt_norm + blend_width / 2;
+
+    uint8_t fire_hue[NUM_LEDS], ice_hue[NUM_LEDS];
+    uint16_t fire_factor[NUM_LEDS]; // How much fire color should contribute (0 to 1)
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        int32_t led_pos_norm = led_idx * POI_FX_ONE / (NUM_LEDS - 1); // Normalized LED position 0.0 to 1.0
+
+        if (led_pos_norm < blend_start) { // Pure ice
+            fire_factor[led_idx] = 0;
+        } else if (led_pos_norm > blend_end) { // Pure fire
+            fire_factor[led_idx] = POI_FX_ONE;
+        } else { // In the blend zone
+            fire_factor[led_idx] = poi_fx_clamp((led_pos_norm - blend_start) * POI_FX_ONE / blend_width, 0, POI_FX_ONE);
+        }
+
+        // Fire hues (red to yellow/orange, maybe some white/bright in the middle)
+        // Base hue for fire part, slightly shifted by led position
+        fire_hue[led_idx] = (uint8_t)(led_idx * 40 / (NUM_LEDS - 1)); // Red (0) to Orange/Yellow (40)
+
+        // Ice hues (blue to cyan/white)
+        // Base hue for ice part, slightly shifted by led position
+        ice_hue[led_idx] = (uint8_t)(180 + (NUM_LEDS - 1 - led_idx) * 40 / (NUM_LEDS - 1)); // Blue (180) to Cyan (220)
+    }
+
+    // Blend the colors based on fire_factor
+    poi_palette_blend(&pal_rainbow, ice_hue, fire_hue, fire_factor, NULL, p, leds(l));
+}
+
+void mode_shifting_horizon(shifting_horizon_state &st, const input &in, uint8_t *p, size_t l) {
+    // Map accelZ (-1.0 to 1.0) to a normalized horizon position (0.0 to 1.0)
+    int32_t target_horizon_pos = (POI_FX_FROM(in.imu.accelZ, 15) + POI_FX_ONE) / 2;
+
+    // Smooth the horizon position for less jittery movement
+    st.horizon_pos_smoothed = (st.horizon_pos_smoothed * 9 + target_horizon_pos + 5) / 10;
+
+    // Slowly shift overall hue for dynamic colors
+    st.hue_offset = poi_fx_hue_wrap(st.hue_offset + anim(in, POI_FX_Q16(0.08)));
+
+    uint8_t hue[NUM_LEDS];
+    uint16_t level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        int32_t led_pos_norm = led_idx * POI_FX_ONE / (NUM_LEDS - 1); // 0.0 to 1.0
+
+        // Calculate distance from the smoothed horizon line
+        int32_t dist_from_horizon = poi_fx_abs(led_pos_norm - st.horizon_pos_smoothed);
+
+        // Intensity/brightness based on proximity to the horizon
+        int32_t proximity_intensity = POI_FX_ONE - poi_fx_clamp(dist_from_horizon * 4, 0, POI_FX_ONE); // Peak at horizon, falloff
+
+        // Create a color gradient that shifts across the horizon
+        // Hue varies across the strip, with a bias towards the global_hue_offset
+        hue[led_idx] = poi_fx_hue(st.hue_offset + led_idx * (120 << 16) / (NUM_LEDS - 1));
+
+        // Apply brightness: higher near the horizon, with a base minimum
+        int32_t brightness = POI_FX_Q15(0.2) + poi_fx_mul(proximity_intensity, POI_FX_Q15(0.8));
+        level[led_idx] = poi_fx_clamp(brightness, MIN_BRIGHTNESS, POI_FX_ONE);
+    }
+    poi_palette_map(&pal_rainbow, hue, level, p, leds(l));
+}
+
+void mode_gravity_ball(stateless &, const input &in, uint8_t *p, size_t l) {
+    uint8_t lit[NUM_LEDS];
+    memset(lit, 0, NUM_LEDS);
+
+    // 1. Normalize the input. If it's > 10, assume it's in milli-Gs (1000)
+    int32_t ay = POI_FX_FROM(in.imu.accelY, 15);
+    if (poi_fx_abs(ay) > 10 * POI_FX_ONE) ay /= 1000;
+
+    // 2. Clamp the value to the expected range [-1.0, 1.0]
+    ay = poi_fx_clamp(ay, -POI_FX_ONE, POI_FX_ONE);
+
+    // 3. Map -1.0..1.0 to 0.0..1.0
+    int32_t pos = (ay + POI_FX_ONE) / 2;
+
+    // 4. Calculate LED index (0 to 11)
+    int led_idx = (pos * NUM_LEDS - POI_FX_ONE) / POI_FX_ONE;
+
+    // Safety check and light it up
+    if (led_idx >= 0 && led_idx < NUM_LEDS) lit[led_idx] = 255;
+    poi_palette_map(&pal_white, lit, NULL, p, leds(l));
+}
+
+void mode_compass_navigator(compass_navigator_state &st, const input &in, uint8_t *p, size_t l) {
+    int32_t angle = poi_fx_atan2(POI_FX_FROM(in.imu.accelY, 15), POI_FX_FROM(in.imu.accelX, 15)); // -PI to PI
+    int32_t angle_norm = angle + 32768; // 0.0 to 1.0, Q16
+
+    // Map the normalized angle to a target LED position (0 to NUM_LEDS-1), Q16
+    int32_t target_led_pos = angle_norm * (NUM_LEDS - 1);
+
+    // Dynamic glow/pulse based on spin speed
+    int32_t spin_intensity = poi_fx_clamp(poi_fx_abs(POI_FX_FROM(in.imu.gyroZ, 8)) * 128 / 50, 0, POI_FX_ONE); // Normalize gyroZ to 0..1
+
+    uint8_t base_hue[NUM_LEDS], pointer_hue[NUM_LEDS];
+    uint16_t proximity_factor[NUM_LEDS], level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        // Calculate distance from target LED position, wrapping around the strip
+        int32_t dist = poi_fx_abs((led_idx << 16) - target_led_pos);
+        if (dist > (NUM_LEDS << 16) / 2) {
+            dist = (NUM_LEDS << 16) - dist; // Handle wrap-around for shortest distance
+        }
+        int32_t proximity = POI_FX_ONE - poi_fx_clamp(dist * 2 / NUM_LEDS, 0, POI_FX_ONE); // 1.0 at target, 0.0 further away (NUM_LEDS / 4)
+
+        // Base hue shifts slowly, perhaps based on time or a slow cycle, to make it more interesting
+        st.global_hue_offset = poi_fx_hue_wrap(st.global_hue_offset + anim(in, POI_FX_Q16(0.05))); // Slow rotation
+
+        // Determine hue: a base color, blended with a "pointer" color at the target_led_pos
+        base_hue[led_idx] = poi_fx_hue(led_idx * (255 << 16) / (NUM_LEDS - 1) + st.global_hue_offset);
+        pointer_hue[led_idx] = (uint8_t)((base_hue[led_idx] + 120) % 255); // Complementary hue for the pointer
+
+        // Blend base and pointer colors based on proximity
+        proximity_factor[led_idx] = proximity;
+
+        // Apply brightness: higher near the pointer, and a boost from spin intensity
+        int32_t brightness = POI_FX_Q15(0.5) + proximity / 2 + poi_fx_mul(spin_intensity, POI_FX_Q15(0.3));
+        level[led_idx] = poi_fx_clamp(brightness, MIN_BRIGHTNESS, POI_FX_ONE);
+    }
+    poi_palette_blend(&pal_rainbow, base_hue, pointer_hue, proximity_factor, level, p, leds(l));
+}
+
+// Persistence of vision: shows the image column for where the arm will be
+// while the poi show this frame. The arm angle is the gyro integrated over
+// frames, pulled towards the angle of gravity in the accel. Spinning, the
+// accel is mostly the arm's own: rate^2 times its radius along it, angular
+// accel times its radius across it. The radius (over g) is the average of
+// the accel along the arm over turns, where gravity cancels, over the average
+// of rate^2, so the model follows the pace from frame to frame. Past the
+// IMU's range along the arm only the accel across it is left, and the angle
+// locks onto the sine of gravity in it. The frame is shown in.lead_us past
+// the IMU state for about one frame interval, so the column is the one at
+// the middle of that sweep, at the pace the last gyro step is heading for.
+void mode_pov_image(pov_image_state &st, const input &in, uint8_t *p, size_t l) {
+    int32_t dps_q8 = POI_FX_FROM(in.imu.gyroZ, 8);
+    int32_t frame_us = (int32_t)(((int64_t)in.anim_step_q16 * FRAME_US) >> 16);
+    st.phase += poi_fx_turn((dps_q8 + st.dps) / 2, frame_us); // The mean rate over the frame
+    int32_t rate = (int32_t)(((int64_t)dps_q8 * POV_RAD_Q16) >> 16); // rad/s, Q8
+    int32_t rate2 = (int32_t)(((int64_t)rate * rate) >> 8);
+    int32_t step = dps_q8 - st.dps;
+    int32_t spin_up = (int32_t)(((int64_t)step * POV_RAD_Q16 >> 16) * 1000000 / frame_us); // rad/s^2, Q8
+    st.dps = dps_q8;
+
+    int32_t ax = POI_FX_FROM(in.imu.accelX, 15), ay = POI_FX_FROM(in.imu.accelY, 15);
+    bool clipped = poi_fx_abs(ay) >= POV_ACCEL_MAX;
+    if (!clipped && poi_fx_abs(dps_q8) >= POV_SPIN_DPS * 256) {
+        st.along += (int32_t)((int64_t)(ay - st.along) * frame_us / POV_ALONG_US);
+        st.spin2 += (int32_t)((int64_t)(rate2 - st.spin2) * frame_us / POV_ALONG_US);
+    }
+    int32_t gx = ax, gy = ay;
+    if (st.spin2 > 0) {
+        gx -= (int32_t)((int64_t)st.along * spin_up / st.spin2);
+        gy -= (int32_t)((int64_t)st.along * rate2 / st.spin2);
+    }
+
+    int32_t err = 0; // Binary angle, 1 << 16 = one turn
+    if (!clipped && poi_fx_abs(gx) + poi_fx_abs(gy) > POI_FX_ONE / 4) { // Not in free fall
+        err = (int16_t)(poi_fx_atan2(gx, gy) - (int32_t)(st.phase >> 16));
+    } else if (clipped && poi_fx_abs(dps_q8) >= POV_SPIN_DPS * 256) {
+        // gx - sin(phase) is the angle error times cos(phase): twice its product with cos(phase) is the error over a turn
+        uint16_t a = (uint16_t)(st.phase >> 16);
+        int32_t e = poi_fx_mul(gx - poi_fx_sin(a), poi_fx_sin((uint16_t)(a + 16384))) * 2; // rad, Q15
+        err = poi_fx_clamp(e, -POI_FX_ONE, POI_FX_ONE) * 10430 >> 15; // 65536 / 2 pi
+    }
+    int32_t gain = frame_us < POV_GRAVITY_US ? frame_us : POV_GRAVITY_US;
+    st.phase += (uint32_t)(((int64_t)err << 16) * gain / POV_GRAVITY_US);
+
+    int32_t ahead_us = in.lead_us + frame_us / 2;
+    st.shown = st.phase + poi_fx_turn(dps_q8 + (int32_t)((int64_t)step * ahead_us / (2 * frame_us)), ahead_us); // At the pace then
+    poi_palette_map(&pal_pov, pov_columns[st.shown >> (32 - POV_COLUMN_BITS)], NULL, p, leds(l));
+}
+
+uint8_t opacity_bass(const input &in) {
+    int32_t bass = db_norm((in.spectrum_q8[0] + in.spectrum_q8[1] + in.spectrum_q8[2]) / 3, 65);
+    return (uint8_t)(bass >> 7 < 255 ? bass >> 7 : 255);
+}
+
+uint8_t opacity_spin(const input &in) {
+    int32_t dps = poi_fx_abs(POI_FX_FROM(in.imu.gyroZ, 0));
+    return (uint8_t)(dps < 720 ? dps * 255 / 720 : 255);
+}
+
+void mode_audio_spectrum(stateless &, const input &in, uint8_t *p, size_t l) {
+    int num_spectrum_bins = N_SAMPLES / 2; // This is 8 (N_SAMPLES = 16)
+    uint8_t hue[NUM_LEDS];
+    uint16_t level[NUM_LEDS];
+
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        int32_t target_spectrum_pos = (led_idx * (num_spectrum_bins - 1) << 16) / (NUM_LEDS - 1); // Q16
+        int spectrum_idx_low = target_spectrum_pos >> 16;
+        int spectrum_idx_high = spectrum_idx_low + ((target_spectrum_pos & 0xFFFF) != 0);
+        int32_t interp_factor = (target_spectrum_pos & 0xFFFF) >> 1; // Q15
+
+        int32_t mag_low = in.spectrum_q8[spectrum_idx_low];
+        int32_t mag_high = in.spectrum_q8[spectrum_idx_high];
+        int32_t interpolated_magnitude = mag_low + poi_fx_mul(mag_high - mag_low, interp_factor);
+
+        // **Adjust dB range for higher sensitivity to lower sounds**
+        int32_t normalized_magnitude = db_norm(interpolated_magnitude, 70); // Shift range from -70 to 0dB
+
+        // **Even stronger baseline and audio reaction**
+        // Capped at full: past it the channels used to wrap around to dark
+        level[led_idx] = poi_fx_clamp(poi_fx_mul(normalized_magnitude, POI_FX_Q15(1.2)) + MIN_BRIGHTNESS, MIN_BRIGHTNESS * 2, POI_FX_ONE);
+
+        // Map magnitude to hue: 0 (red) -> 85 (green) -> 170 (blue) for low to high magnitude
+        // Invert hue so low magnitude is blue, high is red (red is 0, so 170 - hue_val)
+        uint8_t hue_val = (uint8_t)((normalized_magnitude * 220) >> 15); // Even wider hue range for more color diversity
+        hue[led_idx] = 170 - hue_val;
+    }
+    poi_palette_map(&pal_rainbow, hue, level, p, leds(l));
+}
+
+void mode_audio_wave(audio_wave_state &st, const input &in, uint8_t *p, size_t l) {
+    // **Even much higher sensitivity: Multiplier 15**
+    int32_t normalized_amplitude = audio_norm(in, 15);
+
+    // Base brightness, boosted even more strongly by amplitude
+    int32_t effective_brightness = normalized_amplitude * 3 / 2 + MIN_BRIGHTNESS; // Higher floor, stronger audio impact
+    if (effective_brightness < MIN_BRIGHTNESS * 2) effective_brightness = MIN_BRIGHTNESS * 2;
+
+    // Hue changes over time, influenced by amplitude (faster change with louder audio) and motion
+    int32_t gyro_z = poi_fx_abs(POI_FX_FROM(in.imu.gyroZ, 8));
+    st.hue_offset += anim(in, POI_FX_Q16(1.0) + normalized_amplitude * 8 + gyro_z * 256 / 200); // Faster global hue shift, more motion influence
+    st.hue_offset = poi_fx_hue_wrap(st.hue_offset);
+
+    // Wave motion influenced more strongly by audio amplitude
+    st.wave_phase += poi_fx_rad_to_angle32(anim(in, POI_FX_Q16(0.2) + normalized_amplitude * 4)); // Faster wave with louder audio
+
+    // Wave amplitude and frequency influenced by audio more intensely
+    int32_t wave_amplitude = POI_FX_Q15(0.4) + poi_fx_mul(normalized_amplitude, POI_FX_Q15(0.6)); // More dynamic wave peaks
+    int32_t wave_frequency = POI_FX_ONE + poi_fx_mul(normalized_amplitude, POI_FX_Q15(0.7)); // More compression with louder audio
+
+
+    uint8_t hue[NUM_LEDS];
+    uint16_t level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        // Create a wave pattern: sine wave along the strip, led_pos * pi * wave_frequency + st.wave_phase
+        uint16_t angle = (uint16_t)(led_idx * wave_frequency / (NUM_LEDS - 1) + (st.wave_phase >> 16));
+        int32_t wave_value = poi_fx_mul(poi_fx_sin(angle), wave_amplitude);
+        wave_value = (wave_value + POI_FX_ONE) / 2; // Map -1 to 1 to 0 to 1
+
+        // Combine global hue, wave value, and led position for color diversity
+        // Added current_pixel_brightness into hue calculation for more color diversity
+        hue[led_idx] = poi_fx_hue(st.hue_offset + wave_value * 240 + led_idx * (50 << 16) / NUM_LEDS);
+
+        // Brightness affected by wave value and audio amplitude
+        int32_t pixel_brightness = poi_fx_mul(effective_brightness, POI_FX_ONE / 2 + wave_value / 2);
+        level[led_idx] = poi_fx_clamp(pixel_brightness, MIN_BRIGHTNESS, POI_FX_ONE);
+    }
+    poi_palette_map(&pal_rainbow, hue, level, p, leds(l));
+}
+
+
+void mode_audio_bass_pulse(stateless &, const input &in, uint8_t *p, size_t l) {
+    // Average the lowest few frequency bins for bass
+    int32_t bass_magnitude_sum = 0;
+    int num_bass_bins = 3;
+    for (int i = 0; i < num_bass_bins; i++) {
+        bass_magnitude_sum += in.spectrum_q8[i];
+    }
+    int32_t normalized_bass = db_norm(bass_magnitude_sum / num_bass_bins, 65); // Slightly more sensitive bass range
+
+    // Analyze mid and higher frequency bins for nuanced high tones/melody
+    int32_t mid_magnitude_sum = 0;
+    int32_t treble_magnitude_sum = 0;
+    int32_t max_treble_magnitude = -100 * 256;
+    int peak_treble_bin = num_bass_bins;
+
+    int num_mid_bins_start = num_bass_bins;
+    int num_mid_bins_end = num_bass_bins + (N_SAMPLES / 2 - num_bass_bins) / 2; // Middle half of remaining bins
+
+    int num_treble_bins_start = num_mid_bins_end;
+    int num_treble_bins_end = N_SAMPLES / 2;
+
+    for (int i = num_mid_bins_start; i < num_mid_bins_end; i++) {
+        mid_magnitude_sum += in.spectrum_q8[i];
+    }
+    for (int i = num_treble_bins_start; i < num_treble_bins_end; i++) {
+        treble_magnitude_sum += in.spectrum_q8[i];
+        if (in.spectrum_q8[i] > max_treble_magnitude) {
+            max_treble_magnitude = in.spectrum_q8[i];
+            peak_treble_bin = i;
+        }
+    }
+
+    int32_t avg_mid_magnitude = (num_mid_bins_end - num_mid_bins_start > 0) ? (mid_magnitude_sum / (num_mid_bins_end - num_mid_bins_start)) : 0;
+    int32_t avg_treble_magnitude = (num_treble_bins_end - num_treble_bins_start > 0) ? (treble_magnitude_sum / (num_treble_bins_end - num_treble_bins_start)) : 0;
+
+    int32_t normalized_mid_avg = db_norm(avg_mid_magnitude, 65);
+    int32_t normalized_treble_avg = db_norm(avg_treble_magnitude, 65);
+    int32_t normalized_treble_peak_val = db_norm(max_treble_magnitude, 65);
+
+    int32_t normalized_amplitude = audio_norm(in, 15); // Adjust multiplier as needed
+
+
+    // Base brightness always present, boosted by all frequency components
+    int32_t effective_base_brightness = poi_fx_mul(normalized_bass, POI_FX_Q15(0.6)) + poi_fx_mul(normalized_mid_avg, POI_FX_Q15(0.3)) +
+                                        poi_fx_mul(normalized_treble_avg, POI_FX_Q15(0.2)) + MIN_BRIGHTNESS * 3 / 2;
+    if (effective_base_brightness < MIN_BRIGHTNESS * 2) effective_base_brightness = MIN_BRIGHTNESS * 2;
+
+
+    // The colours don't depend on the LED, only the sparkle does
+    // Base color for bass: red/orange, pulsating with bass intensity
+    uint8_t hue_bass = (uint8_t)((normalized_bass * 60) >> 15); // Red (0) to Yellow (60) for more range
+    uint32_t colour = poi_palette_lookup(&pal_rainbow, hue_bass);
+    int32_t color_brightness = effective_base_brightness;
+
+    // Mid tones add a different nuance (e.g., green/yellow)
+    if (normalized_mid_avg > POI_FX_Q15(0.1)) {
+        int32_t mid_influence_factor = poi_fx_mul(normalized_mid_avg, POI_FX_Q15(0.9));
+        uint8_t mid_hue = (uint8_t)(60 + ((normalized_mid_avg * 30) >> 15)); // Yellow to Greenish
+        colour = poi_palette_lerp(colour, poi_palette_lookup(&pal_rainbow, mid_hue), mid_influence_factor);
+        if (mid_influence_factor > color_brightness) color_brightness = mid_influence_factor;
+    }
+
+    // High tones add a distinct color (e.g., blue/purple)
+    if (normalized_treble_avg > POI_FX_Q15(0.1)) {
+        int32_t treble_influence_factor = normalized_treble_avg;
+
+        uint8_t treble_hue = (uint8_t)((peak_treble_bin - num_treble_bins_start) * 90 / (num_treble_bins_end - num_treble_bins_start) + 180); // Blue to Magenta range
+
+        colour = poi_palette_lerp(colour, poi_palette_lookup(&pal_rainbow, treble_hue), treble_influence_factor);
+        if (treble_influence_factor > color_brightness) color_brightness = treble_influence_factor;
+    }
+
+    int32_t amplitude_boost = POI_FX_Q15(0.7) + poi_fx_mul(normalized_amplitude, POI_FX_Q15(0.3)); // Overall amplitude for final boost
+    int32_t peak_pos_norm = peak_treble_bin * POI_FX_ONE / (N_SAMPLES / 2 - 1); // 0 to 1
+
+    uint16_t level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        int32_t current_pixel_brightness = color_brightness;
+
+        // Apply slight "sparkle" or intensity boost for very strong high-frequency peaks
+        if (normalized_treble_peak_val > POI_FX_ONE / 2) {
+            int32_t sparkle_intensity = poi_fx_mul(normalized_treble_peak_val, POI_FX_Q15(0.8));
+            // Localize sparkle based on LED position relative to peak_treble_bin
+            int32_t led_pos_norm = led_idx * POI_FX_ONE / (NUM_LEDS - 1);
+            int32_t distance_from_treble_peak = poi_fx_abs(led_pos_norm - peak_pos_norm);
+
+            sparkle_intensity = poi_fx_mul(sparkle_intensity, POI_FX_ONE - distance_from_treble_peak * 2); // Falloff
+            if (sparkle_intensity > current_pixel_brightness) current_pixel_brightness = sparkle_intensity;
+        }
+
+
+        // Apply final brightness and ensure minimum light
+        int32_t final_pixel_brightness = poi_fx_mul(current_pixel_brightness, amplitude_boost);
+        level[led_idx] = poi_fx_clamp(final_pixel_brightness, MIN_BRIGHTNESS, POI_FX_ONE);
+    }
+    poi_palette_shade(colour, level, p, leds(l));
+}
+
+void mode_audio_motion_fusion(audio_motion_fusion_state &st, const input &in, uint8_t *p, size_t l) {
+    // Calculate overall acceleration magnitude for motion reactivity
+    int32_t current_accel_magnitude = poi_fx_hypot3(POI_FX_FROM(in.imu.accelX, 10), POI_FX_FROM(in.imu.accelY, 10), POI_FX_FROM(in.imu.accelZ, 10));
+    int32_t delta_accel_magnitude = poi_fx_abs(current_accel_magnitude - st.last_accel_magnitude);
+    st.last_accel_magnitude = current_accel_magnitude;
+
+    // Smoothed gyroscope Z for rotation influence, Q16
+    int32_t smoothed_gyro_z = poi_fx_abs(POI_FX_FROM(in.imu.gyroZ, 8)) * 256 / 50; // Stronger influence from spin
+
+    // **Highly sensitive audio reaction**
+    int32_t audio_reactivity = audio_norm(in, 20);
+
+    // Base brightness always present, with a high floor, and highly boosted by audio
+    int32_t base_brightness = audio_reactivity + MIN_BRIGHTNESS * 3 / 2;
+    if (base_brightness < MIN_BRIGHTNESS * 3) base_brightness = MIN_BRIGHTNESS * 3;
+
+    // Motion influences global hue cycle speed and a secondary pattern
+    st.global_hue_cycle += anim(in, POI_FX_Q16(0.1) + smoothed_gyro_z / 2); // Spin speeds up hue cycle
+    st.global_hue_cycle = poi_fx_hue_wrap(st.global_hue_cycle);
+
+    // Motion flow influenced by gyro (speed) and accel (jerkiness), radians Q16
+    int32_t motion_flow_speed = POI_FX_Q16(0.1) + poi_fx_mul16(smoothed_gyro_z, POI_FX_Q16(0.3)) + (delta_accel_magnitude << 6) * 5;
+    if (motion_flow_speed > POI_FX_Q16(2.0)) motion_flow_speed = POI_FX_Q16(2.0);
+    uint16_t flow_angle = (uint16_t)(poi_fx_rad_to_angle32(motion_flow_speed) >> 16);
+
+    // Saturation: always high, but audio can boost it to max
+    int32_t saturation = POI_FX_Q15(0.8) + audio_reactivity / 5;
+    if (saturation > POI_FX_ONE) saturation = POI_FX_ONE;
+
+    // Final brightness: influenced by base brightness, audio, and motion (gyro)
+    int32_t final_pixel_brightness = poi_fx_mul(base_brightness, POI_FX_Q15(0.8) + poi_fx_mul(audio_reactivity, POI_FX_Q15(0.4))) +
+                                     smoothed_gyro_z / 10; // smoothed_gyro_z * 0.2 as Q15
+    final_pixel_brightness = poi_fx_mul(final_pixel_brightness, saturation);
+    final_pixel_brightness = poi_fx_clamp(final_pixel_brightness, MIN_BRIGHTNESS, POI_FX_ONE); // Ensure min, apply saturation
+
+    uint8_t final_hue[NUM_LEDS];
+    uint16_t level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        // Core pattern: a flowing, motion-driven color gradient (sin of led_pos_norm * 4 pi + flow)
+        uint16_t angle = (uint16_t)(led_idx * 2 * 65536 / (NUM_LEDS - 1) + flow_angle);
+        uint8_t base_pattern_hue = poi_fx_hue(st.global_hue_cycle + led_idx * (150 << 16) / (NUM_LEDS - 1) + poi_fx_sin(angle) * 60);
+
+        // Audio layers on top, influencing a secondary color pulse or shift
+        uint8_t audio_layer_hue = (uint8_t)((base_pattern_hue + 90) % 255); // Complementary or shifted hue
+
+        // Interpolate between base and audio layer based on audio reactivity
+        if (audio_reactivity > POI_FX_Q15(0.1)) {
+            final_hue[led_idx] = poi_fx_lerp8(base_pattern_hue, audio_layer_hue, audio_reactivity);
+        } else {
+            final_hue[led_idx] = base_pattern_hue;
+        }
+        level[led_idx] = final_pixel_brightness;
+    }
+    poi_palette_map(&pal_rainbow, final_hue, level, p, leds(l));
+}
+
+void mode_audio_peak_color(audio_peak_color_state &st, const input &in, uint8_t *p, size_t l) {
+    int32_t max_magnitude = -100 * 256;
+    int peak_bin = 0;
+    int num_spectrum_bins = N_SAMPLES / 2;
+    int32_t normalized_overall_amplitude = audio_norm(in, 10); // Increased overall audio reactivity
+
+    for (int i = 0; i < num_spectrum_bins; i++) {
+        if (in.spectrum_q8[i] > max_magnitude) {
+            max_magnitude = in.spectrum_q8[i];
+            peak_bin = i;
+        }
+    }
+
+    int32_t normalized_peak = db_norm(max_magnitude, 65); // Slightly more sensitive peak detection
+
+    // Hue for the peak, slightly dynamic based on peak_bin or motion
+    uint8_t peak_hue = (uint8_t)(peak_bin * 190 / (num_spectrum_bins - 1)); // Wider peak hue range
+    peak_hue = poi_fx_hue((peak_hue << 16) + st.global_hue_offset);
+
+    // Background hue cycle, more influenced by overall audio
+    st.global_hue_offset += anim(in, POI_FX_Q16(0.2) + poi_fx_mul(normalized_overall_amplitude, POI_FX_Q15(0.8)) * 2);
+    st.global_hue_offset = poi_fx_hue_wrap(st.global_hue_offset);
+
+    // Peak traveling effect - smoother and more responsive to peak changes
+    int32_t target_peak_led_pos = (peak_bin * (NUM_LEDS - 1) << 16) / (num_spectrum_bins - 1);
+    st.peak_travel_pos = (st.peak_travel_pos * 7 + target_peak_led_pos * 3 + 5) / 10; // Faster smoothing
+
+    // Base background color, more reactive to overall audio amplitude
+    int32_t background_brightness = MIN_BRIGHTNESS + poi_fx_mul(normalized_overall_amplitude, POI_FX_Q15(0.4)); // Stronger, more reactive background
+    int32_t blend_gain = POI_FX_Q15(0.9) + poi_fx_mul(normalized_overall_amplitude, POI_FX_Q15(0.3));
+
+    uint8_t background_hue[NUM_LEDS], peak_hues[NUM_LEDS];
+    uint16_t blend_factors[NUM_LEDS], level[NUM_LEDS];
+    memset(peak_hues, peak_hue, NUM_LEDS);
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        background_hue[led_idx] = poi_fx_hue(st.global_hue_offset + led_idx * (7 << 16)); // Faster background animation
+
+        // Calculate influence from the traveling peak
+        int32_t distance_from_traveling_peak = poi_fx_abs((led_idx << 16) - st.peak_travel_pos);
+
+        // **Significantly wider exponential falloff from the traveling peak** (over NUM_LEDS / 2)
+        int32_t peak_falloff = poi_fx_exp_neg(distance_from_traveling_peak * 2 / NUM_LEDS); // Much wider spread
+
+        // Combine with normalized peak magnitude for intensity
+        int32_t peak_effect_intensity = poi_fx_mul(normalized_peak, peak_falloff);
+
+        // Blend peak color and background color - stronger blend
+        int32_t blend_factor = poi_fx_mul(peak_effect_intensity, blend_gain);
+        blend_factors[led_idx] = blend_factor < POI_FX_ONE ? blend_factor : POI_FX_ONE;
+
+        // Brightness is influenced by peak effect, but with an even stronger minimum floor
+        int32_t current_brightness = background_brightness + peak_effect_intensity;
+        level[led_idx] = current_brightness < POI_FX_ONE ? current_brightness : POI_FX_ONE;
+    }
+    poi_palette_blend(&pal_rainbow, background_hue, peak_hues, blend_factors, level, p, leds(l));
+}
+void mode_audio_rainbow_cycle(audio_rainbow_cycle_state &st, const input &in, uint8_t *p, size_t l) {
+    const int32_t BASE_CYCLE_SPEED = POI_FX_Q16(0.1); // Slowest cycle speed
+    const int32_t AUDIO_SPEED_MULTIPLIER = 8; // How much audio speeds up the cycle
+    const int32_t BASE_RAINBOW_SPREAD = POI_FX_Q16(2.0); // Base number of full rainbow cycles along the strip
+    const int32_t AUDIO_SPREAD_MODULATOR = POI_FX_Q15(0.8); // How much audio changes the spread
+    const int32_t BRIGHTNESS_PULSATION_STRENGTH = POI_FX_Q15(0.2); // How much brightness pulsates with audio
+
+    int32_t normalized_amplitude = audio_norm(in, 15); // Higher sensitivity
+
+    // Smooth amplitude for less "jumpy" reactions
+    st.current_amplitude_smooth = (st.current_amplitude_smooth * 9 + normalized_amplitude + 5) / 10;
+
+    // Cycle speed: base speed + audio influence
+    int32_t cycle_speed = BASE_CYCLE_SPEED + st.current_amplitude_smooth * 2 * AUDIO_SPEED_MULTIPLIER;
+    st.global_hue_offset = poi_fx_hue_wrap(st.global_hue_offset + anim(in, cycle_speed));
+
+    // Rainbow spread: base spread, modulated by audio
+    int32_t rainbow_spread = BASE_RAINBOW_SPREAD + poi_fx_mul(st.current_amplitude_smooth, AUDIO_SPREAD_MODULATOR) * 2;
+
+    // Base brightness: always present, subtly modulated by audio pulse
+    int32_t base_overall_brightness = MIN_BRIGHTNESS * 2 + st.current_amplitude_smooth / 2;
+    if (base_overall_brightness < MIN_BRIGHTNESS * 5 / 2) base_overall_brightness = MIN_BRIGHTNESS * 5 / 2;
+
+    // Add a subtle brightness pulsation based on audio (sin of st.global_hue_offset / 10 radians)
+    int32_t pulse = poi_fx_sin((uint16_t)(poi_fx_rad_to_angle32(st.global_hue_offset / 10) >> 16));
+    base_overall_brightness = poi_fx_mul(base_overall_brightness, POI_FX_ONE + poi_fx_mul(poi_fx_mul(BRIGHTNESS_PULSATION_STRENGTH, pulse), st.current_amplitude_smooth));
+
+    // Saturation: always high, audio boosts it slightly
+    int32_t saturation_mod = POI_FX_Q15(0.9) + st.current_amplitude_smooth / 10;
+    if (saturation_mod > POI_FX_ONE) saturation_mod = POI_FX_ONE;
+
+    // Apply brightness
+    int32_t final_pixel_brightness = poi_fx_mul(base_overall_brightness, saturation_mod);
+    final_pixel_brightness = poi_fx_clamp(final_pixel_brightness, MIN_BRIGHTNESS, POI_FX_ONE); // Ensure minimum light
+
+    uint8_t hue[NUM_LEDS];
+    uint16_t level[NUM_LEDS];
+    int32_t led_step = poi_fx_mul16((255 << 16) / NUM_LEDS, rainbow_spread);
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        // Hue calculation: global offset + LED position modulated by dynamic spread
+        hue[led_idx] = poi_fx_hue(st.global_hue_offset + led_idx * led_step);
+        level[led_idx] = final_pixel_brightness;
+    }
+    poi_palette_map(&pal_rainbow, hue, level, p, leds(l));
+}
+
+void mode_audio_vu_meter(audio_vu_meter_state &st, const input &in, uint8_t *p, size_t l) {
+    int32_t normalized_amplitude = audio_norm(in, 20); // Significantly increased sensitivity
+
+    // Smooth amplitude for less flickering
+    st.smoothed_amplitude = (st.smoothed_amplitude * 4 + normalized_amplitude + 2) / 5;
+
+    // Shift global hue slowly, influenced by audio activity
+    st.global_hue_offset = poi_fx_hue_wrap(st.global_hue_offset + anim(in, POI_FX_Q16(0.05) + st.smoothed_amplitude));
+
+    // Calculate how many LEDs should be active based on smoothed amplitude
+    int active_leds = st.smoothed_amplitude * NUM_LEDS >> 15;
+    if (active_leds > NUM_LEDS) active_leds = NUM_LEDS;
+
+    // Base brightness for inactive LEDs, subtly pulsing (sin of st.global_hue_offset / 20 radians)
+    int32_t pulse = poi_fx_sin((uint16_t)(poi_fx_rad_to_angle32(st.global_hue_offset / 20) >> 16));
+    int32_t inactive_base_brightness = poi_fx_mul(MIN_BRIGHTNESS * 3 / 2, POI_FX_Q15(0.8) + pulse / 5);
+    if (inactive_base_brightness < MIN_BRIGHTNESS) inactive_base_brightness = MIN_BRIGHTNESS;
+
+    // Active VU meter LEDs: brighter, more proportional to amplitude
+    int32_t active_brightness = poi_fx_mul(st.smoothed_amplitude, POI_FX_Q15(1.2)) + POI_FX_Q15(0.1);
+    if (active_brightness > POI_FX_ONE) active_brightness = POI_FX_ONE;
+
+    uint8_t hue[NUM_LEDS];
+    uint16_t level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        if (led_idx < active_leds) {
+            // Active VU meter LEDs have dynamic colors
+            // Wider hue range, influenced by global hue and meter progress
+            hue[led_idx] = poi_fx_hue(st.global_hue_offset + led_idx * (170 << 16) / (NUM_LEDS - 1));
+            level[led_idx] = active_brightness;
+        } else {
+            // Inactive LEDs show a subtle base color, shifted by global hue
+            hue[led_idx] = poi_fx_hue(st.global_hue_offset + led_idx * (5 << 16));
+            level[led_idx] = inactive_base_brightness;
+        }
+    }
+    poi_palette_map(&pal_rainbow, hue, level, p, leds(l));
+}
+
+void mode_audio_beat_fade(audio_beat_fade_state &st, const input &in, uint8_t *p, size_t l) {
+    // Tuned constants for less flicker, more regularity, and compressed brightness range
+    const int32_t MIN_AUDIO_LEVEL_FOR_BEAT = POI_FX_Q15(0.08); // Even lower threshold for beat detection
+    const int32_t BEAT_SENSITIVITY = POI_FX_Q15(0.15); // Slightly higher sensitivity to detect clearer peaks
+    const int32_t BRIGHTNESS_DECAY_RATE = POI_FX_Q15(0.04); // Even slower decay for much less flicker
+    const int BEATS_PER_COLOR_CHANGE = 4;
+    const int32_t HUE_TRANSITION_RATE = POI_FX_Q16(0.02); // Slower, smoother hue transition
+
+    int32_t normalized_amplitude = audio_norm(in, 18); // Even more amplified sensitivity
+
+    // Improved Beat Detection: look for a significant rise from a low point
+    if (normalized_amplitude > MIN_AUDIO_LEVEL_FOR_BEAT &&
+        (normalized_amplitude - st.last_normalized_amplitude > BEAT_SENSITIVITY)) {
+
+        st.beat_count++;
+        st.current_beat_brightness_boost = POI_FX_ONE; // Max boost on beat
+
+        if (st.beat_count >= BEATS_PER_COLOR_CHANGE) {
+            st.target_base_hue = (st.target_base_hue + ((90 + (int32_t)(in.random % 60)) << 16)) % POI_FX_HUE_TURN; // More distinct and random color shift
+            st.beat_count = 0;
+        }
+    }
+    st.last_normalized_amplitude = normalized_amplitude;
+
+    // Smoothly transition current hue towards target hue
+    st.current_fade_hue += poi_fx_mul16(st.target_base_hue - st.current_fade_hue, HUE_TRANSITION_RATE);
+    st.current_fade_hue %= POI_FX_HUE_TURN;
+    if (st.current_fade_hue < 0) st.current_fade_hue += POI_FX_HUE_TURN;
+
+    // Decay brightness boost smoothly
+    st.current_beat_brightness_boost -= BRIGHTNESS_DECAY_RATE;
+    if (st.current_beat_brightness_boost < 0) st.current_beat_brightness_boost = 0;
+
+    // Calculate base brightness, ensuring minimum light and adding smooth beat boost
+    // Goal: less difference between max brightness and base brightness
+    int32_t base_overall_brightness = MIN_BRIGHTNESS * 5 / 2 + poi_fx_mul(normalized_amplitude, POI_FX_Q15(0.3)); // Higher floor, lower direct amplitude scaling
+    if (base_overall_brightness < MIN_BRIGHTNESS * 7 / 2) base_overall_brightness = MIN_BRIGHTNESS * 7 / 2;
+    base_overall_brightness += poi_fx_mul(st.current_beat_brightness_boost, POI_FX_Q15(0.3)); // Even smaller beat boost relative to base (compressing range)
+
+    uint32_t colour = poi_palette_lookup(&pal_rainbow, (uint8_t)(st.current_fade_hue >> 16));
+
+    // Optional: Subtle individual LED reaction to audio amplitude
+    // Reduced individual reaction contribution to avoid flicker and maintain compressed range
+    int32_t individual_led_audio_reaction = poi_fx_mul(normalized_amplitude, POI_FX_Q15(0.3));
+
+    uint16_t level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        int32_t pixel_brightness = base_overall_brightness;
+        pixel_brightness += poi_fx_mul(individual_led_audio_reaction, poi_fx_sin((uint16_t)(led_idx * 32768 / NUM_LEDS))); // Use sine for gentle spread
+
+        level[led_idx] = poi_fx_clamp(pixel_brightness, MIN_BRIGHTNESS, POI_FX_ONE); // Ensure minimum light
+    }
+    poi_palette_shade(colour, level, p, leds(l));
+}
+
+void mode_audio_frequency_lava(audio_frequency_lava_state &st, const input &in, uint8_t *p, size_t l) {
+    const int32_t BASE_FLOW_SPEED = POI_FX_Q16(0.05); // Base speed of the lava flow
+    const int32_t HUE_SPREAD = 80;                    // How much hues spread out in blobs
+
+    int32_t normalized_amplitude = audio_norm(in, 10); // Overall audio reactivity
+
+    // Analyze frequency bands
+    int32_t low_freq_mag = in.spectrum_q8[0]; // First bin for low frequencies
+    int32_t mid_freq_mag = (in.spectrum_q8[1] + in.spectrum_q8[2]) / 2; // Mid bins
+    int32_t high_freq_mag = in.spectrum_q8[N_SAMPLES / 2 - 1]; // Highest bin for high frequencies
+
+    int32_t normalized_low = db_norm(low_freq_mag, 60);
+    int32_t normalized_mid = db_norm(mid_freq_mag, 60);
+    int32_t normalized_high = db_norm(high_freq_mag, 60);
+
+    // Overall global hue slowly shifts
+    st.global_hue_shift = poi_fx_hue_wrap(st.global_hue_shift + anim(in, POI_FX_Q16(0.1)));
+
+    // Flow speed influenced by overall audio amplitude
+    st.flow_position += anim(in, BASE_FLOW_SPEED + poi_fx_mul(normalized_amplitude, POI_FX_Q15(0.2)) * 2);
+    if (st.flow_position >= (NUM_LEDS * 2) << 16) st.flow_position -= (NUM_LEDS * 2) << 16; // Cycle flow
+    uint16_t flow_angle = (uint16_t)(poi_fx_rad_to_angle32(st.flow_position / 10) >> 16);
+
+    int32_t base_brightness = poi_fx_mul(normalized_amplitude, POI_FX_Q15(0.4)) + MIN_BRIGHTNESS;
+    if (base_brightness < MIN_BRIGHTNESS * 3 / 2) base_brightness = MIN_BRIGHTNESS * 3 / 2;
+    int32_t glow = POI_FX_ONE + normalized_amplitude / 2;
+
+    uint8_t base_lava_hue[NUM_LEDS], band_hue[NUM_LEDS];
+    uint16_t blend_factor[NUM_LEDS], level[NUM_LEDS];
+    for (int led_idx = 0; led_idx < NUM_LEDS; led_idx++) {
+        int32_t current_pixel_brightness = base_brightness;
+
+        // Base lava color with slight modulation from flow (sin of led / NUM_LEDS * pi + flow / 10)
+        uint16_t angle = (uint16_t)(led_idx * 32768 / NUM_LEDS + flow_angle);
+        base_lava_hue[led_idx] = poi_fx_hue(st.global_hue_shift + poi_fx_sin(angle) * 40);
+
+        // Frequency band influence: create "blobs" of color or brighter areas
+        int32_t band_influence = 0;
+
+        if (led_idx < NUM_LEDS / 3) { // Lower part of strip for low frequencies
+            band_influence = normalized_low;
+            band_hue[led_idx] = poi_fx_hue(st.global_hue_shift + 0); // Reds/Oranges
+        } else if (led_idx < NUM_LEDS * 2 / 3) { // Middle part for mid frequencies
+            band_influence = normalized_mid;
+            band_hue[led_idx] = poi_fx_hue(st.global_hue_shift + (HUE_SPREAD << 16)); // Yellows/Greens
+        } else { // Upper part for high frequencies
+            band_influence = normalized_high;
+            band_hue[led_idx] = poi_fx_hue(st.global_hue_shift + (HUE_SPREAD * 2 << 16)); // Blues/Violets
+        }
+
+        // Localized brightness boost and color shift from frequency bands
+        blend_factor[led_idx] = 0;
+        if (band_influence > POI_FX_Q15(0.1)) {
+            blend_factor[led_idx] = poi_fx_mul(band_influence, POI_FX_Q15(0.8)); // Stronger blend
+            if (blend_factor[led_idx] > current_pixel_brightness) current_pixel_brightness = blend_factor[led_idx]; // Boost brightness
+        }
+
+        // Overall amplitude can make the lava "bubble" or glow more intensely
+        current_pixel_brightness = poi_fx_mul(current_pixel_brightness, glow);
+
+        level[led_idx] = poi_fx_clamp(current_pixel_brightness, MIN_BRIGHTNESS, POI_FX_ONE);
+    }
+    poi_palette_blend(&pal_rainbow, base_lava_hue, band_hue, blend_factor, level, p, leds(l));
+}
+
+} // namespace poi_modes
@@ -0,0 +1,166 @@
+#ifndef POI_MODES_H
+#define POI_MODES_H
+
+// The poi render modes and their registry (see poi_mode_registry.h). A mode
+// renders POI_MODE_LEDS LEDs into rgb from one input snapshot, which the
+// caller fills once per frame: the modes take no locks, read no globals and
+// get their random numbers from the input, so the same state and inputs
+// always give the same frame. Registry order is the order of the UI's mode
+// screens.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "qmi8658.h"
+#include "poi_fixed.h"
+#include "poi_mode_registry.h"
+#include "poi_mode_stack.h"
+
+#define POI_MODE_LEDS 21 // Canonical render resolution; each poi gets it resampled to its own LED count
+#define POI_MODE_BINS 8  // Spectrum bins in an input, the lower half of a 16-point FFT
+
+namespace poi_modes {
+
+struct input {
+    qmi8658_data_t imu;                 // Accel in g, gyro in dps, as of lead_us before the poi show the frame (NEEDS_IMU)
+    int32_t audio_level;                // Mean |windowed sample|, Q15 (NEEDS_AUDIO)
+    int32_t spectrum_q8[POI_MODE_BINS]; // Magnitudes in dB, Q8 (NEEDS_AUDIO)
+    int32_t anim_step_q16;              // Frame interval relative to the 25 fps the per-frame steps were tuned at, Q16
+    uint32_t random;                    // Fresh random bits every frame
+    int32_t lead_us;                    // How long after the state in imu the poi show the frame
+};
+
+// Build the palettes the modes colour through; once, before any render
+void init(void);
+
+struct centrifugal_rainbow_state {
+    int32_t hue = 0; // Q16
+};
+
+struct velocity_prism_state {
+    int32_t smoothed_vel = 0; // Q8, dps
+    int32_t hue_offset = 0;   // Q16
+};
+
+struct plasma_ghost_state {
+    int32_t global_hue = 0;   // Q16
+    uint32_t plasma_seed = 0; // For subtle, organic movement; binary angle, 1 << 32 = one turn
+};
+
+struct shifting_horizon_state {
+    int32_t hue_offset = 0;                        // Q16
+    int32_t horizon_pos_smoothed = POI_FX_ONE / 2; // Normalized position of the horizon line
+};
+
+struct compass_navigator_state {
+    int32_t global_hue_offset = 0; // Q16
+};
+
+struct pov_image_state {
+    uint32_t phase = 0; // Arm angle from hanging straight down at the last render; binary angle, 1 << 32 = one turn
+    uint32_t shown = 0; // The angle the last frame's column was picked for, the same way
+    int32_t dps = 0;    // gyroZ at the last render, Q8
+    int32_t along = 0;  // Accel along the arm averaged over turns while spinning, Q15 g
+    int32_t spin2 = 0;  // (rad/s)^2 averaged alongside it, Q8: along / spin2 is the arm's radius over g
+};
+
+struct audio_wave_state {
+    uint32_t wave_phase = 0; // Use phase for smoother wave motion; binary angle, 1 << 32 = one turn
+    int32_t hue_offset = 0;  // Global hue offset for color diversity, Q16
+};
+
+struct audio_motion_fusion_state {
+    int32_t global_hue_cycle = 0;     // Q16
+    int32_t last_accel_magnitude = 0; // For subtle acceleration-based color shifts, Q10
+};
+
+struct audio_peak_color_state {
+    int32_t global_hue_offset = 0; // Q16
+    int32_t peak_travel_pos = 0;   // Q16, in LEDs
+};
+
+struct audio_rainbow_cycle_state {
+    int32_t global_hue_offset = 0;        // Continuous global hue shift, Q16
+    int32_t current_amplitude_smooth = 0; // Smoothed amplitude for reactivity, Q15
+};
+
+struct audio_vu_meter_state {
+    int32_t global_hue_offset = 0;  // For shifting overall color, Q16
+    int32_t smoothed_amplitude = 0; // For smoother reactions, Q15
+};
+
+struct audio_beat_fade_state {
+    int32_t current_beat_brightness_boost = 0; // Smoother brightness boost, Q15
+    int32_t last_normalized_amplitude = 0;
+    int beat_count = 0;
+    int32_t target_base_hue = 0;               // For smooth color transitions every N beats, Q16
+    int32_t current_fade_hue = 0;              // Currently displayed hue, Q16
+};
+
+struct audio_frequency_lava_state {
+    int32_t global_hue_shift = 0; // Overall lava color shift, Q16
+    int32_t flow_position = 0;    // Position of the "lava" flow, Q16
+};
+
+void mode_gravity_rainbow(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_spin_fire(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_centrifugal_rainbow(centrifugal_rainbow_state &st, const input &in, uint8_t *p, size_t l);
+void mode_flow_trail(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_gravity_compass(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_velocity_prism(velocity_prism_state &st, const input &in, uint8_t *p, size_t l);
+void mode_warp_speed(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_plasma_ghost(plasma_ghost_state &st, const input &in, uint8_t *p, size_t l);
+void mode_fire_ice_split(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_shifting_horizon(shifting_horizon_state &st, const input &in, uint8_t *p, size_t l);
+void mode_gravity_ball(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_compass_navigator(compass_navigator_state &st, const input &in, uint8_t *p, size_t l);
+void mode_pov_image(pov_image_state &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_spectrum(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_wave(audio_wave_state &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_bass_pulse(stateless &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_motion_fusion(audio_motion_fusion_state &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_peak_color(audio_peak_color_state &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_rainbow_cycle(audio_rainbow_cycle_state &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_vu_meter(audio_vu_meter_state &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_beat_fade(audio_beat_fade_state &st, const input &in, uint8_t *p, size_t l);
+void mode_audio_frequency_lava(audio_frequency_lava_state &st, const input &in, uint8_t *p, size_t l);
+
+// Layer opacities for stacks (poi_mode_stack.h), 0..255
+uint8_t opacity_bass(const input &in); // Bass loudness over the bass pulse's range (NEEDS_AUDIO)
+uint8_t opacity_spin(const input &in); // |gyroZ| up to two turns a second (NEEDS_IMU)
+
+// Bass pulse screened over the gravity rainbow, spin fire adding to it as the poi turn
+using rainbow_pulse = stack<POI_MODE_LEDS, layer<mode_gravity_rainbow>,
+                            layer<mode_spin_fire, POI_COMPOSE_ADD, opacity_spin>,
+                            layer<mode_audio_bass_pulse, POI_COMPOSE_SCREEN, opacity_bass>>;
+
+inline constexpr descriptor<input> registry[] = {
+    mode<mode_gravity_rainbow>("Gravity \n Rainbow", MOTION, NEEDS_IMU),
+    mode<mode_spin_fire>("Spin \n Fire", MOTION, NEEDS_IMU),
+    mode<mode_centrifugal_rainbow>("Centrifugal \n Rain", MOTION, NEEDS_IMU),
+    mode<mode_flow_trail>("Flow \n Trail", MOTION, NEEDS_IMU),
+    mode<mode_gravity_compass>("Gravity \n Compass", MOTION, NEEDS_IMU),
+    mode<mode_velocity_prism>("Velocity \n Prism", MOTION, NEEDS_IMU),
+    mode<mode_warp_speed>("Warp \n Speed", MOTION, NEEDS_IMU),
+    mode<mode_plasma_ghost>("Plasma \n Ghost", MOTION, NEEDS_IMU),
+    mode<mode_fire_ice_split>("Fire/Ice \n Split", MOTION, NEEDS_IMU),
+    mode<mode_shifting_horizon>("Shifting \n Horizon", MOTION, NEEDS_IMU),
+    mode<mode_gravity_ball>("Gravity \n Ball", MOTION, NEEDS_IMU),
+    mode<mode_compass_navigator>("Navigator", MOTION, NEEDS_IMU),
+    mode<mode_pov_image>("POV \n Heart", MOTION, NEEDS_IMU),
+    mode<rainbow_pulse::render>("Rainbow \n Pulse", MOTION, NEEDS_IMU | NEEDS_AUDIO), // The audio screen is full
+    mode<mode_audio_spectrum>("Audio Spectrum", AUDIO, NEEDS_AUDIO),
+    mode<mode_audio_wave>("Audio Wave", AUDIO, NEEDS_IMU | NEEDS_AUDIO),
+    mode<mode_audio_bass_pulse>("Audio Bass Pulse", AUDIO, NEEDS_AUDIO),
+    mode<mode_audio_motion_fusion>("Audio+Motion", AUDIO, NEEDS_IMU | NEEDS_AUDIO),
+    mode<mode_audio_peak_color>("Audio Peak", AUDIO, NEEDS_AUDIO),
+    mode<mode_audio_rainbow_cycle>("Audio \n Rainbow", AUDIO, NEEDS_AUDIO),
+    mode<mode_audio_vu_meter>("Audio \n VU Meter", AUDIO, NEEDS_AUDIO),
+    mode<mode_audio_beat_fade>("Audio \n Beat Fade", AUDIO, NEEDS_AUDIO),
+    mode<mode_audio_frequency_lava>("Audio \n Lava", AUDIO, NEEDS_AUDIO),
+};
+
+inline constexpr int COUNT = sizeof(registry) / sizeof(registry[0]);
+
+} // namespace poi_modes
+
+#endif // POI_MODES_H
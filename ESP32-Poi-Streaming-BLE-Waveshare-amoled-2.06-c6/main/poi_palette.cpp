@@ -0,0 +1,98 @@
+#include "poi_palette.h"
+#include <string.h>
+
+// Channel bytes of an entry: 0x00BBGGRR in memory on a little-endian core is R, G, B, 0
+static inline const uint8_t *entry(const poi_palette_t *pal, uint8_t i) {
+    return (const uint8_t *)&pal->rgb[i];
+}
+
+// Pixels to write one at a time before rgb + 3 * i is word aligned
+static inline int head_pixels(const uint8_t *rgb, int n) {
+    int h = (uintptr_t)rgb & 3; // 3 * h == -h (mod 4)
+    return h < n ? h : n;
+}
+
+static inline void store1(uint8_t *dst, uint32_t c) {
+    dst[0] = (uint8_t)c;
+    dst[1] = (uint8_t)(c >> 8);
+    dst[2] = (uint8_t)(c >> 16);
+}
+
+// Four packed pixels as three little-endian words; dst is word aligned
+static inline void store4(uint8_t *dst, uint32_t c0, uint32_t c1, uint32_t c2, uint32_t c3) {
+    uint32_t w[3] = { c0 | c1 << 24, c1 >> 8 | c2 << 16, c2 >> 16 | c3 << 8 };
+    memcpy(__builtin_assume_aligned(dst, 4), w, sizeof(w));
+}
+
+void poi_palette_rainbow(poi_palette_t *pal) {
+    for (int h = 0; h < POI_PALETTE_SIZE; h++) {
+        int s = h * 3;
+        if (s < 255) pal->rgb[h] = poi_palette_pack(255 - s, s, 0);
+        else if (s < 510) pal->rgb[h] = poi_palette_pack(0, 510 - s, s - 255);
+        else pal->rgb[h] = poi_palette_pack(s - 510, 0, 765 - s);
+    }
+}
+
+void poi_palette_gradient(poi_palette_t *pal, const poi_palette_stop_t *stops, int n) {
+    for (int k = 0; k + 1 < n; k++) {
+        const poi_palette_stop_t *a = &stops[k], *b = &stops[k + 1];
+        int span = b->pos - a->pos;
+        for (int i = a->pos; i <= b->pos; i++) {
+            int d = i - a->pos;
+            pal->rgb[i] = span == 0 ? poi_palette_pack(b->r, b->g, b->b) :
+                          poi_palette_pack(a->r + (b->r - a->r) * d / span,
+                                           a->g + (b->g - a->g) * d / span,
+                                           a->b + (b->b - a->b) * d / span);
+        }
+    }
+}
+
+void poi_palette_map(const poi_palette_t *pal, const uint8_t *idx, const uint16_t *level, uint8_t *rgb, int n) {
+    if (level) {
+        // Scaled channels are separate bytes already: storing them beats packing them
+        for (int i = 0; i < n; i++, rgb += 3) {
+            const uint8_t *c = entry(pal, idx[i]);
+            uint32_t l = level[i];
+            rgb[0] = (uint8_t)((c[0] * l) >> 15);
+            rgb[1] = (uint8_t)((c[1] * l) >> 15);
+            rgb[2] = (uint8_t)((c[2] * l) >> 15);
+        }
+        return;
+    }
+    int i = 0;
+    for (int head = head_pixels(rgb, n); i < head; i++) store1(&rgb[i * 3], pal->rgb[idx[i]]);
+    for (; i + 4 <= n; i += 4) {
+        store4(&rgb[i * 3], pal->rgb[idx[i]], pal->rgb[idx[i + 1]], pal->rgb[idx[i + 2]], pal->rgb[idx[i + 3]]);
+    }
+    for (; i < n; i++) store1(&rgb[i * 3], pal->rgb[idx[i]]);
+}
+
+void poi_palette_blend(const poi_palette_t *pal, const uint8_t *a, const uint8_t *b, const uint16_t *t,
+                       const uint16_t *level, uint8_t *rgb, int n) {
+    for (int i = 0; i < n; i++, rgb += 3) {
+        const uint8_t *ca = entry(pal, a[i]), *cb = entry(pal, b[i]);
+        uint32_t tb = t[i], ta = 32768 - tb;
+        uint32_t r = (ca[0] * ta + cb[0] * tb) >> 15;
+        uint32_t g = (ca[1] * ta + cb[1] * tb) >> 15;
+        uint32_t bl = (ca[2] * ta + cb[2] * tb) >> 15;
+        if (level) {
+            uint32_t l = level[i];
+            r = (r * l) >> 15;
+            g = (g * l) >> 15;
+            bl = (bl * l) >> 15;
+        }
+        rgb[0] = (uint8_t)r;
+        rgb[1] = (uint8_t)g;
+        rgb[2] = (uint8_t)bl;
+    }
+}
+
+void poi_palette_shade(uint32_t colour, const uint16_t *level, uint8_t *rgb, int n) {
+    uint32_t r = colour & 0xFF, g = (colour >> 8) & 0xFF, b = (colour >> 16) & 0xFF;
+    for (int i = 0; i < n; i++, rgb += 3) {
+        uint32_t l = level[i];
+        rgb[0] = (uint8_t)((r * l) >> 15);
+        rgb[1] = (uint8_t)((g * l) >> 15);
+        rgb[2] = (uint8_t)((b * l) >> 15);
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef POI_PALETTE_H
+#define POI_PALETTE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Whole-strip colour kernels. A mode fills per-LED arrays of palette index
+// and level, and one call turns them into packed RGB: a table load replaces
+// the hue branches, and unscaled strips go out four LEDs (12 bytes) to three
+// word stores once the output is word aligned. Scaled channels are stored
+// as bytes, since packing them would cost more than the stores it saves.
+//
+// Levels and blend weights are Q15 in [0, 32768] (see poi_fixed.h). The
+// results truncate exactly like poi_fx_scale8()/poi_fx_lerp8().
+
+#define POI_PALETTE_SIZE 256
+
+typedef struct {
+    uint32_t rgb[POI_PALETTE_SIZE]; // 0x00BBGGRR
+} poi_palette_t;
+
+typedef struct {
+    uint8_t pos; // Palette index this colour sits at
+    uint8_t r, g, b;
+} poi_palette_stop_t;
+
+static inline uint32_t poi_palette_pack(uint8_t r, uint8_t g, uint8_t b) {
+    return r | (uint32_t)g << 8 | (uint32_t)b << 16;
+}
+
+static inline uint32_t poi_palette_lookup(const poi_palette_t *pal, uint8_t i) {
+    return pal->rgb[i];
+}
+
+// Per channel a * (1 - t) + b * t on packed colours. Green is worked in
+// place: 0xFF00 * 32768 still fits in 32 bits, and the mask drops the bits
+// shifted in from below, so it truncates the same as the other channels.
+static inline uint32_t poi_palette_lerp(uint32_t a, uint32_t b, uint32_t t) {
+    uint32_t u = 32768 - t;
+    return ((a & 0xFF) * u + (b & 0xFF) * t) >> 15 |
+           (((a & 0xFF00) * u + (b & 0xFF00) * t) >> 15 & 0xFF00) |
+           (((a >> 16) * u + (b >> 16) * t) >> 15) << 16;
+}
+
+// The modes' hue wheel: red -> green -> blue -> red over 0..255
+void poi_palette_rainbow(poi_palette_t *pal);
+
+// Straight lines between n >= 2 stops in increasing pos, from pos 0 to pos 255
+void poi_palette_gradient(poi_palette_t *pal, const poi_palette_stop_t *stops, int n);
+
+// rgb[i] = pal[idx[i]] * level[i]; level NULL = full
+void poi_palette_map(const poi_palette_t *pal, const uint8_t *idx, const uint16_t *level, uint8_t *rgb, int n);
+
+// rgb[i] = lerp(pal[a[i]], pal[b[i]], t[i]) * level[i]; level NULL = full
+void poi_palette_blend(const poi_palette_t *pal, const uint8_t *a, const uint8_t *b, const uint16_t *t,
+                       const uint16_t *level, uint8_t *rgb, int n);
+
+// rgb[i] = colour * level[i]
+void poi_palette_shade(uint32_t colour, const uint16_t *level, uint8_t *rgb, int n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_PALETTE_H
@@ -0,0 +1,75 @@
+#include "poi_peer_cache.h"
+#include <string.h>
+#include "nvs.h"
+
+static bool same_addr(const poi_peer_t *p, uint8_t addr_type, const uint8_t addr[6]) {
+    return p->last_used != 0 && p->addr_type == addr_type && memcmp(p->addr, addr, sizeof(p->addr)) == 0;
+}
+
+esp_err_t poi_peer_cache_load(poi_peer_cache_t *c) {
+    memset(c, 0, sizeof(*c));
+    nvs_handle_t h;
+    esp_err_t err = nvs_open(POI_PEER_CACHE_NVS_NAMESPACE, NVS_READONLY, &h);
+    if (err != ESP_OK) return err; // Nothing saved yet
+
+    size_t len = sizeof(c->peer);
+    err = nvs_get_blob(h, POI_PEER_CACHE_NVS_KEY, c->peer, &len);
+    nvs_close(h);
+    if (err != ESP_OK || len != sizeof(c->peer)) {
+        memset(c->peer, 0, sizeof(c->peer)); // Missing or from another layout: relearn
+        return err != ESP_OK ? err : ESP_ERR_INVALID_SIZE;
+    }
+    for (int i = 0; i < POI_PEER_CACHE_SIZE; i++) {
+        if (c->peer[i].last_used > c->stamp) c->stamp = c->peer[i].last_used;
+    }
+    return ESP_OK;
+}
+
+esp_err_t poi_peer_cache_save(poi_peer_cache_t *c) {
+    if (!c->dirty) return ESP_OK;
+    nvs_handle_t h;
+    esp_err_t err = nvs_open(POI_PEER_CACHE_NVS_NAMESPACE, NVS_READWRITE, &h);
+    if (err != ESP_OK) return err;
+    err = nvs_set_blob(h, POI_PEER_CACHE_NVS_KEY, c->peer, sizeof(c->peer));
+    if (err == ESP_OK) err = nvs_commit(h);
+    nvs_close(h);
+    if (err == ESP_OK) c->dirty = false;
+    return err;
+}
+
+const poi_peer_t *poi_peer_cache_find(const poi_peer_cache_t *c, uint8_t addr_type, const uint8_t addr[6]) {
+    for (int i = 0; i < POI_PEER_CACHE_SIZE; i++) {
+        if (same_addr(&c->peer[i], addr_type, addr)) return &c->peer[i];
+    }
+    return NULL;
+}
+
+void poi_peer_cache_store(poi_peer_cache_t *c, const poi_peer_t *p) {
+    int slot = -1;
+    for (int i = 0; i < POI_PEER_CACHE_SIZE && slot < 0; i++) {
+        if (same_addr(&c->peer[i], p->addr_type, p->addr)) slot = i;
+    }
+    if (slot < 0) { // New poi: take an empty entry or the oldest one
+        slot = 0;
+        for (int i = 1; i < POI_PEER_CACHE_SIZE; i++) {
+            if (c->peer[i].last_used < c->peer[slot].last_used) slot = i;
+        }
+    }
+
+    poi_peer_t entry = *p;
+    entry.last_used = c->peer[slot].last_used;
+    if (same_addr(&c->peer[slot], p->addr_type, p->addr) && memcmp(&entry, &c->peer[slot], sizeof(entry)) == 0) return;
+
+    entry.last_used = ++c->stamp;
+    c->peer[slot] = entry;
+    c->dirty = true;
+}
+
+void poi_peer_cache_forget(poi_peer_cache_t *c, uint8_t addr_type, const uint8_t addr[6]) {
+    for (int i = 0; i < POI_PEER_CACHE_SIZE; i++) {
+        if (same_addr(&c->peer[i], addr_type, addr)) {
+            memset(&c->peer[i], 0, sizeof(c->peer[i]));
+            c->dirty = true;
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#ifndef POI_PEER_CACHE_H
+#define POI_PEER_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Poi we have streamed to before, kept in NVS so a reboot or a dropped link
+// can reconnect straight to known addresses and reuse their GATT handles
+// instead of scanning for the name and discovering every characteristic.
+
+#define POI_PEER_CACHE_SIZE 8 // Known poi remembered, the least recently changed is dropped first
+#define POI_PEER_CACHE_NVS_NAMESPACE "poi"
+#define POI_PEER_CACHE_NVS_KEY "peers"
+
+// One known poi; also the NVS record, so only append fields
+typedef struct {
+    uint8_t  addr_type;             // BLE_ADDR_* of the identity address
+    uint8_t  addr[6];
+    uint8_t  config_replied;        // Answered CC_GET_CONFIG, so a missing reply means stale handles
+    uint16_t rx_char_handle;
+    uint16_t tx_char_handle;
+    uint8_t  protocol_version;      // Last config
+    uint8_t  num_leds;
+    uint16_t frame_buffer_size;
+    uint16_t hardware_buffer_limit;
+    uint16_t tx_cccd_handle;        // Was zero padding, so older records read as 0 = not known
+    uint32_t last_used;             // Cache stamp of the last change, 0 = empty entry
+} poi_peer_t;
+
+typedef struct {
+    poi_peer_t peer[POI_PEER_CACHE_SIZE];
+    uint32_t   stamp;               // Highest last_used handed out
+    bool       dirty;               // Changed since the last save
+} poi_peer_cache_t;
+
+// Read the cache from NVS; starts empty if there is none or it doesn't match this layout
+esp_err_t poi_peer_cache_load(poi_peer_cache_t *c);
+
+// Write the cache to NVS if it changed since the last load or save
+esp_err_t poi_peer_cache_save(poi_peer_cache_t *c);
+
+// Entry for this address, or NULL
+const poi_peer_t *poi_peer_cache_find(const poi_peer_cache_t *c, uint8_t addr_type, const uint8_t addr[6]);
+
+// Insert or refresh p (its last_used is ignored), evicting the oldest entry if full.
+// An unchanged entry is left alone so routine reconnects don't wear the flash.
+void poi_peer_cache_store(poi_peer_cache_t *c, const poi_peer_t *p);
+
+// Drop the entry for this address, e.g. when its cached handles turned out stale
+void poi_peer_cache_forget(poi_peer_cache_t *c, uint8_t addr_type, const uint8_t addr[6]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_PEER_CACHE_H
@@ -0,0 +1,353 @@
+#ifndef POI_PROTOCOL_H
+#define POI_PROTOCOL_H
+
+// Poi wire protocol: command bytes, packet layouts, encoders into caller
+// buffers and a decoder for the notifications the poi sends on TX.
+// Header-only, no allocation, no ESP-IDF dependencies: builds on the host.
+//
+// Every packet is [START_BYTE][cmd][fields...], fields little endian.
+// Fixed-size packets are described by a struct with
+//   static constexpr uint8_t command;   the cmd byte
+//   static constexpr size_t wire_size;  whole packet, header included
+//   void put(uint8_t *p) const;         fields only, p points past the header
+//   static T get(const uint8_t *p);
+// Stream writes (CC_STREAM_*) and sequence chunks carry a variable payload
+// after a fixed header; poi_batch, poi_sync and poi_seq build and parse them
+// through the encoders here and take their length constants from these layouts.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <span>
+#include <concepts>
+
+namespace poi_proto {
+
+inline constexpr uint8_t START_BYTE  = 0xD0;
+inline constexpr uint8_t REQ_TRAILER = 0xD1; // Last byte of requests without arguments
+
+enum : uint8_t {
+    CC_START_STREAM      = 21,
+    CC_GET_CONFIG        = 23,
+    CC_STREAM_DATA       = 24, // [rgb...]
+    CC_STREAM_COMPRESSED = 25, // [type][body], see poi_frame_codec.h
+    CC_STREAM_BATCH      = 26, // Several timed frames in one write, see poi_batch.h
+    CC_STREAM_TIMED      = 27, // [seq][pts] + any stream write, see poi_sync.h
+    CC_TIME_SYNC         = 28, // Clock sync ping, answered by notification on TX
+    CC_SEQ_BEGIN         = 29, // Sequence upload and playback, see poi_seq.h
+    CC_SEQ_CHUNK         = 30,
+    CC_SEQ_END           = 31,
+    CC_SEQ_PLAY          = 32,
+    CC_STATUS            = 33, // Status notifications: the watch sets the period, the poi reports on TX
+};
+
+inline constexpr size_t HDR_LEN = 2; // [START_BYTE][cmd]
+
+constexpr void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+constexpr void put_u32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+constexpr uint16_t get_u16(const uint8_t *p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+constexpr uint32_t get_u32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+template <typename T>
+concept packet = requires(const T &m, uint8_t *out, const uint8_t *in) {
+    { T::command } -> std::convertible_to<uint8_t>;
+    { T::wire_size } -> std::convertible_to<size_t>;
+    m.put(out);
+    { T::get(in) } -> std::same_as<T>;
+};
+
+// --- Watch -> poi (RX characteristic) ---
+
+struct start_stream_req {
+    static constexpr uint8_t command = CC_START_STREAM;
+    static constexpr size_t wire_size = 3;
+    constexpr void put(uint8_t *p) const { p[0] = REQ_TRAILER; }
+    static constexpr start_stream_req get(const uint8_t *) { return {}; }
+};
+
+struct get_config_req {
+    static constexpr uint8_t command = CC_GET_CONFIG;
+    static constexpr size_t wire_size = 3;
+    constexpr void put(uint8_t *p) const { p[0] = REQ_TRAILER; }
+    static constexpr get_config_req get(const uint8_t *) { return {}; }
+};
+
+struct time_sync_req {
+    static constexpr uint8_t command = CC_TIME_SYNC;
+    static constexpr size_t wire_size = 6;
+    uint32_t t0_us; // Watch clock when sent
+    constexpr void put(uint8_t *p) const { put_u32(p, t0_us); }
+    static constexpr time_sync_req get(const uint8_t *p) { return {get_u32(p)}; }
+};
+
+// Prefix of a timed stream write; the wrapped write follows
+struct timed_hdr {
+    static constexpr uint8_t command = CC_STREAM_TIMED;
+    static constexpr size_t wire_size = 8;
+    uint16_t seq;
+    uint32_t pts_us; // Poi clock
+    constexpr void put(uint8_t *p) const { put_u16(p, seq); put_u32(&p[2], pts_us); }
+    static constexpr timed_hdr get(const uint8_t *p) { return {get_u16(p), get_u32(&p[2])}; }
+};
+
+// Several frames in one write: the header, then per frame a batch_frame and its body
+struct batch_hdr {
+    static constexpr uint8_t command = CC_STREAM_BATCH;
+    static constexpr size_t wire_size = 3;
+    uint8_t count;
+    constexpr void put(uint8_t *p) const { p[0] = count; }
+    static constexpr batch_hdr get(const uint8_t *p) { return {p[0]}; }
+};
+
+// Record in front of each frame of a batch; not a packet of its own, so no START_BYTE or cmd
+struct batch_frame {
+    static constexpr size_t wire_size = 3;
+    uint8_t dt_ms;
+    uint8_t cmd;
+    uint8_t len;
+    constexpr void put(uint8_t *p) const { p[0] = dt_ms; p[1] = cmd; p[2] = len; }
+    static constexpr batch_frame get(const uint8_t *p) { return {p[0], p[1], p[2]}; }
+};
+
+struct seq_begin_req {
+    static constexpr uint8_t command = CC_SEQ_BEGIN;
+    static constexpr size_t wire_size = 16;
+    uint8_t  id;
+    uint32_t len;
+    uint32_t crc;
+    uint16_t frames;
+    uint8_t  fps;
+    uint8_t  num_leds;
+    constexpr void put(uint8_t *p) const {
+        p[0] = id;
+        put_u32(&p[1], len);
+        put_u32(&p[5], crc);
+        put_u16(&p[9], frames);
+        p[11] = fps;
+        p[12] = num_leds;
+        p[13] = 0;
+    }
+    static constexpr seq_begin_req get(const uint8_t *p) {
+        return {p[0], get_u32(&p[1]), get_u32(&p[5]), get_u16(&p[9]), p[11], p[12]};
+    }
+};
+
+// Prefix of a sequence chunk; the data follows
+struct seq_chunk_hdr {
+    static constexpr uint8_t command = CC_SEQ_CHUNK;
+    static constexpr size_t wire_size = 7;
+    uint8_t  id;
+    uint32_t offset;
+    constexpr void put(uint8_t *p) const { p[0] = id; put_u32(&p[1], offset); }
+    static constexpr seq_chunk_hdr get(const uint8_t *p) { return {p[0], get_u32(&p[1])}; }
+};
+
+struct seq_end_req {
+    static constexpr uint8_t command = CC_SEQ_END;
+    static constexpr size_t wire_size = 3;
+    uint8_t id;
+    constexpr void put(uint8_t *p) const { p[0] = id; }
+    static constexpr seq_end_req get(const uint8_t *p) { return {p[0]}; }
+};
+
+struct seq_play_req {
+    static constexpr uint8_t command = CC_SEQ_PLAY;
+    static constexpr size_t wire_size = 9;
+    uint8_t  id;
+    uint16_t frame;
+    uint32_t pts_us; // Poi clock, 0 = on arrival
+    constexpr void put(uint8_t *p) const { p[0] = id; put_u16(&p[1], frame); put_u32(&p[3], pts_us); }
+    static constexpr seq_play_req get(const uint8_t *p) { return {p[0], get_u16(&p[1]), get_u32(&p[3])}; }
+};
+
+struct status_req {
+    static constexpr uint8_t command = CC_STATUS;
+    static constexpr size_t wire_size = 4;
+    uint16_t period_ms; // 0 = stop
+    constexpr void put(uint8_t *p) const { put_u16(p, period_ms); }
+    static constexpr status_req get(const uint8_t *p) { return {get_u16(p)}; }
+};
+
+// --- Poi -> watch (TX notifications) ---
+
+struct config_reply {
+    static constexpr uint8_t command = CC_GET_CONFIG;
+    static constexpr size_t wire_size = 12;
+    uint8_t  protocol_version;
+    uint8_t  num_leds;
+    uint16_t frame_buffer_size;
+    uint16_t hardware_buffer_limit; // Largest write the poi accepts, 0 = no limit
+    uint16_t battery_mv;
+    uint16_t free_space_kb;
+    constexpr void put(uint8_t *p) const {
+        p[0] = protocol_version;
+        p[1] = num_leds;
+        put_u16(&p[2], frame_buffer_size);
+        put_u16(&p[4], hardware_buffer_limit);
+        put_u16(&p[6], battery_mv);
+        put_u16(&p[8], free_space_kb);
+    }
+    static constexpr config_reply get(const uint8_t *p) {
+        return {p[0], p[1], get_u16(&p[2]), get_u16(&p[4]), get_u16(&p[6]), get_u16(&p[8])};
+    }
+};
+
+struct time_sync_reply {
+    static constexpr uint8_t command = CC_TIME_SYNC;
+    static constexpr size_t wire_size = 10;
+    uint32_t t0_us; // Echoed from the request
+    uint32_t t1_us; // Poi clock when answered
+    constexpr void put(uint8_t *p) const { put_u32(p, t0_us); put_u32(&p[4], t1_us); }
+    static constexpr time_sync_reply get(const uint8_t *p) { return {get_u32(p), get_u32(&p[4])}; }
+};
+
+// BEGIN and END are answered alike: how much of the sequence the poi holds
+template <uint8_t Cmd>
+struct seq_reply {
+    static constexpr uint8_t command = Cmd;
+    static constexpr size_t wire_size = 8;
+    uint8_t  id;
+    uint8_t  status; // poi_seq_status_t
+    uint32_t have;
+    constexpr void put(uint8_t *p) const { p[0] = id; p[1] = status; put_u32(&p[2], have); }
+    static constexpr seq_reply get(const uint8_t *p) { return {p[0], p[1], get_u32(&p[2])}; }
+};
+using seq_begin_reply = seq_reply<CC_SEQ_BEGIN>;
+using seq_end_reply = seq_reply<CC_SEQ_END>;
+
+// Sent every period_ms of the last status_req, and at once when a frame arrives too late to play
+struct status_reply {
+    static constexpr uint8_t command = CC_STATUS;
+    static constexpr size_t wire_size = 12;
+    uint16_t last_seq;      // Newest timed frame accepted (acknowledges it and all before)
+    uint8_t  queued;        // Frames waiting for their presentation time
+    uint8_t  queue_cap;     // Frames the poi can hold
+    uint16_t battery_mv;
+    uint16_t free_space_kb;
+    uint16_t late;          // Frames dropped for arriving after their pts (wraps)
+    constexpr void put(uint8_t *p) const {
+        put_u16(p, last_seq);
+        p[2] = queued;
+        p[3] = queue_cap;
+        put_u16(&p[4], battery_mv);
+        put_u16(&p[6], free_space_kb);
+        put_u16(&p[8], late);
+    }
+    static constexpr status_reply get(const uint8_t *p) {
+        return {get_u16(p), p[2], p[3], get_u16(&p[4]), get_u16(&p[6]), get_u16(&p[8])};
+    }
+};
+
+// Length of a notification by its cmd byte, 0 if the poi never sends it
+constexpr size_t reply_size(uint8_t cmd) {
+    switch (cmd) {
+        case CC_GET_CONFIG: return config_reply::wire_size;
+        case CC_TIME_SYNC:  return time_sync_reply::wire_size;
+        case CC_SEQ_BEGIN:  return seq_begin_reply::wire_size;
+        case CC_SEQ_END:    return seq_end_reply::wire_size;
+        case CC_STATUS:     return status_reply::wire_size;
+        default:            return 0;
+    }
+}
+
+inline constexpr size_t MAX_REPLY_SIZE = 12;
+
+// --- Encoding and decoding ---
+
+// Write m into out; returns its length, 0 if out is too small
+template <packet T>
+constexpr size_t encode(const T &m, std::span<uint8_t> out) {
+    if (out.size() < T::wire_size) return 0;
+    out[0] = START_BYTE;
+    out[1] = T::command;
+    m.put(&out[HDR_LEN]);
+    return T::wire_size;
+}
+
+// Header of a write whose payload the caller puts at out[HDR_LEN]; returns HDR_LEN
+constexpr size_t encode_hdr(uint8_t cmd, std::span<uint8_t> out) {
+    if (out.size() < HDR_LEN) return 0;
+    out[0] = START_BYTE;
+    out[1] = cmd;
+    return HDR_LEN;
+}
+
+// True (m filled) if in starts with a whole T. Bytes past it are left to the caller, the
+// payload after a header say; a reply is exactly reply_size(), notify_decoder cuts it there.
+template <packet T>
+constexpr bool decode(std::span<const uint8_t> in, T &m) {
+    if (in.size() < T::wire_size || in[0] != START_BYTE || in[1] != T::command) return false;
+    m = T::get(&in[HDR_LEN]);
+    return true;
+}
+
+// Reassembles notifications into whole packets whatever way they arrive:
+// one per notification, several in one, or split across notifications.
+// Bytes that don't start a known packet are skipped. Zero-initialised.
+class notify_decoder {
+public:
+    void reset() { len_ = 0; }
+
+    // Calls on_packet(std::span<const uint8_t>) for each whole packet in data
+    template <typename F>
+    void feed(std::span<const uint8_t> data, F &&on_packet) {
+        for (size_t i = 0; i < data.size();) {
+            if (len_ == 0 && data[i] != START_BYTE) { // Resync on the next start byte
+                skipped_++;
+                i++;
+                continue;
+            }
+            if (len_ < HDR_LEN) {
+                buf_[len_++] = data[i++];
+                if (len_ == HDR_LEN && reply_size(buf_[1]) == 0) drop_one();
+                continue;
+            }
+            size_t need = reply_size(buf_[1]);
+            size_t n = need - len_;
+            if (n > data.size() - i) n = data.size() - i;
+            memcpy(&buf_[len_], &data[i], n);
+            len_ += n;
+            i += n;
+            if (len_ == need) {
+                on_packet(std::span<const uint8_t>(buf_, len_));
+                len_ = 0;
+            }
+        }
+    }
+
+    uint32_t skipped() const { return skipped_; } // Bytes dropped while resyncing
+
+private:
+    // Unknown cmd: drop the start byte and rescan from the cmd byte, it may start a packet itself
+    void drop_one() {
+        skipped_++;
+        len_ = 0;
+        if (buf_[1] == START_BYTE) buf_[len_++] = START_BYTE;
+    }
+
+    uint8_t  buf_[MAX_REPLY_SIZE];
+    size_t   len_;
+    uint32_t skipped_;
+};
+
+static_assert(config_reply::wire_size <= MAX_REPLY_SIZE && time_sync_reply::wire_size <= MAX_REPLY_SIZE &&
+              seq_begin_reply::wire_size <= MAX_REPLY_SIZE && status_reply::wire_size <= MAX_REPLY_SIZE, "MAX_REPLY_SIZE");
+
+} // namespace poi_proto
+
+#endif // POI_PROTOCOL_H
@@ -0,0 +1,87 @@
+#include "poi_rate_ctl.h"
+#include <string.h>
+
+typedef struct {
+    bool    reduced_depth;
+    uint8_t frame_div;
+} level_t;
+
+// Colour depth goes first where the poi supports it: fewer frames is what shows most
+static const level_t packed4_ladder[] = {{false, 1}, {true, 1}, {true, 2}, {true, 3}, {true, 4}};
+static const level_t full_depth_ladder[] = {{false, 1}, {false, 2}, {false, 3}, {false, 4}};
+
+static void apply_level(poi_rate_ctl_t *c) {
+    const level_t *l = c->packed4 ? &packed4_ladder[c->level] : &full_depth_ladder[c->level];
+    c->reduced_depth = l->reduced_depth;
+    c->frame_div = l->frame_div;
+}
+
+static void start_period(poi_rate_ctl_t *c, const poi_tx_sched_t *tx, int64_t now_us) {
+    c->period_start_us = now_us;
+    c->busy_at_period = tx->busy_count;
+    c->superseded_at_period = tx->frames_superseded;
+    c->depth_sum = 0;
+    c->depth_samples = 0;
+    c->latency_max_us = 0;
+    c->late_frames = 0;
+}
+
+void poi_rate_ctl_init(poi_rate_ctl_t *c, const poi_tx_sched_t *tx, bool packed4, uint32_t latency_target_us, int64_t now_us) {
+    memset(c, 0, sizeof(*c));
+    c->packed4 = packed4;
+    c->max_level = packed4 ? sizeof(packed4_ladder) / sizeof(packed4_ladder[0]) - 1
+                           : sizeof(full_depth_ladder) / sizeof(full_depth_ladder[0]) - 1;
+    c->latency_target_us = latency_target_us;
+    c->recover_after = POI_RATE_CTL_RECOVER_MIN;
+    c->since_step_up = UINT8_MAX;
+    apply_level(c);
+    start_period(c, tx, now_us);
+}
+
+bool poi_rate_ctl_update(poi_rate_ctl_t *c, const poi_tx_sched_t *tx, int64_t now_us) {
+    if (now_us - c->period_start_us < POI_RATE_CTL_PERIOD_US) return false;
+
+    bool busy = tx->busy_count != c->busy_at_period;
+    bool superseded = tx->frames_superseded != c->superseded_at_period;
+    uint32_t n = c->depth_samples;
+    bool queue_full = n > 0 && c->depth_sum >= (POI_TX_MAX_IN_FLIGHT - 1) * n;
+    bool queue_low = c->depth_sum * 2 <= POI_TX_MAX_IN_FLIGHT * n;
+    bool congested = busy || superseded || queue_full || c->late_frames > 0 || c->latency_max_us > c->latency_target_us;
+    bool clear = !congested && queue_low && c->latency_max_us * 2 <= c->latency_target_us;
+    start_period(c, tx, now_us);
+
+    if (c->since_step_up < UINT8_MAX) c->since_step_up++;
+    if (c->hold_periods > 0) { // Still draining what queued up before the last step down
+        c->hold_periods--;
+        c->clear_periods = 0;
+        return false;
+    }
+    bool probing = c->since_step_up <= POI_RATE_CTL_PROBE_PERIODS;
+
+    if (congested) {
+        c->clear_periods = 0;
+        if (probing && c->recover_after < POI_RATE_CTL_RECOVER_MAX) c->recover_after *= 2; // The level above still doesn't fit
+        c->since_step_up = UINT8_MAX;
+        if (c->level == c->max_level) return false;
+        c->level++;
+        c->steps_down++;
+        c->hold_periods = POI_RATE_CTL_HOLD_PERIODS;
+        apply_level(c);
+        return true;
+    }
+
+    if (c->since_step_up == POI_RATE_CTL_PROBE_PERIODS + 1 && c->recover_after > POI_RATE_CTL_RECOVER_MIN) {
+        c->recover_after /= 2; // The last step up held, be quicker about the next one
+    }
+    if (!clear) {
+        c->clear_periods = 0;
+        return false;
+    }
+    if (++c->clear_periods < c->recover_after || c->level == 0) return false;
+    c->clear_periods = 0;
+    c->since_step_up = 0;
+    c->level--;
+    c->steps_up++;
+    apply_level(c);
+    return true;
+}
@@ -0,0 +1,93 @@
+#ifndef POI_RATE_CTL_H
+#define POI_RATE_CTL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "poi_tx_sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Per-link quality controller: when a link can't keep up, trade what each
+// frame costs and how many frames it gets for a smooth stream instead of
+// stutter, and probe back up once the link clears.
+//
+// Each period it looks at the link's ENOMEM returns, frames superseded,
+// mean queue depth (writes in flight), render-to-send latency and frames the
+// poi reported arriving too late to play, then moves one step along a ladder
+// of levels:
+//   poi taking POI_FRAME_KEY_PACKED4:  full, 4-bit, 4-bit 1/2 frames, 1/3 frames, 1/4 frames
+//   others:                            full, 1/2 frames, 1/3 frames, 1/4 frames
+// At 4 bits per channel a keyframe costs half a raw one, and deltas shrink too.
+// A congested period steps down at once, then the next POI_RATE_CTL_HOLD_PERIODS
+// are ignored while the backlog queued before it drains; stepping up needs recover_after clear
+// periods, doubled each time the level above congests again within
+// POI_RATE_CTL_PROBE_PERIODS.
+
+#define POI_RATE_CTL_PERIOD_US     250000
+#define POI_RATE_CTL_RECOVER_MIN   4   // Clear periods before the first step up (1 s)
+#define POI_RATE_CTL_RECOVER_MAX   32  // Back-off ceiling after failed probes (8 s)
+#define POI_RATE_CTL_PROBE_PERIODS 2   // Congestion this soon after a step up counts against it
+#define POI_RATE_CTL_HOLD_PERIODS  1   // Periods ignored after a step down while the backlog drains
+
+typedef struct {
+    uint8_t  level;           // 0 = full quality
+    uint8_t  max_level;
+    bool     packed4;         // Which ladder
+    bool     reduced_depth;   // Frames go out through poi_codec_reduce_depth()
+    uint8_t  frame_div;       // Send every frame_div-th rendered frame
+    uint32_t latency_target_us;
+
+    uint8_t  clear_periods;   // Consecutive uncongested periods
+    uint8_t  recover_after;
+    uint8_t  since_step_up;   // Periods since the last step up, saturates
+    uint8_t  hold_periods;    // Left to ignore after a step down
+
+    int64_t  period_start_us;
+    uint32_t busy_at_period;  // tx counters when the period started
+    uint32_t superseded_at_period;
+    uint32_t depth_sum;       // Queue depth samples this period
+    uint16_t depth_samples;
+    uint32_t latency_max_us;  // Worst render-to-send latency this period
+    uint16_t late_frames;     // Reported late by the poi this period
+
+    // Statistics (monotonic)
+    uint32_t steps_down;
+    uint32_t steps_up;
+    uint32_t thinned;         // Rendered frames skipped by frame_div
+} poi_rate_ctl_t;
+
+// Reset for a link starting to stream, counting from tx's current counters;
+// latency_target_us is the render-to-send delay that counts as congestion
+void poi_rate_ctl_init(poi_rate_ctl_t *c, const poi_tx_sched_t *tx, bool packed4, uint32_t latency_target_us, int64_t now_us);
+
+// Writes in flight on the link, sampled every time the stream loop looks at it
+static inline void poi_rate_ctl_sample_depth(poi_rate_ctl_t *c, uint8_t in_flight) {
+    c->depth_sum += in_flight;
+    c->depth_samples++;
+}
+
+// A write left with frames rendered latency_us ago
+static inline void poi_rate_ctl_sample_latency(poi_rate_ctl_t *c, uint32_t latency_us) {
+    if (latency_us > c->latency_max_us) c->latency_max_us = latency_us;
+}
+
+// The poi dropped n frames that arrived after their presentation time
+static inline void poi_rate_ctl_sample_late(poi_rate_ctl_t *c, uint16_t n) {
+    c->late_frames += n;
+}
+
+// Close the period if it's over and step the level; true if the level changed
+bool poi_rate_ctl_update(poi_rate_ctl_t *c, const poi_tx_sched_t *tx, int64_t now_us);
+
+// Whether rendered frame seq is sent at the current level
+static inline bool poi_rate_ctl_wants(const poi_rate_ctl_t *c, uint32_t seq) {
+    return c->frame_div <= 1 || seq % c->frame_div == 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_RATE_CTL_H
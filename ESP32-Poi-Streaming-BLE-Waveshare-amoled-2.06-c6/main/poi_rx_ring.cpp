@@ -0,0 +1,31 @@
+#include "poi_rx_ring.h"
+#include <string.h>
+
+bool poi_rx_ring_push(poi_rx_ring_t *r, uint16_t conn_handle, const uint8_t *data, uint16_t len, int64_t now_us) {
+    uint32_t head = r->head;
+    uint32_t waiting = head - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+    if (waiting >= POI_RX_RING_SIZE) {
+        r->dropped++;
+        return false;
+    }
+    poi_rx_entry_t *e = &r->e[head % POI_RX_RING_SIZE];
+    bool keep = len <= POI_RX_RING_DATA;
+    if (!keep) r->oversize++;
+    e->t_us = now_us;
+    e->conn_handle = conn_handle;
+    e->len = keep ? (uint8_t)len : 0;
+    memcpy(e->data, data, e->len);
+    if (waiting + 1 > r->high_water) r->high_water = waiting + 1;
+    __atomic_store_n(&r->head, head + 1, __ATOMIC_RELEASE); // Publishes the entry
+    return keep;
+}
+
+const poi_rx_entry_t *poi_rx_ring_peek(const poi_rx_ring_t *r) {
+    uint32_t tail = r->tail;
+    if (__atomic_load_n(&r->head, __ATOMIC_ACQUIRE) == tail) return NULL;
+    return &r->e[tail % POI_RX_RING_SIZE];
+}
+
+void poi_rx_ring_pop(poi_rx_ring_t *r) {
+    __atomic_store_n(&r->tail, r->tail + 1, __ATOMIC_RELEASE); // The producer may reuse the entry now
+}
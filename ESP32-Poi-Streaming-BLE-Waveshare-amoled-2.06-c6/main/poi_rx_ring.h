@@ -0,0 +1,51 @@
+#ifndef POI_RX_RING_H
+#define POI_RX_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Notifications from the poi, handed from the NimBLE host task (the only
+// producer) to stream_task (the only consumer) without locks. The host task
+// just copies bytes in; reassembly and everything the replies drive run on
+// the consumer side, so a slow reply never holds up the host and the
+// per-device state has a single writer. When the ring is full the newest
+// notification is dropped and counted. A notification longer than
+// POI_RX_RING_DATA is dropped whole, never cut short, and leaves an empty
+// entry (len 0) in its place so the consumer restarts that link's reassembly
+// instead of completing a reply with the next notification's bytes.
+
+#define POI_RX_RING_SIZE 16 // Entries (power of 2)
+#define POI_RX_RING_DATA 64 // Bytes kept per notification; replies are short
+
+typedef struct {
+    int64_t  t_us;        // Arrival, for replies whose timing matters (clock sync)
+    uint16_t conn_handle; // Entries of a link that dropped meanwhile are discarded by the consumer
+    uint8_t  len;
+    uint8_t  data[POI_RX_RING_DATA];
+} poi_rx_entry_t;
+
+typedef struct {
+    poi_rx_entry_t e[POI_RX_RING_SIZE];
+    uint32_t head;       // Next to write, producer only
+    uint32_t tail;       // Next to read, consumer only
+    uint32_t dropped;    // Notifications lost to a full ring
+    uint32_t oversize;   // Notifications longer than POI_RX_RING_DATA, dropped
+    uint32_t high_water; // Most entries ever waiting
+} poi_rx_ring_t;
+
+// Producer: copy a notification in; false if the ring is full or it was too long to keep
+bool poi_rx_ring_push(poi_rx_ring_t *r, uint16_t conn_handle, const uint8_t *data, uint16_t len, int64_t now_us);
+
+// Consumer: oldest waiting entry or NULL; release it with poi_rx_ring_pop() once handled
+const poi_rx_entry_t *poi_rx_ring_peek(const poi_rx_ring_t *r);
+void poi_rx_ring_pop(poi_rx_ring_t *r);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_RX_RING_H
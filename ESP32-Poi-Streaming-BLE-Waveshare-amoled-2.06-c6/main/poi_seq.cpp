@@ -0,0 +1,188 @@
+#include "poi_seq.h"
+#include <string.h>
+
+// Bitwise CRC-32 (IEEE, reflected); sequences are checked once per upload, a table isn't worth the RAM
+uint32_t poi_crc32(uint32_t crc, const uint8_t *data, size_t len) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+// --- Building ---
+
+void poi_seq_builder_init(poi_seq_builder_t *b, uint8_t *buf, uint32_t cap) {
+    memset(b, 0, sizeof(*b));
+    b->buf = buf;
+    b->cap = cap;
+}
+
+bool poi_seq_builder_add(poi_seq_builder_t *b, const uint8_t *rgb, size_t len) {
+    if (b->len + POI_SEQ_REC_HDR_LEN >= b->cap || b->frames == UINT16_MAX) return false;
+    uint8_t *rec = &b->buf[b->len];
+    size_t n = poi_codec_encode(&b->codec, rgb, len, &rec[POI_SEQ_REC_HDR_LEN], b->cap - b->len - POI_SEQ_REC_HDR_LEN);
+    if (n == 0) return false;
+    poi_proto::put_u16(rec, (uint16_t)n);
+    poi_codec_commit(&b->codec, rgb, len, rec[POI_SEQ_REC_HDR_LEN], n);
+    b->len += POI_SEQ_REC_HDR_LEN + n;
+    b->frames++;
+    return true;
+}
+
+bool poi_seq_next_frame(const uint8_t *seq, uint32_t len, uint32_t *off, const uint8_t **frame, uint16_t *frame_len) {
+    if (*off + POI_SEQ_REC_HDR_LEN > len) return false;
+    uint16_t n = poi_proto::get_u16(&seq[*off]);
+    if (n == 0 || *off + POI_SEQ_REC_HDR_LEN + n > len) return false;
+    *frame = &seq[*off + POI_SEQ_REC_HDR_LEN];
+    *frame_len = n;
+    *off += POI_SEQ_REC_HDR_LEN + n;
+    return true;
+}
+
+// --- Uploading ---
+
+void poi_seq_upload_init(poi_seq_upload_t *u, uint8_t id, const uint8_t *data, uint32_t len,
+                         uint16_t frames, uint8_t fps, uint8_t num_leds) {
+    memset(u, 0, sizeof(*u));
+    u->id = id;
+    u->data = data;
+    u->len = len;
+    u->crc = poi_crc32(0, data, len);
+    u->frames = frames;
+    u->fps = fps;
+    u->num_leds = num_leds;
+    u->state = POI_SEQ_UP_BEGIN;
+}
+
+void poi_seq_upload_restart(poi_seq_upload_t *u) {
+    if (u->state != POI_SEQ_UP_DONE && u->state != POI_SEQ_UP_FAILED) u->state = POI_SEQ_UP_BEGIN;
+}
+
+size_t poi_seq_upload_next(poi_seq_upload_t *u, uint8_t *out, size_t cap) {
+    u->pending_len = 0;
+    if (u->state == POI_SEQ_UP_BEGIN) {
+        poi_proto::seq_begin_req req = {u->id, u->len, u->crc, u->frames, u->fps, u->num_leds};
+        return poi_proto::encode(req, {out, cap});
+    }
+    if (u->state != POI_SEQ_UP_SENDING) return 0;
+    if (u->next >= u->len) return poi_proto::encode(poi_proto::seq_end_req{u->id}, {out, cap});
+    if (cap <= POI_SEQ_CHUNK_HDR_LEN) return 0;
+    uint32_t n = u->len - u->next;
+    if (n > cap - POI_SEQ_CHUNK_HDR_LEN) n = cap - POI_SEQ_CHUNK_HDR_LEN;
+    poi_proto::encode(poi_proto::seq_chunk_hdr{u->id, u->next}, {out, cap});
+    memcpy(&out[POI_SEQ_CHUNK_HDR_LEN], &u->data[u->next], n);
+    u->pending_len = (uint16_t)n;
+    return POI_SEQ_CHUNK_HDR_LEN + n;
+}
+
+void poi_seq_upload_sent(poi_seq_upload_t *u, int64_t now_us) {
+    if (u->state == POI_SEQ_UP_BEGIN) {
+        u->state = POI_SEQ_UP_WAIT_BEGIN;
+        u->deadline_us = now_us + POI_SEQ_REPLY_TIMEOUT_US;
+    } else if (u->state == POI_SEQ_UP_SENDING) {
+        if (u->pending_len > 0) {
+            u->next += u->pending_len;
+        } else {
+            u->state = POI_SEQ_UP_WAIT_END;
+            u->deadline_us = now_us + POI_SEQ_REPLY_TIMEOUT_US;
+        }
+    }
+    u->pending_len = 0;
+}
+
+// Something went wrong; try again from BEGIN unless that already happened too often
+static void retry(poi_seq_upload_t *u) {
+    u->state = ++u->retries > POI_SEQ_MAX_RETRIES ? POI_SEQ_UP_FAILED : POI_SEQ_UP_BEGIN;
+}
+
+void poi_seq_upload_reply(poi_seq_upload_t *u, const uint8_t *reply, size_t len) {
+    poi_proto::seq_begin_reply begin;
+    poi_proto::seq_end_reply r;
+    bool is_begin = poi_proto::decode({reply, len}, begin);
+    if (is_begin) {
+        r = {begin.id, begin.status, begin.have}; // Same fields, only the cmd differs
+    } else if (!poi_proto::decode({reply, len}, r)) {
+        return;
+    }
+    if (r.id != u->id) return;
+    uint8_t status = r.status;
+    uint32_t have = r.have;
+    if (have > u->len) have = u->len;
+
+    if (is_begin && u->state == POI_SEQ_UP_WAIT_BEGIN) {
+        if (status != POI_SEQ_STATUS_OK) {
+            u->state = POI_SEQ_UP_FAILED;
+            return;
+        }
+        u->next = have; // Resume where a previous attempt left off
+        u->resumed_at = have;
+        u->state = POI_SEQ_UP_SENDING;
+    } else if (!is_begin && u->state == POI_SEQ_UP_WAIT_END) {
+        if (status == POI_SEQ_STATUS_OK) {
+            u->state = POI_SEQ_UP_DONE;
+        } else if (status == POI_SEQ_STATUS_INCOMPLETE && have < u->len) {
+            u->next = have; // Chunks were dropped along the way: fill the gap
+            u->state = POI_SEQ_UP_SENDING;
+        } else {
+            retry(u);
+        }
+    }
+}
+
+void poi_seq_upload_poll(poi_seq_upload_t *u, int64_t now_us) {
+    if ((u->state == POI_SEQ_UP_WAIT_BEGIN || u->state == POI_SEQ_UP_WAIT_END) && now_us >= u->deadline_us) retry(u);
+}
+
+void poi_seq_play(const poi_seq_upload_t *u, uint16_t frame, uint32_t pts_us, uint8_t *out) {
+    poi_proto::encode(poi_proto::seq_play_req{u->id, frame, pts_us}, {out, POI_SEQ_PLAY_LEN});
+}
+
+// --- Receiving ---
+
+void poi_seq_rx_init(poi_seq_rx_t *r, uint8_t *store, uint32_t cap) {
+    memset(r, 0, sizeof(*r));
+    r->store = store;
+    r->cap = cap;
+}
+
+template <typename Reply>
+static size_t rx_reply(const poi_seq_rx_t *r, uint8_t status, uint8_t *reply) {
+    return poi_proto::encode(Reply{r->id, status, r->have}, {reply, POI_SEQ_REPLY_LEN});
+}
+
+size_t poi_seq_rx_write(poi_seq_rx_t *r, const uint8_t *in, size_t len, uint8_t *reply) {
+    poi_proto::seq_begin_req begin;
+    poi_proto::seq_chunk_hdr chunk;
+    poi_proto::seq_end_req end;
+    if (poi_proto::decode({in, len}, begin)) {
+        if (begin.id != r->id || begin.len != r->len || begin.crc != r->crc) { // Another sequence: start over
+            r->id = begin.id;
+            r->len = begin.len;
+            r->crc = begin.crc;
+            r->have = 0;
+            r->complete = false;
+        }
+        return rx_reply<poi_proto::seq_begin_reply>(r, begin.len > r->cap ? POI_SEQ_STATUS_NO_SPACE : POI_SEQ_STATUS_OK, reply);
+    }
+    if (len > POI_SEQ_CHUNK_HDR_LEN && poi_proto::decode({in, len}, chunk) && chunk.id == r->id) {
+        uint32_t off = chunk.offset;
+        uint32_t n = len - POI_SEQ_CHUNK_HDR_LEN;
+        if (off == r->have && off + n <= r->len && off + n <= r->cap) {
+            memcpy(&r->store[off], &in[POI_SEQ_CHUNK_HDR_LEN], n);
+            r->have += n;
+        }
+        return 0;
+    }
+    if (poi_proto::decode({in, len}, end) && end.id == r->id) {
+        if (r->have < r->len) return rx_reply<poi_proto::seq_end_reply>(r, POI_SEQ_STATUS_INCOMPLETE, reply);
+        if (poi_crc32(0, r->store, r->len) != r->crc) {
+            r->have = 0;
+            return rx_reply<poi_proto::seq_end_reply>(r, POI_SEQ_STATUS_BAD_CRC, reply);
+        }
+        r->complete = true;
+        return rx_reply<poi_proto::seq_end_reply>(r, POI_SEQ_STATUS_OK, reply);
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+#ifndef POI_SEQ_H
+#define POI_SEQ_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "poi_frame_codec.h"
+#include "poi_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Pre-rendered sequences: a mode is rendered offline into a compact frame
+// sequence, uploaded to the poi's flash in chunks, then played on every poi
+// from small "play sequence X at frame Y" ticks instead of live frames.
+//
+// Sequence blob, one record per frame:
+//   [len u16][type][body]   ([type][body] as produced by poi_frame_codec, len counts both)
+// Frame 0 is a keyframe, so is every POI_CODEC_KEY_EVERY-th frame at most.
+//
+// Upload (all little endian, replies are TX notifications):
+//   BEGIN [S][begin][id][len u32][crc u32][frames u16][fps][num_leds]
+//         -> [S][begin][id][status][have u32]  have = bytes the poi already holds of this id+crc
+//   CHUNK [S][chunk][id][offset u32][data]     a chunk not at the poi's `have` offset is dropped
+//   END   [S][end][id]
+//         -> [S][end][id][status][have u32]    CRC checked over the whole blob
+// Playback:
+//   PLAY  [S][play][id][frame u16][pts u32]    show frame at pts (poi clock, 0 = on arrival), looping
+
+#define POI_SEQ_BEGIN_LEN     poi_proto::seq_begin_req::wire_size
+#define POI_SEQ_CHUNK_HDR_LEN poi_proto::seq_chunk_hdr::wire_size
+#define POI_SEQ_END_LEN       poi_proto::seq_end_req::wire_size
+#define POI_SEQ_PLAY_LEN      poi_proto::seq_play_req::wire_size
+#define POI_SEQ_REPLY_LEN     poi_proto::seq_begin_reply::wire_size
+#define POI_SEQ_REC_HDR_LEN   2
+#define POI_SEQ_REPLY_TIMEOUT_US 1000000
+#define POI_SEQ_MAX_RETRIES   3
+
+typedef enum {
+    POI_SEQ_STATUS_OK         = 0,
+    POI_SEQ_STATUS_NO_SPACE   = 1, // BEGIN: the blob doesn't fit the poi's flash
+    POI_SEQ_STATUS_BAD_CRC    = 2, // END: blob complete but corrupt, the poi discarded it
+    POI_SEQ_STATUS_INCOMPLETE = 3, // END: bytes missing from `have` on
+} poi_seq_status_t;
+
+uint32_t poi_crc32(uint32_t crc, const uint8_t *data, size_t len);
+
+// --- Building a sequence ---
+
+typedef struct {
+    uint8_t *buf;
+    uint32_t cap;
+    uint32_t len;
+    uint16_t frames;
+    poi_frame_codec_t codec;
+} poi_seq_builder_t;
+
+void poi_seq_builder_init(poi_seq_builder_t *b, uint8_t *buf, uint32_t cap);
+
+// Append one frame of len RGB bytes; false (builder unchanged) once buf is full
+bool poi_seq_builder_add(poi_seq_builder_t *b, const uint8_t *rgb, size_t len);
+
+// Poi-side reference iterator: record at *off as [type][body]; advances *off. False at the end or on a bad record.
+bool poi_seq_next_frame(const uint8_t *seq, uint32_t len, uint32_t *off, const uint8_t **frame, uint16_t *frame_len);
+
+// --- Uploading it (watch side) ---
+
+typedef enum {
+    POI_SEQ_UP_BEGIN,      // BEGIN due
+    POI_SEQ_UP_WAIT_BEGIN, // Waiting for the BEGIN reply
+    POI_SEQ_UP_SENDING,    // Chunks due, END once all are out
+    POI_SEQ_UP_WAIT_END,   // Waiting for the END reply
+    POI_SEQ_UP_DONE,       // The poi holds the sequence
+    POI_SEQ_UP_FAILED,     // Rejected or out of retries
+} poi_seq_up_state_t;
+
+typedef struct {
+    const uint8_t *data; // Blob, owned by the caller until DONE or FAILED
+    uint32_t len;
+    uint32_t crc;
+    uint16_t frames;
+    uint8_t  id;
+    uint8_t  fps;
+    uint8_t  num_leds;
+
+    uint8_t  state;       // poi_seq_up_state_t
+    uint32_t next;        // Next blob offset to send
+    uint16_t pending_len; // Blob bytes in the write last built by poi_seq_upload_next()
+    int64_t  deadline_us; // Give up waiting for a reply after this
+    uint8_t  retries;
+    uint32_t resumed_at;  // Offset the last BEGIN reply resumed from (statistics)
+} poi_seq_upload_t;
+
+void poi_seq_upload_init(poi_seq_upload_t *u, uint8_t id, const uint8_t *data, uint32_t len,
+                         uint16_t frames, uint8_t fps, uint8_t num_leds);
+
+// The link dropped: start over with BEGIN, the poi tells how much it kept
+void poi_seq_upload_restart(poi_seq_upload_t *u);
+
+// Build the next write into out (cap = largest write); 0 if nothing is due.
+// Call poi_seq_upload_sent() once the stack took it, or nothing to have it rebuilt.
+size_t poi_seq_upload_next(poi_seq_upload_t *u, uint8_t *out, size_t cap);
+void poi_seq_upload_sent(poi_seq_upload_t *u, int64_t now_us);
+
+// A BEGIN or END reply from the poi
+void poi_seq_upload_reply(poi_seq_upload_t *u, const uint8_t *reply, size_t len);
+
+// Retry a request whose reply never came; call regularly
+void poi_seq_upload_poll(poi_seq_upload_t *u, int64_t now_us);
+
+// PLAY tick for this sequence
+void poi_seq_play(const poi_seq_upload_t *u, uint16_t frame, uint32_t pts_us, uint8_t *out);
+
+// --- Receiving it (poi-side reference) ---
+
+typedef struct {
+    uint8_t *store;       // Stands in for the poi's flash
+    uint32_t cap;
+    uint8_t  id;
+    uint32_t len;
+    uint32_t crc;
+    uint32_t have;        // Contiguous bytes received
+    bool     complete;    // CRC verified
+} poi_seq_rx_t;
+
+void poi_seq_rx_init(poi_seq_rx_t *r, uint8_t *store, uint32_t cap);
+
+// Handle one write; returns the length of the notification to send back in reply (0 = none)
+size_t poi_seq_rx_write(poi_seq_rx_t *r, const uint8_t *in, size_t len, uint8_t *reply);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_SEQ_H
@@ -0,0 +1,62 @@
+#include "poi_sync.h"
+#include <string.h>
+
+void poi_clock_sync_reset(poi_clock_sync_t *c, int64_t now_us) {
+    memset(c, 0, sizeof(*c));
+    c->next_req_us = now_us;
+}
+
+bool poi_clock_sync_request(poi_clock_sync_t *c, int64_t now_us, uint8_t *req) {
+    if (now_us < c->next_req_us) return false;
+    // Sync quickly until the window has a few samples, then settle to the normal rate
+    c->next_req_us = now_us + (c->count < POI_SYNC_SAMPLES / 2 ? POI_SYNC_INTERVAL_US / 8 : POI_SYNC_INTERVAL_US);
+    poi_proto::encode(poi_proto::time_sync_req{(uint32_t)now_us}, {req, POI_TIME_SYNC_LEN});
+    return true;
+}
+
+bool poi_clock_sync_reply(poi_clock_sync_t *c, const uint8_t *reply, uint16_t len, int64_t now_us) {
+    poi_proto::time_sync_reply r;
+    if (!poi_proto::decode({reply, len}, r)) return false;
+    uint32_t t0 = r.t0_us;
+    uint32_t t1 = r.t1_us;
+    uint32_t rtt = (uint32_t)now_us - t0;
+    if (rtt > POI_SYNC_MAX_RTT_US) return false;
+
+    // Assume the request and the reply took equally long
+    c->rtt_us[c->next] = rtt;
+    c->offset_us[c->next] = (int32_t)(t1 - t0) - (int32_t)(rtt / 2);
+    c->next = (c->next + 1) % POI_SYNC_SAMPLES;
+    if (c->count < POI_SYNC_SAMPLES) c->count++;
+
+    // The fastest round trip had the least queueing, so its midpoint is the most trustworthy
+    uint8_t best = 0;
+    for (uint8_t i = 1; i < c->count; i++) {
+        if (c->rtt_us[i] < c->rtt_us[best]) best = i;
+    }
+    c->offset = c->offset_us[best];
+    c->rtt = c->rtt_us[best];
+    c->valid = true;
+    return true;
+}
+
+void poi_timed_hdr(uint8_t *hdr, uint16_t seq, uint32_t pts_us) {
+    poi_proto::encode(poi_proto::timed_hdr{seq, pts_us}, {hdr, POI_TIMED_HDR_LEN});
+}
+
+poi_play_action_t poi_playout_check(poi_playout_t *p, uint16_t seq, uint32_t pts_us, uint32_t now_us) {
+    if (p->have_seq && (int16_t)(seq - p->last_seq) <= 0) {
+        p->stale++;
+        return POI_PLAY_STALE;
+    }
+    int32_t lateness = (int32_t)(now_us - pts_us);
+    if (lateness < 0) return POI_PLAY_WAIT;
+
+    p->last_seq = seq;
+    p->have_seq = true;
+    if (lateness > POI_PLAYOUT_LATE_US) {
+        p->late++;
+        return POI_PLAY_LATE;
+    }
+    p->shown++;
+    return POI_PLAY_SHOW;
+}
@@ -0,0 +1,84 @@
+#ifndef POI_SYNC_H
+#define POI_SYNC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "poi_protocol.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Lockstep playback across poi.
+//
+// Clock sync (CC_TIME_SYNC), all times 32-bit microseconds, little endian:
+//   watch -> poi (write):  [START_BYTE][CC_TIME_SYNC][t0]        t0 = watch clock at send
+//   poi -> watch (notify): [START_BYTE][CC_TIME_SYNC][t0][t1]    t1 = poi clock on receipt
+// The watch receives the reply at t2 and estimates poi = watch + offset from
+// the lowest-RTT sample of the last POI_SYNC_SAMPLES.
+//
+// Timed stream write (CC_STREAM_TIMED), wraps any stream write unchanged:
+//   [START_BYTE][CC_STREAM_TIMED][seq u16][pts u32][START_BYTE][cmd][...]
+// seq is the watch's frame number (the same frame has the same seq on every poi),
+// pts the poi clock time at which to show it. Frames of a CC_STREAM_BATCH inside
+// carry seq + k and pts plus the accumulated dt_ms.
+
+#define POI_TIMED_HDR_LEN      poi_proto::timed_hdr::wire_size // Bytes in front of the wrapped write
+#define POI_TIME_SYNC_LEN      poi_proto::time_sync_req::wire_size
+#define POI_TIME_SYNC_REPLY_LEN poi_proto::time_sync_reply::wire_size
+#define POI_SYNC_SAMPLES       8
+#define POI_SYNC_INTERVAL_US   1000000 // Re-sync each link this often
+#define POI_SYNC_MAX_RTT_US    200000  // Replies slower than this are not worth using
+#define POI_PLAYOUT_LATE_US    20000   // Frames later than this are decoded but not shown
+
+// Watch-side clock estimate for one link
+typedef struct {
+    uint32_t rtt_us[POI_SYNC_SAMPLES];
+    int32_t  offset_us[POI_SYNC_SAMPLES];
+    uint8_t  count;
+    uint8_t  next;
+    bool     valid;      // At least one sample accepted
+    int32_t  offset;     // poi clock - watch clock, from the best sample
+    uint32_t rtt;        // RTT of that sample
+    int64_t  next_req_us;
+} poi_clock_sync_t;
+
+void poi_clock_sync_reset(poi_clock_sync_t *c, int64_t now_us);
+
+// True once per POI_SYNC_INTERVAL_US; fills req with a POI_TIME_SYNC_LEN request
+bool poi_clock_sync_request(poi_clock_sync_t *c, int64_t now_us, uint8_t *req);
+
+// Feed a reply (starting at its START_BYTE) received at watch time now_us; false if malformed or discarded
+bool poi_clock_sync_reply(poi_clock_sync_t *c, const uint8_t *reply, uint16_t len, int64_t now_us);
+
+// Watch time converted to the poi's clock
+static inline uint32_t poi_clock_sync_to_peer(const poi_clock_sync_t *c, int64_t watch_us) {
+    return (uint32_t)watch_us + (uint32_t)c->offset;
+}
+
+// Write the POI_TIMED_HDR_LEN byte CC_STREAM_TIMED header; the wrapped write follows it
+void poi_timed_hdr(uint8_t *hdr, uint16_t seq, uint32_t pts_us);
+
+// Poi-side reference playout: what to do with frame seq due at pts_us (poi clock)
+typedef enum {
+    POI_PLAY_WAIT,  // Early: hold it until pts_us
+    POI_PLAY_SHOW,  // Show it now
+    POI_PLAY_LATE,  // Decode (delta reference) but don't show
+    POI_PLAY_STALE, // Already past this seq: ignore
+} poi_play_action_t;
+
+typedef struct {
+    uint16_t last_seq;
+    bool     have_seq;
+    uint32_t shown;
+    uint32_t late;
+    uint32_t stale;
+} poi_playout_t;
+
+poi_play_action_t poi_playout_check(poi_playout_t *p, uint16_t seq, uint32_t pts_us, uint32_t now_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_SYNC_H
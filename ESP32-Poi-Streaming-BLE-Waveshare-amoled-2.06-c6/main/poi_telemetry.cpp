@@ -0,0 +1,84 @@
+#include "poi_telemetry.h"
+#include <string.h>
+
+#define READ_TRIES 8
+
+const uint16_t poi_telem_hist_edges_ms[POI_TELEM_HIST_BUCKETS - 1] = {5, 10, 15, 20, 30, 40, 60, 80, 120, 160, 250};
+
+void poi_telem_reset(poi_telem_t *t, int64_t now_us) {
+    // The snapshot stays readable; it is replaced by the next publish
+    t->last_send_us = 0;
+    t->next_publish_us = now_us + POI_TELEM_PUBLISH_US;
+    memset(t->hist, 0, sizeof(t->hist));
+}
+
+bool poi_telem_publish_due(poi_telem_t *t, int64_t now_us) {
+    if (now_us < t->next_publish_us) return false;
+    t->next_publish_us = now_us + POI_TELEM_PUBLISH_US;
+    return true;
+}
+
+void poi_telem_publish(poi_telem_t *t, const poi_telem_stats_t *s) {
+    uint32_t seq = t->seq;
+    __atomic_store_n(&t->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    t->pub = *s;
+    memcpy(t->pub.send_hist, t->hist, sizeof(t->hist));
+    __atomic_store_n(&t->seq, seq + 2, __ATOMIC_RELEASE);
+}
+
+bool poi_telem_read(const poi_telem_t *t, poi_telem_stats_t *out) {
+    for (int i = 0; i < READ_TRIES; i++) {
+        uint32_t before = __atomic_load_n(&t->seq, __ATOMIC_ACQUIRE);
+        if (before == 0) return false;
+        if (before & 1) continue; // Publish in progress
+        *out = t->pub;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&t->seq, __ATOMIC_RELAXED) == before) return true;
+    }
+    return false;
+}
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+    p[0] = v; p[1] = v >> 8;
+    return p + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p, uint32_t v) {
+    p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+    return p + 4;
+}
+
+size_t poi_telem_encode(const poi_telem_stats_t *s, uint8_t slot, uint8_t *out, size_t cap) {
+    if (cap < POI_TELEM_RECORD_LEN) return 0;
+    out[0] = 0xA5;
+    out[1] = 0x7E;
+    out[2] = POI_TELEM_VERSION;
+    out[3] = slot;
+    out[4] = POI_TELEM_PAYLOAD_LEN;
+    uint8_t *p = &out[5];
+    p = put_u32(p, s->uptime_ms);
+    p = put_u32(p, s->frames_sent);
+    p = put_u32(p, s->writes_sent);
+    p = put_u32(p, s->bytes_sent);
+    p = put_u32(p, s->enomem);
+    p = put_u32(p, s->write_errors);
+    p = put_u32(p, s->superseded);
+    p = put_u16(p, s->conn_itvl);
+    p = put_u16(p, s->mtu);
+    *p++ = s->tx_phy;
+    *p++ = (uint8_t)s->rssi;
+    *p++ = s->level;
+    p = put_u16(p, s->fps_x10);
+    *p++ = s->sequence;
+    for (int b = 0; b < POI_TELEM_HIST_BUCKETS; b++) p = put_u32(p, s->send_hist[b]);
+
+    // Fletcher-16 over slot..payload
+    uint16_t a = 0, c = 0;
+    for (uint8_t *q = &out[3]; q < p; q++) {
+        a = (a + *q) % 255;
+        c = (c + a) % 255;
+    }
+    put_u16(p, (uint16_t)(c << 8 | a));
+    return POI_TELEM_RECORD_LEN;
+}
@@ -0,0 +1,92 @@
+#ifndef POI_TELEMETRY_H
+#define POI_TELEMETRY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Per-link stats block. stream_task is the only writer: it bins the time
+// between stream writes on every send and publishes a snapshot of the link's
+// counters once per POI_TELEM_PUBLISH_US. Other tasks read the snapshot
+// without locks (sequence counter, retried while a publish is in progress).
+//
+// Binary record, little endian, for host-side tooling:
+//   [0xA5][0x7E][version][slot][payload len][payload][fletcher16 u16 over slot..payload]
+// payload = poi_telem_stats_t fields in declaration order, packed.
+
+#define POI_TELEM_HIST_BUCKETS 12
+#define POI_TELEM_PUBLISH_US   1000000
+#define POI_TELEM_RSSI_UNKNOWN 127
+#define POI_TELEM_SEQ_NONE     0xFF // sequence: no upload, streaming live
+#define POI_TELEM_SEQ_PLAYING  0xFE // sequence: uploaded, the poi play it from flash
+#define POI_TELEM_VERSION      2
+#define POI_TELEM_PAYLOAD_LEN  (7 * 4 + 2 + 2 + 1 + 1 + 1 + 2 + 1 + POI_TELEM_HIST_BUCKETS * 4)
+#define POI_TELEM_RECORD_LEN   (5 + POI_TELEM_PAYLOAD_LEN + 2)
+
+// Upper edges (ms) of the write interval buckets; the last bucket takes the rest
+extern const uint16_t poi_telem_hist_edges_ms[POI_TELEM_HIST_BUCKETS - 1];
+
+typedef struct {
+    uint32_t uptime_ms;      // When published
+    uint32_t frames_sent;    // Counters since the link started streaming
+    uint32_t writes_sent;
+    uint32_t bytes_sent;
+    uint32_t enomem;         // Writes the stack refused for lack of buffers
+    uint32_t write_errors;
+    uint32_t superseded;
+    uint16_t conn_itvl;      // 1.25 ms units
+    uint16_t mtu;
+    uint8_t  tx_phy;         // 1 = 1M, 2 = 2M
+    int8_t   rssi;           // dBm, POI_TELEM_RSSI_UNKNOWN if the read failed
+    uint8_t  level;          // poi_rate_ctl quality level
+    uint16_t fps_x10;        // Frames delivered to the stack, last tx report window
+    uint8_t  sequence;       // Upload percent 0..100, or POI_TELEM_SEQ_*
+    uint32_t send_hist[POI_TELEM_HIST_BUCKETS]; // Writes by time since the previous one
+} poi_telem_stats_t;
+
+typedef struct {
+    // stream_task side
+    int64_t  last_send_us;
+    int64_t  next_publish_us;
+    uint32_t hist[POI_TELEM_HIST_BUCKETS];
+
+    // Published snapshot; seq is odd while it is being rewritten
+    uint32_t seq;
+    poi_telem_stats_t pub;
+} poi_telem_t;
+
+void poi_telem_reset(poi_telem_t *t, int64_t now_us);
+
+// A stream write was handed to the stack (hot path)
+static inline void poi_telem_on_send(poi_telem_t *t, int64_t now_us) {
+    if (t->last_send_us != 0) {
+        int64_t dt = now_us - t->last_send_us;
+        uint32_t ms = dt < (int64_t)UINT32_MAX ? (uint32_t)dt / 1000 : UINT32_MAX; // 32-bit divide, no libcall
+        int b = 0;
+        while (b < POI_TELEM_HIST_BUCKETS - 1 && ms >= poi_telem_hist_edges_ms[b]) b++;
+        t->hist[b]++;
+    }
+    t->last_send_us = now_us;
+}
+
+// True once per POI_TELEM_PUBLISH_US
+bool poi_telem_publish_due(poi_telem_t *t, int64_t now_us);
+
+// Publish s (send_hist is filled in from the writer's bins)
+void poi_telem_publish(poi_telem_t *t, const poi_telem_stats_t *s);
+
+// Consistent copy of the last snapshot from any task; false if none was published yet
+bool poi_telem_read(const poi_telem_t *t, poi_telem_stats_t *out);
+
+// Binary record for slot into out; returns POI_TELEM_RECORD_LEN, 0 if cap is too small
+size_t poi_telem_encode(const poi_telem_stats_t *s, uint8_t slot, uint8_t *out, size_t cap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_TELEMETRY_H
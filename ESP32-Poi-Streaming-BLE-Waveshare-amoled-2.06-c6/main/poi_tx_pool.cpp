@@ -0,0 +1,20 @@
+#include "poi_tx_pool.h"
+#include <string.h>
+
+int poi_tx_pool_init(poi_tx_pool_t *p, const char *name) {
+    memset(p, 0, sizeof(*p));
+    int rc = os_mempool_init(&p->mempool, POI_TX_POOL_BLOCKS, POI_TX_POOL_BLOCK_SIZE, p->mem, name);
+    if (rc != 0) return rc;
+    return os_mbuf_pool_init(&p->mbuf_pool, &p->mempool, POI_TX_POOL_BLOCK_SIZE, POI_TX_POOL_BLOCKS);
+}
+
+struct os_mbuf *poi_tx_pool_get(poi_tx_pool_t *p) {
+    struct os_mbuf *om = os_mbuf_get_pkthdr(&p->mbuf_pool, 0);
+    if (om == NULL) {
+        p->alloc_fails++;
+        return NULL;
+    }
+    om->om_data += POI_TX_POOL_LEADING;
+    p->allocs++;
+    return om;
+}
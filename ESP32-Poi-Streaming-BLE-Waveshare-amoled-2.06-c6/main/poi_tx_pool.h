@@ -0,0 +1,52 @@
+#ifndef POI_TX_POOL_H
+#define POI_TX_POOL_H
+
+#include <stdint.h>
+#include "os/os_mbuf.h"
+#include "os/os_mempool.h"
+#include "poi_tx_sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Per-link mbufs that stream writes are built in directly and handed to
+// ble_gattc_write_no_rsp(), which consumes them. A block returns to its pool
+// once the stack is done with it, so blocks in use are writes still queued.
+//
+// What this saves is the msys allocation and the payload copy that
+// ble_gattc_write_no_rsp_flat() makes; it is not zero copy end to end. The
+// host adds the ATT, L2CAP and ACL headers with os_mbuf_prepend(), which
+// writes into the block's leading space only if there is enough of it and
+// otherwise chains an msys mbuf in front, and the transport to the
+// controller may still copy the packet.
+
+#define POI_TX_POOL_PAYLOAD 244 // Largest write (ATT payload at MTU 247)
+#define POI_TX_POOL_LEADING 12  // ATT write command (3) + L2CAP (4) + ACL (4) headers, rounded up
+#define POI_TX_POOL_BLOCKS  POI_TX_MAX_IN_FLIGHT
+#define POI_TX_POOL_BLOCK_SIZE \
+    (sizeof(struct os_mbuf) + sizeof(struct os_mbuf_pkthdr) + POI_TX_POOL_LEADING + POI_TX_POOL_PAYLOAD)
+
+typedef struct {
+    struct os_mempool    mempool;
+    struct os_mbuf_pool  mbuf_pool;
+    os_membuf_t          mem[OS_MEMPOOL_SIZE(POI_TX_POOL_BLOCKS, POI_TX_POOL_BLOCK_SIZE)];
+    uint32_t             allocs;      // Blocks handed out (monotonic)
+    uint32_t             alloc_fails; // Pool empty when a write was due
+} poi_tx_pool_t;
+
+// Once at startup; the pool outlives connections since the stack may still hold its blocks
+int poi_tx_pool_init(poi_tx_pool_t *p, const char *name);
+
+// Empty packet mbuf with POI_TX_POOL_PAYLOAD bytes of room, or NULL if all blocks are queued
+struct os_mbuf *poi_tx_pool_get(poi_tx_pool_t *p);
+
+static inline int poi_tx_pool_in_use(const poi_tx_pool_t *p) {
+    return p->mempool.mp_num_blocks - p->mempool.mp_num_free;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_TX_POOL_H
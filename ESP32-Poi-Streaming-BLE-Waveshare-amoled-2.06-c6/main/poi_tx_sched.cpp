@@ -0,0 +1,98 @@
+#include "poi_tx_sched.h"
+#include <string.h>
+
+// Drain estimate bounds (Q8 packets per connection event)
+#define DRAIN_Q8_MIN   64   // 0.25 packets per event
+#define DRAIN_Q8_INIT  256  // 1 packet per event, what any peripheral will take
+#define DRAIN_Q8_MAX   (POI_TX_MAX_PKTS_PER_EVENT * 256)
+#define DRAIN_Q8_STEP  4    // Additive probe per successful write
+
+#define DEFAULT_CONN_ITVL_US 30000 // Until the first connection update arrives
+
+void poi_tx_sched_init(poi_tx_sched_t *s, uint32_t conn_itvl_us, int64_t now_us) {
+    memset(s, 0, sizeof(*s));
+    s->conn_itvl_us = conn_itvl_us ? conn_itvl_us : DEFAULT_CONN_ITVL_US;
+    s->drain_q8 = DRAIN_Q8_INIT;
+    s->last_drain_us = now_us;
+    s->window_start_us = now_us;
+}
+
+void poi_tx_sched_set_conn_itvl(poi_tx_sched_t *s, uint32_t conn_itvl_us) {
+    if (conn_itvl_us) s->conn_itvl_us = conn_itvl_us;
+}
+
+// Retire in-flight writes for every connection event that elapsed since the last call
+static void drain(poi_tx_sched_t *s, int64_t now_us) {
+    int64_t elapsed = now_us - s->last_drain_us;
+    if (elapsed < (int64_t)s->conn_itvl_us) return;
+
+    uint32_t events = (uint32_t)(elapsed / s->conn_itvl_us);
+    s->last_drain_us += (int64_t)events * s->conn_itvl_us;
+
+    if (s->in_flight == 0) { // Nothing queued, credit can't be banked
+        s->drain_acc_q8 = 0;
+        return;
+    }
+    uint32_t acc = s->drain_acc_q8 + events * s->drain_q8;
+    uint32_t whole = acc >> 8;
+    if (whole >= s->in_flight) {
+        s->in_flight = 0;
+        s->drain_acc_q8 = 0;
+    } else {
+        s->in_flight -= whole;
+        s->drain_acc_q8 = acc & 0xFF;
+    }
+}
+
+static void back_off(poi_tx_sched_t *s) {
+    s->drain_q8 = s->drain_q8 / 2 < DRAIN_Q8_MIN ? DRAIN_Q8_MIN : s->drain_q8 / 2;
+}
+
+bool poi_tx_sched_ready(poi_tx_sched_t *s, int64_t now_us, int msys_free) {
+    drain(s, now_us);
+    if (s->in_flight >= POI_TX_MAX_IN_FLIGHT) return false;
+    if (msys_free <= POI_TX_MSYS_RESERVE) {
+        // The host is holding buffers for someone; if we have writes queued we are part of it
+        if (s->in_flight > 0) back_off(s);
+        return false;
+    }
+    return true;
+}
+
+void poi_tx_sched_complete(poi_tx_sched_t *s, poi_tx_result_t result, uint8_t frames, uint16_t bytes) {
+    switch (result) {
+        case POI_TX_OK:
+            s->in_flight++;
+            s->frames_sent += frames;
+            s->writes_sent++;
+            s->bytes_sent += bytes;
+            s->window_frames += frames;
+            s->window_writes++;
+            s->window_bytes += bytes;
+            if (s->drain_q8 + DRAIN_Q8_STEP <= DRAIN_Q8_MAX) s->drain_q8 += DRAIN_Q8_STEP;
+            break;
+        case POI_TX_BUSY:
+            // Stack is full: treat the link as saturated and keep the write for the next slot
+            s->busy_count++;
+            s->in_flight = POI_TX_MAX_IN_FLIGHT;
+            s->drain_acc_q8 = 0;
+            back_off(s);
+            break;
+        case POI_TX_ERROR:
+            s->error_count++;
+            break;
+    }
+}
+
+bool poi_tx_sched_report_due(poi_tx_sched_t *s, int64_t now_us) {
+    int64_t elapsed = now_us - s->window_start_us;
+    if (elapsed < POI_TX_REPORT_WINDOW_US) return false;
+    s->fps = (float)s->window_frames * 1000000.0f / (float)elapsed;
+    s->writes_per_s = (float)s->window_writes * 1000000.0f / (float)elapsed;
+    s->bytes_per_s = (float)s->window_bytes * 1000000.0f / (float)elapsed;
+    s->window_frames = 0;
+    s->window_writes = 0;
+    s->window_bytes = 0;
+    s->window_start_us = now_us;
+    return true;
+}
@@ -0,0 +1,73 @@
+#ifndef POI_TX_SCHED_H
+#define POI_TX_SCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Writes we allow to sit in the NimBLE/controller queues per link before we wait
+#define POI_TX_MAX_IN_FLIGHT      4
+// Upper bound for the drain estimate (packets the link clears per connection event)
+#define POI_TX_MAX_PKTS_PER_EVENT 4
+// Free msys blocks we always leave for GATT procedures (handshake, MTU, discovery)
+#define POI_TX_MSYS_RESERVE       4
+// Window over which the achieved frame rate is measured
+#define POI_TX_REPORT_WINDOW_US   5000000
+
+// Outcome of a write handed to the stack
+typedef enum {
+    POI_TX_OK,    // queued by NimBLE
+    POI_TX_BUSY,  // BLE_HS_ENOMEM: stack out of buffers, write kept for the next slot
+    POI_TX_ERROR, // any other error: the write is lost and counted
+} poi_tx_result_t;
+
+// Per-link transmit state. All times are esp_timer microseconds.
+typedef struct {
+    uint32_t conn_itvl_us;       // Current connection interval of the link
+    uint16_t drain_q8;           // Estimated packets drained per connection event (Q8)
+    uint16_t drain_acc_q8;       // Fractional packets drained but not yet applied (Q8)
+    uint8_t  in_flight;          // Writes queued and not yet estimated as drained
+    int64_t  last_drain_us;      // Time up to which in_flight has been drained
+
+    // Counters (monotonic)
+    uint32_t frames_sent;
+    uint32_t frames_superseded;  // Rendered frames skipped because the link fell too far behind
+    uint32_t writes_sent;        // ATT writes (one per frame, or one per batch)
+    uint32_t bytes_sent;         // ATT payload bytes
+    uint32_t busy_count;         // ENOMEM returns
+    uint32_t error_count;        // Other write errors
+
+    // Achieved rates over the last complete window
+    int64_t  window_start_us;
+    uint32_t window_frames;
+    uint32_t window_writes;
+    uint32_t window_bytes;
+    float    fps;
+    float    writes_per_s;
+    float    bytes_per_s;
+} poi_tx_sched_t;
+
+// Reset the scheduler for a freshly connected link
+void poi_tx_sched_init(poi_tx_sched_t *s, uint32_t conn_itvl_us, int64_t now_us);
+
+// Connection parameters changed (BLE_GAP_EVENT_CONN_UPDATE)
+void poi_tx_sched_set_conn_itvl(poi_tx_sched_t *s, uint32_t conn_itvl_us);
+
+// True if the link can take another write now without overrunning it
+bool poi_tx_sched_ready(poi_tx_sched_t *s, int64_t now_us, int msys_free);
+
+// Feed back the result of the write issued after poi_tx_sched_ready() returned true,
+// carrying the given number of frames and ATT payload bytes
+void poi_tx_sched_complete(poi_tx_sched_t *s, poi_tx_result_t result, uint8_t frames, uint16_t bytes);
+
+// Rolls the rate window; returns true once per POI_TX_REPORT_WINDOW_US with the rates updated
+bool poi_tx_sched_report_due(poi_tx_sched_t *s, int64_t now_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // POI_TX_SCHED_H
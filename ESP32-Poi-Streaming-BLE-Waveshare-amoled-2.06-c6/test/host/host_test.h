@@ -0,0 +1,40 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+// Shared by the host tests: a failed CHECK prints where and exits non-zero
+// so ctest reports the test as failed, and the tests draw their random
+// numbers from test_rand(), which every run replays from the seed.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CHECK(cond)                                                                     \
+    do {                                                                                \
+        if (!(cond)) {                                                                  \
+            fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);    \
+            exit(1);                                                                    \
+        }                                                                               \
+    } while (0)
+
+static uint32_t test_rng = 0x9E3779B9;
+
+// Restart test_rand() from seed; 0 picks the default
+static inline void test_seed(uint32_t seed) {
+    test_rng = seed ? seed : 0x9E3779B9;
+}
+
+// xorshift32: every 32-bit value but 0 once per period
+static inline uint32_t test_rand() {
+    test_rng ^= test_rng << 13;
+    test_rng ^= test_rng >> 17;
+    test_rng ^= test_rng << 5;
+    return test_rng;
+}
+
+// Uniform in [0, 1)
+static inline double test_uniform() {
+    return test_rand() / 4294967296.0;
+}
+
+#endif // HOST_TEST_H
@@ -0,0 +1,12 @@
+#ifndef QMI8658_H
+#define QMI8658_H
+
+// Host stand-in for the waveshare/qmi8658 component: just the sample the
+// render modes read.
+
+typedef struct {
+    float accelX, accelY, accelZ; // g
+    float gyroX, gyroY, gyroZ;    // dps
+} qmi8658_data_t;
+
+#endif // QMI8658_H
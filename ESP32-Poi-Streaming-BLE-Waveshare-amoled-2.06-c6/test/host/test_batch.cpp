@@ -0,0 +1,141 @@
+// poi_batch writer/parser round trip: random frames are packed into batches
+// at the ATT payloads a link can negotiate and parsed back, then the parser
+// is run over every truncation of each packet and over random bytes. Then
+// the air cost of one frame stream sent one write per frame and in batches,
+// at MTU 23, 128 and 247: ATT, L2CAP and LL headers per packet on the 1M
+// PHY, LL packets split at 27 bytes (no DLE) or 251.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "poi_batch.h"
+#include "host_test.h"
+
+#define BATCHES 100000
+
+#define AIR_FRAMES  100000
+#define AIR_FPS     50
+#define ATT_HDR     3  // Write Without Response: opcode, handle
+#define L2CAP_HDR   4  // Length, channel
+#define LL_OVERHEAD 10 // Preamble, access address, PDU header, CRC
+
+struct frame {
+    uint8_t dt_ms, cmd, len;
+    uint8_t body[0xFF];
+};
+
+struct air {
+    uint64_t bytes, packets, writes;
+};
+
+// One write of value bytes over a link carrying ll_max bytes per LL packet
+static void send(air *a, size_t value, size_t ll_max) {
+    size_t sdu = L2CAP_HDR + ATT_HDR + value, packets = (sdu + ll_max - 1) / ll_max;
+    a->bytes += sdu + packets * LL_OVERHEAD;
+    a->packets += packets;
+    a->writes++;
+}
+
+// A stream of coded 21 LED frames: half a static look (5 bytes), half anything up to raw
+static uint8_t air_body_len(size_t cap) {
+    size_t len = test_rand() % 2 ? 5 : 6 + test_rand() % 59;
+    return (uint8_t)(len < cap - poi_proto::HDR_LEN ? len : cap - poi_proto::HDR_LEN); // As the LED clamp would
+}
+
+// The stream with every write as full as it gets, as a backlogged link sends it
+static void air_cost() {
+    static const uint16_t mtus[] = {23, 128, 247};
+    static uint8_t body[0xFF], buf[244];
+    printf("MTU  LL max   single: bytes/frame  packets/s   batched: bytes/frame  packets/s  frames/write\n");
+    for (uint16_t mtu : mtus) {
+        size_t cap = mtu - ATT_HDR, ll_max = mtu == 23 ? 27 : 251;
+        air one = {}, many = {};
+        poi_batch_t b;
+        poi_batch_begin(&b, buf, (uint16_t)cap);
+        for (int f = 0; f < AIR_FRAMES; f++) {
+            uint8_t len = air_body_len(cap);
+            send(&one, poi_proto::HDR_LEN + len, ll_max);
+            if (b.count && (b.count == POI_BATCH_MAX_FRAMES || !poi_batch_fits(&b, len))) {
+                send(&many, b.len, ll_max);
+                poi_batch_begin(&b, buf, (uint16_t)cap);
+            }
+            if (!poi_batch_add(&b, 0, poi_proto::CC_STREAM_DATA, body, len)) {
+                send(&many, poi_proto::HDR_LEN + len, ll_max); // Too big to batch: on its own
+            }
+        }
+        if (b.count) send(&many, b.len, ll_max);
+        double secs = (double)AIR_FRAMES / AIR_FPS;
+        printf("%3u %7zu %20.1f %10.0f %21.1f %10.0f %13.2f\n", mtu, ll_max, (double)one.bytes / AIR_FRAMES,
+               one.packets / secs, (double)many.bytes / AIR_FRAMES, many.packets / secs, (double)AIR_FRAMES / many.writes);
+        CHECK(many.bytes <= one.bytes && many.packets <= one.packets);
+        if (mtu > 23) CHECK(many.packets * 3 < one.packets); // Several frames to a packet once they fit
+    }
+}
+
+int main() {
+    static const uint16_t caps[] = {20, 64, 182, 244}; // Default MTU up to the 247 we ask for
+    uint8_t buf[244];
+    frame in[POI_BATCH_MAX_FRAMES];
+    uint32_t frames = 0, bytes = 0, payload = 0;
+    for (int r = 0; r < BATCHES; r++) {
+        uint16_t cap = caps[test_rand() % 4];
+        poi_batch_t b;
+        poi_batch_begin(&b, buf, cap);
+        int n = 0;
+        for (;;) {
+            frame &f = in[n];
+            f.dt_ms = (uint8_t)test_rand();
+            f.cmd = (uint8_t)test_rand();
+            f.len = (uint8_t)(test_rand() % 4 ? test_rand() % 64 : test_rand());
+            for (int k = 0; k < f.len; k++) f.body[k] = (uint8_t)test_rand();
+            bool fits = poi_batch_fits(&b, f.len);
+            uint16_t before = b.len;
+            CHECK(poi_batch_add(&b, f.dt_ms, f.cmd, f.body, f.len) == fits);
+            if (!fits) {
+                CHECK(b.len == before && b.count == n); // Unchanged
+                break;
+            }
+            if (n == 0) f.dt_ms = 0; // The first frame plays on arrival
+            if (++n == POI_BATCH_MAX_FRAMES) break;
+        }
+        CHECK(b.len <= cap);
+        CHECK(b.count == n && buf[poi_proto::HDR_LEN] == n);
+
+        size_t off = 0;
+        poi_batch_frame_t f;
+        int got = 0;
+        while (poi_batch_next(buf, b.len, &off, &f) == 1) {
+            CHECK(got < n);
+            const frame &e = in[got++];
+            CHECK(f.dt_ms == e.dt_ms && f.cmd == e.cmd && f.len == e.len);
+            CHECK(memcmp(f.body, e.body, f.len) == 0);
+        }
+        CHECK(got == n && off == b.len);
+        frames += n;
+        bytes += b.len;
+        for (int i = 0; i < n; i++) payload += in[i].len;
+
+        // Every truncation parses a prefix of the frames and then fails
+        for (uint16_t cut = 0; cut < b.len; cut++) {
+            off = 0;
+            int ok = 0, rc;
+            while ((rc = poi_batch_next(buf, cut, &off, &f)) == 1) ok++;
+            CHECK(ok <= n && off <= cut);
+            CHECK(rc == -1 || (rc == 0 && off == cut));
+        }
+    }
+
+    for (int r = 0; r < BATCHES; r++) { // Random packets stay within their bounds
+        size_t len = test_rand() % sizeof(buf);
+        for (size_t k = 0; k < len; k++) buf[k] = (uint8_t)test_rand();
+        size_t off = 0;
+        poi_batch_frame_t f;
+        while (poi_batch_next(buf, len, &off, &f) == 1) CHECK(f.body + f.len <= buf + len);
+    }
+
+    printf("%d batches, %.2f frames each, %.1f%% of the bytes are frame bodies\n", BATCHES, (double)frames / BATCHES,
+           100.0 * payload / bytes);
+    air_cost();
+    puts("batch ok");
+    return 0;
+}
@@ -0,0 +1,160 @@
+// Broadcast loss recovery: 200k frames of 21 LEDs x 2 slices through
+// poi_bcast_tx_encode, a lossy channel and the reference receiver. A frame
+// counts when the receiver has it, bit exact, `repeat` frames after it was
+// sent (the playout delay covers that). Channels are independent loss and
+// Gilbert-Elliott bursts. For comparison, an XOR parity over the previous k
+// frames at the same PDU size and deadline, modelled on which frames arrive
+// (the XOR itself is exact). Then host timings and the slice map.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "poi_bcast.h"
+#include "poi_frame_codec.h"
+#include "host_test.h"
+
+#define LEDS    21
+#define SLICES  2
+#define FRAMES  200000
+#define CONTENT 4096
+#define WARMUP  16
+
+static uint8_t content[CONTENT][SLICES * LEDS * 3];
+
+struct channel {
+    const char *name;
+    bool bursty;
+    double p;                       // iid loss
+    double p_good_bad, p_bad_good, p_bad_loss; // Gilbert-Elliott, 1% loss while good
+    bool bad;
+    std::mt19937 rng;
+
+    bool lost() {
+        std::uniform_real_distribution<double> u(0, 1);
+        if (!bursty) return u(rng) < p;
+        if (bad ? u(rng) < p_bad_good : u(rng) < p_good_bad) bad = !bad;
+        return u(rng) < (bad ? p_bad_loss : 0.01);
+    }
+};
+
+static channel make(const char *name, bool bursty, double p, double gb = 0, double bg = 0, double bl = 0) {
+    return {name, bursty, p, gb, bg, bl, false, std::mt19937(99)};
+}
+
+// Percent of frames on time with each frame repeated `repeat` frames later; 0 bad frames or fails
+static double repeat_run(channel c, uint8_t repeat, size_t *pdu_len) {
+    static poi_bcast_tx_t tx;
+    static poi_bcast_rx_t rx;
+    CHECK(poi_bcast_tx_init(&tx, SLICES, LEDS, repeat, 40));
+    poi_bcast_rx_reset(&rx);
+    int ok = 0, counted = 0;
+    for (int t = 0; t < FRAMES; t++) {
+        uint8_t pdu[POI_BCAST_PDU_MAX];
+        *pdu_len = poi_bcast_tx_encode(&tx, content[t % CONTENT], pdu, sizeof(pdu));
+        CHECK(*pdu_len > 0);
+        if (!c.lost()) CHECK(poi_bcast_rx_feed(&rx, pdu, *pdu_len) == 0);
+        int f = t - repeat;
+        if (f < WARMUP) continue;
+        counted++;
+        uint8_t rgb[LEDS * 3];
+        int s = f & 1;
+        if (poi_bcast_rx_frame(&rx, (uint16_t)f, (uint8_t)s, rgb)) {
+            CHECK(memcmp(rgb, &content[f % CONTENT][s * LEDS * 3], sizeof(rgb)) == 0);
+            ok++;
+        }
+    }
+    CHECK(rx.malformed == 0);
+    return 100.0 * ok / counted;
+}
+
+// Percent on time if each PDU carried its frame plus the XOR of the previous k
+static double parity_run(channel c, int k) {
+    std::vector<bool> have(FRAMES), parity(FRAMES);
+    int ok = 0, counted = 0;
+    for (int t = 0; t < FRAMES; t++) {
+        if (!c.lost()) have[t] = parity[t] = true;
+        for (bool progress = true; progress;) { // Peel: a parity missing exactly one of its frames rebuilds it
+            progress = false;
+            for (int p = t; p > t - WARMUP && p > k; p--) {
+                if (!parity[p]) continue;
+                int missing = 0, lost = 0;
+                for (int j = 1; j <= k; j++) {
+                    if (!have[p - j]) missing++, lost = p - j;
+                }
+                if (missing == 1) have[lost] = progress = true;
+            }
+        }
+        int f = t - k;
+        if (f < WARMUP) continue;
+        counted++;
+        if (have[f]) ok++;
+    }
+    return 100.0 * ok / counted;
+}
+
+int main() {
+    for (int f = 0; f < CONTENT; f++) {
+        for (int k = 0; k < SLICES * LEDS * 3; k++) content[f][k] = (uint8_t)(128 + 100 * sin(f * 0.1 + k * 0.3));
+        for (int s = 0; s < SLICES; s++) { // So 4-bit slices carry it exactly
+            uint8_t *slice = &content[f][s * LEDS * 3];
+            poi_codec_reduce_depth(slice, LEDS * 3, slice);
+        }
+    }
+
+    channel channels[] = {
+        make("iid 5%", false, 0.05),
+        make("iid 10%", false, 0.10),
+        make("iid 20%", false, 0.20),
+        make("iid 30%", false, 0.30),
+        make("bursty (~9% avg)", true, 0, 0.03, 0.25, 0.7),
+        make("bursty (~19% avg)", true, 0, 0.06, 0.2, 0.8),
+    };
+    printf("%% of frames on time   none   rep1   rep2   rep3   rep4   xor2   xor3\n");
+    size_t len[POI_BCAST_REPEAT_MAX + 1];
+    for (const channel &c : channels) {
+        double rep[POI_BCAST_REPEAT_MAX + 1];
+        printf("%-20s", c.name);
+        for (int r = 0; r <= POI_BCAST_REPEAT_MAX; r++) {
+            rep[r] = repeat_run(c, (uint8_t)r, &len[r]);
+            printf(" %6.1f", rep[r]);
+        }
+        double xor2 = parity_run(c, 2), xor3 = parity_run(c, 3);
+        printf(" %6.1f %6.1f\n", xor2, xor3);
+        CHECK(rep[1] > rep[0]);
+        CHECK(rep[2] >= xor2 && rep[3] >= xor3); // Why the format carries a repeat, not parity
+    }
+    printf("PDU bytes:           ");
+    for (int r = 0; r <= POI_BCAST_REPEAT_MAX; r++) printf(" %6zu", len[r]);
+    printf("\n");
+
+    static poi_bcast_tx_t tx;
+    static poi_bcast_rx_t rx;
+    poi_bcast_tx_init(&tx, SLICES, LEDS, 2, 40);
+    poi_bcast_rx_reset(&rx);
+    uint8_t pdu[POI_BCAST_PDU_MAX];
+    size_t n = 0;
+    const int runs = 1000000;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int t = 0; t < runs; t++) n = poi_bcast_tx_encode(&tx, content[t & (CONTENT - 1)], pdu, sizeof(pdu));
+    auto t1 = std::chrono::steady_clock::now();
+    for (int t = 0; t < runs; t++) {
+        pdu[6] = (uint8_t)t; // seq
+        pdu[7] = (uint8_t)(t >> 8);
+        if (t % 10) poi_bcast_rx_feed(&rx, pdu, n);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    auto ns = [](auto a, auto b) { return std::chrono::duration<double, std::nano>(b - a).count() / runs; };
+    printf("host: encode %.0f ns/frame, receive %.0f ns/frame\n", ns(t0, t1), ns(t1, t2));
+
+    uint8_t map[4] = {0, 1, 0, 1}, ad[64];
+    size_t ml = poi_bcast_map_encode(SLICES, map, 4, ad, sizeof(ad));
+    CHECK(ml > 0);
+    CHECK(poi_bcast_slice_for(ad, ml, 3) == 1 && poi_bcast_slice_for(ad, ml, 2) == 0);
+    CHECK(poi_bcast_slice_for(ad, ml, 7) == 7 % SLICES); // Past the map: ID % slices
+    puts("bcast ok");
+    return 0;
+}
@@ -0,0 +1,172 @@
+// Time to bring up N poi, serial against pipelined, on a stand-in GAP/GATT
+// layer driving the real poi_conn_mgr. Poi advertise every 100 ms with up
+// to 10 ms of jitter; a connect completes at the target's next advertisement
+// plus the first connection event; discovery and the config read take 8 ATT
+// round trips at a 30 ms interval. Serial brings up one poi at a time:
+// connect to the first report, scan again once it is ready. Pipelined
+// collects candidates for CANDIDATE_WINDOW_MS (or until every free slot has
+// one) and connects the next as soon as the last one has connected, while
+// its discovery is still running. Built with 8 slots.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+#include "poi_conn_mgr.h"
+#include "host_test.h"
+
+#define ADV_ITVL_US          100000
+#define CONN_ITVL_US         30000
+#define ATT_ROUND_TRIPS      8      // Service and characteristic discovery, CCCD, config request and reply
+#define CANDIDATE_WINDOW_MS  150    // As in main.cpp
+#define CANDIDATE_MAX_AGE_MS 2000
+#define SEEDS                200
+
+struct event {
+    int64_t t;
+    int order;
+    std::function<void()> fn;
+    bool operator>(const event &o) const { return t != o.t ? t > o.t : order > o.order; }
+};
+
+static std::priority_queue<event, std::vector<event>, std::greater<event>> events;
+static int64_t now;
+static int order;
+static std::mt19937 rng;
+
+static void at(int64_t t, std::function<void()> fn) {
+    events.push({t, order++, std::move(fn)});
+}
+
+static bool pipelined;
+static poi_conn_mgr_t m;
+static std::vector<int64_t> adv_phase, ready_at;
+static std::vector<bool> linked;
+static int connecting = -1;
+static bool scanning, window_open;
+static int window_gen;
+
+static int64_t next_adv(int p) {
+    int64_t k = now < adv_phase[p] ? 0 : (now - adv_phase[p]) / ADV_ITVL_US + 1;
+    return adv_phase[p] + k * ADV_ITVL_US + rng() % 10000;
+}
+
+static void scan_start();
+
+static void connect_to(int p) {
+    scanning = false;
+    connecting = p;
+    at(next_adv(p) + 1250 + CONN_ITVL_US / 4, [p] { // CONNECT_IND, then the first connection event
+        int slot = poi_conn_mgr_connected(&m, (uint16_t)p);
+        CHECK(slot >= 0);
+        linked[p] = true;
+        connecting = -1;
+        at(now + ATT_ROUND_TRIPS * 2 * CONN_ITVL_US, [p, slot] {
+            CHECK(poi_conn_mgr_advance(&m, slot, POI_SLOT_READY));
+            ready_at[p] = now;
+            if (!pipelined) scan_start();
+        });
+        if (pipelined) scan_start(); // Discovery runs on its link; the next connect goes out now
+    });
+}
+
+static bool connect_candidate() {
+    if (poi_conn_mgr_reserve(&m) < 0) return false;
+    poi_candidate_t c;
+    while (poi_conn_mgr_candidate_take(&m, now, CANDIDATE_MAX_AGE_MS * 1000LL, &c)) {
+        if (linked[c.addr[0]]) continue;
+        connect_to(c.addr[0]);
+        return true;
+    }
+    poi_conn_mgr_connect_failed(&m);
+    return false;
+}
+
+static void window_end(int gen) {
+    if (!window_open || gen != window_gen) return;
+    window_open = false;
+    scan_start();
+}
+
+static void on_adv(int p) {
+    if (!scanning || linked[p] || p == connecting) return;
+    if (!pipelined) {
+        if (poi_conn_mgr_reserve(&m) >= 0) connect_to(p);
+        return;
+    }
+    uint8_t addr[6] = {(uint8_t)p};
+    int n = poi_conn_mgr_candidate_add(&m, 0, addr, now);
+    int free_slots = POI_MAX_DEVICES - poi_conn_mgr_count(&m, POI_SLOT_CONNECTING);
+    if (n < 0 || n >= free_slots) { // Enough to fill every slot
+        window_open = false;
+        scan_start();
+    } else if (!window_open) {
+        window_open = true;
+        int gen = ++window_gen;
+        at(now + CANDIDATE_WINDOW_MS * 1000, [gen] { window_end(gen); });
+    }
+}
+
+static void scan_start() {
+    if (!poi_conn_mgr_want_scan(&m)) return;
+    if (pipelined) {
+        if (window_open) return; // Still collecting, the window's end carries on
+        if (connect_candidate()) return;
+    }
+    scanning = true;
+}
+
+static void advertise(int p) {
+    at(next_adv(p), [p] {
+        on_adv(p);
+        if (!linked[p]) advertise(p);
+    });
+}
+
+// Milliseconds until the last of n poi is ready
+static double run(int n, bool pipe, unsigned seed) {
+    pipelined = pipe;
+    rng.seed(seed);
+    poi_conn_mgr_init(&m);
+    events = {};
+    now = 0;
+    connecting = -1;
+    scanning = window_open = false;
+    adv_phase.assign(n, 0);
+    ready_at.assign(n, -1);
+    linked.assign(n, false);
+    for (int64_t &a : adv_phase) a = rng() % ADV_ITVL_US;
+    scan_start();
+    for (int p = 0; p < n; p++) advertise(p);
+    auto all_ready = [] { return std::all_of(ready_at.begin(), ready_at.end(), [](int64_t r) { return r >= 0; }); };
+    while (!events.empty() && !all_ready()) {
+        event e = events.top();
+        events.pop();
+        now = e.t;
+        e.fn();
+    }
+    CHECK(all_ready() && poi_conn_mgr_count(&m, POI_SLOT_READY) == n);
+    return *std::max_element(ready_at.begin(), ready_at.end()) / 1000.0;
+}
+
+int main() {
+    static_assert(POI_MAX_DEVICES == 8, "built with CONFIG_POI_MAX_DEVICES=8");
+    printf("poi   serial   pipelined  (mean of %d seeds)\n", SEEDS);
+    for (int n : {2, 4, 8}) {
+        double serial = 0, pipe = 0;
+        for (unsigned k = 0; k < SEEDS; k++) {
+            serial += run(n, false, k);
+            pipe += run(n, true, k);
+        }
+        serial /= SEEDS;
+        pipe /= SEEDS;
+        printf("%3d  %5.0f ms  %6.0f ms\n", n, serial, pipe);
+        CHECK(pipe < serial);
+        if (n == 8) CHECK(pipe < serial / 3);
+    }
+    puts("bringup ok");
+    return 0;
+}
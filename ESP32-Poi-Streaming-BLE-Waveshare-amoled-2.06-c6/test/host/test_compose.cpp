@@ -0,0 +1,173 @@
+// poi_compose's packed kernels against a per-channel reference on 2M random
+// pixels, operators and opacities, and how far they sit from the exact float
+// blend. Then the RGB conversions, strips of every length, stacks built
+// from real modes, and every mode into a strip shorter than its own. The compositor's timings are the COMPOSEBENCH records of
+// test_mode_bench.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "poi_compose.h"
+#include "poi_modes.h"
+#include "host_test.h"
+
+#define CASES 2000000
+
+// 0..255 to the 0..256 weight the kernels use
+static int weight(int x) {
+    return x + (x >> 7);
+}
+
+// One channel of lerp(d, op(d, s), w); the alpha channel isn't multiplied or screened
+static int channel(int d, int s, int op, int w, bool alpha) {
+    int x;
+    switch (op) {
+        case POI_COMPOSE_ADD: x = d + s > 255 ? 255 : d + s; break;
+        case POI_COMPOSE_MULTIPLY: x = alpha ? d : (d * weight(s)) >> 8; break;
+        case POI_COMPOSE_SCREEN: x = alpha ? d : 255 - (((255 - d) * weight(255 - s)) >> 8); break;
+        default: x = s; break;
+    }
+    return w == 256 ? x : (d * (256 - w) + x * w) >> 8;
+}
+
+static uint32_t reference(uint32_t d, uint32_t s, int op, uint8_t opacity) {
+    int w = weight(((s >> 24) * weight(opacity)) >> 8);
+    if (!w) return d;
+    uint32_t out = 0;
+    for (int c = 0; c < 4; c++) out |= (uint32_t)channel(d >> (8 * c) & 255, s >> (8 * c) & 255, op, w, c == 3) << (8 * c);
+    return out;
+}
+
+static void kernels() {
+    static const char *const names[] = {"alpha", "add", "multiply", "screen"};
+    double max_err[4] = {};
+    for (int k = 0; k < CASES; k++) {
+        uint32_t d = test_rand(), s = test_rand(), r = test_rand();
+        int op = r % 4;
+        uint8_t opacity = k % 7 ? (uint8_t)(r >> 24) : 255;
+        if (k % 11 == 0) s |= 0xFF000000u;
+        uint32_t out = d;
+        poi_compose_blend(&out, &s, (poi_compose_op_t)op, opacity, 1);
+        CHECK(out == reference(d, s, op, opacity));
+        double a = weight(((s >> 24) * weight(opacity)) >> 8) / 256.0;
+        for (int c = 0; c < 3; c++) {
+            double dc = (d >> (8 * c) & 255) / 255.0, sc = (s >> (8 * c) & 255) / 255.0, x;
+            switch (op) {
+                case POI_COMPOSE_ADD: x = fmin(1, dc + sc); break;
+                case POI_COMPOSE_MULTIPLY: x = dc * sc; break;
+                case POI_COMPOSE_SCREEN: x = 1 - (1 - dc) * (1 - sc); break;
+                default: x = sc; break;
+            }
+            max_err[op] = fmax(max_err[op], fabs((dc + (x - dc) * a) * 255 - (out >> (8 * c) & 255)));
+        }
+    }
+    printf("%d pixels match the per-channel reference; max |error| against float:", CASES);
+    for (int op = 0; op < 4; op++) {
+        printf(" %s %.2f", names[op], max_err[op]);
+        CHECK(max_err[op] < 2.5);
+    }
+    printf(" LSB\n");
+}
+
+static void strips() {
+    uint8_t rgb[3 * 64], back[3 * 64];
+    uint32_t px[64], dst[64], src[64], one[64];
+    for (uint8_t &c : rgb) c = (uint8_t)(test_rand() >> 24);
+    for (int i = 0; i < 8; i++) rgb[i * 3] = rgb[i * 3 + 1] = rgb[i * 3 + 2] = 0; // Black: clear when keyed
+    for (int n = 0; n <= 64; n++) {
+        poi_compose_from_rgb(rgb, POI_COMPOSE_OPAQUE, px, n);
+        memset(back, 0xAA, sizeof(back));
+        poi_compose_to_rgb(px, back, n);
+        CHECK(memcmp(back, rgb, n * 3) == 0 && (n == 64 || back[n * 3] == 0xAA));
+        poi_compose_from_rgb(rgb, POI_COMPOSE_KEYED, src, n);
+        for (int i = 0; i < n; i++) {
+            uint8_t m = rgb[i * 3] > rgb[i * 3 + 1] ? rgb[i * 3] : rgb[i * 3 + 1];
+            m = m > rgb[i * 3 + 2] ? m : rgb[i * 3 + 2];
+            CHECK(px[i] >> 24 == 255 && src[i] >> 24 == m && (src[i] & 0xFFFFFF) == (px[i] & 0xFFFFFF));
+        }
+        for (int op = 0; op < 4; op++) { // A strip blends like its pixels one at a time
+            for (int i = 0; i < n; i++) dst[i] = one[i] = test_rand();
+            uint8_t opacity = (uint8_t)(test_rand() >> 24);
+            poi_compose_blend(dst, src, (poi_compose_op_t)op, opacity, n);
+            for (int i = 0; i < n; i++) {
+                poi_compose_blend(&one[i], &src[i], (poi_compose_op_t)op, opacity, 1);
+                CHECK(dst[i] == one[i]);
+            }
+        }
+    }
+    puts("RGB conversions and 0..64-LED strips ok");
+}
+
+// An opaque layer drawn with ALPHA at full opacity hides everything below it
+using covered = poi_modes::stack<POI_MODE_LEDS, poi_modes::layer<poi_modes::mode_gravity_rainbow>,
+                                 poi_modes::layer<poi_modes::mode_spin_fire>>;
+
+static void stacks() {
+    poi_modes::input in = {};
+    in.imu.accelX = 0.5f;
+    in.imu.accelY = 0.8f;
+    in.imu.gyroZ = 400.0f;
+    in.anim_step_q16 = 1 << 16;
+    in.audio_level = POI_FX_Q15(0.05);
+    for (int i = 0; i < POI_MODE_BINS; i++) in.spectrum_q8[i] = -20 * 256;
+
+    uint8_t a[POI_MODE_LEDS * 3], b[POI_MODE_LEDS * 3];
+    covered::state cs{};
+    poi_modes::stateless none;
+    covered::render(cs, in, a, sizeof(a));
+    poi_modes::mode_spin_fire(none, in, b, sizeof(b));
+    CHECK(memcmp(a, b, sizeof(a)) == 0);
+
+    poi_modes::rainbow_pulse::state full{}, part{};
+    uint8_t whole[POI_MODE_LEDS * 3], shorter[POI_MODE_LEDS * 3 + 8];
+    for (int f = 0; f < 50; f++) { // Only len bytes written, and the same ones
+        memset(shorter, 0xAA, sizeof(shorter));
+        poi_modes::rainbow_pulse::render(full, in, whole, sizeof(whole));
+        poi_modes::rainbow_pulse::render(part, in, shorter, 10 * 3);
+        CHECK(memcmp(shorter, whole, 10 * 3) == 0);
+        for (size_t i = 10 * 3; i < sizeof(shorter); i++) CHECK(shorter[i] == 0xAA);
+        in.spectrum_q8[0] += 256;
+    }
+    puts("stacks ok: an opaque top layer covers the base, a short strip gets only len bytes");
+}
+
+// Every registry mode, like the stacks, writes the first len / 3 LEDs of its full strip and nothing past them
+static void short_strips() {
+    using block = poi_modes::arena<poi_modes::registry, 2>;
+    static block blocks;
+    void *full = blocks.alloc(), *part = blocks.alloc();
+    poi_modes::input in = {};
+    in.anim_step_q16 = 1 << 16;
+    uint8_t whole[POI_MODE_LEDS * 3], shorter[POI_MODE_LEDS * 3 + 8];
+    for (int m = 0; m < poi_modes::COUNT; m++) {
+        for (int n = 0; n <= POI_MODE_LEDS; n += 5) {
+            poi_modes::registry[m].init(full);
+            poi_modes::registry[m].init(part);
+            for (int f = 0; f < 20; f++) {
+                in.imu.accelX = (test_uniform() - 0.5f) * 2;
+                in.imu.accelY = (test_uniform() - 0.5f) * 2;
+                in.imu.gyroZ = (test_uniform() - 0.5f) * 1000;
+                in.audio_level = (int32_t)(test_uniform() * POI_FX_Q15(0.1));
+                for (int i = 0; i < POI_MODE_BINS; i++) in.spectrum_q8[i] = (int32_t)(test_uniform() * -60 * 256);
+                in.random = test_rand();
+                memset(shorter, 0xAA, sizeof(shorter));
+                poi_modes::registry[m].render(full, in, whole, sizeof(whole));
+                poi_modes::registry[m].render(part, in, shorter, n * 3 + 2); // A partial LED is left alone too
+                CHECK(memcmp(shorter, whole, n * 3) == 0);
+                for (size_t i = n * 3; i < sizeof(shorter); i++) CHECK(shorter[i] == 0xAA);
+            }
+        }
+    }
+    printf("%d modes ok: a short strip gets only len / 3 LEDs, the same ones\n", poi_modes::COUNT);
+}
+
+int main() {
+    poi_modes::init();
+    kernels();
+    strips();
+    stacks();
+    short_strips();
+    puts("compose ok");
+    return 0;
+}
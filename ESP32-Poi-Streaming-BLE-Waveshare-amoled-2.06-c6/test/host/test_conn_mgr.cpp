@@ -0,0 +1,120 @@
+// poi_conn_mgr slot bookkeeping: 8 peers connect, fail, progress through
+// discovery and drop in random order against a model of what each peer is
+// doing, with the slot invariants checked after every step.
+
+#include <stdint.h>
+#include <stdio.h>
+#include "poi_conn_mgr.h"
+#include "host_test.h"
+
+#define PEERS 8
+#define STEPS 2000000
+
+enum { IDLE, CONNECTING, LINKED };
+
+struct peer {
+    int state;
+    int slot;
+    uint16_t handle;
+};
+
+static void check_invariants(const poi_conn_mgr_t &m, const peer *p) {
+    int connecting = 0, used = 0;
+    for (int i = 0; i < POI_MAX_DEVICES; i++) {
+        const poi_slot_t &s = m.slot[i];
+        CHECK(s.state <= POI_SLOT_STREAMING);
+        CHECK((s.state >= POI_SLOT_DISCOVERING) == (s.conn_handle != POI_CONN_NONE));
+        if (s.state == POI_SLOT_CONNECTING) connecting++;
+        if (s.state != POI_SLOT_FREE) used++;
+        for (int j = 0; j < i; j++) CHECK(s.conn_handle == POI_CONN_NONE || m.slot[j].conn_handle != s.conn_handle);
+    }
+    CHECK(connecting <= 1); // One connect procedure at a time
+    CHECK(used == poi_conn_mgr_count(&m, POI_SLOT_CONNECTING));
+    CHECK(poi_conn_mgr_want_scan(&m) == (connecting == 0 && used < POI_MAX_DEVICES));
+
+    // Each peer's view agrees with its slot, and no slot is in use without a peer
+    int owned = 0;
+    for (int k = 0; k < PEERS; k++) {
+        if (p[k].state == IDLE) continue;
+        owned++;
+        const poi_slot_t &s = m.slot[p[k].slot];
+        if (p[k].state == CONNECTING) {
+            CHECK(s.state == POI_SLOT_CONNECTING);
+        } else {
+            CHECK(s.state >= POI_SLOT_DISCOVERING && s.conn_handle == p[k].handle);
+            CHECK(poi_conn_mgr_find(&m, p[k].handle) == p[k].slot);
+        }
+    }
+    CHECK(owned == used);
+}
+
+int main() {
+    test_seed(0x1B873593);
+    poi_conn_mgr_t m;
+    poi_conn_mgr_init(&m);
+    peer p[PEERS] = {};
+    uint16_t next_handle = 1;
+    int full = 0, streaming_max = 0;
+    for (int step = 0; step < STEPS; step++) {
+        int k = test_rand() % PEERS;
+        switch (p[k].state) {
+            case IDLE: { // Seen advertising: connect if the manager takes it
+                bool want = poi_conn_mgr_want_scan(&m);
+                int slot = poi_conn_mgr_reserve(&m);
+                CHECK((slot >= 0) == want);
+                if (slot >= 0) p[k] = {CONNECTING, slot, POI_CONN_NONE};
+                break;
+            }
+            case CONNECTING:
+                if (test_rand() % 4 == 0) {
+                    poi_conn_mgr_connect_failed(&m);
+                    p[k].state = IDLE;
+                } else {
+                    uint16_t h;
+                    do { // Handles wrap; skip ones still linked
+                        h = next_handle++;
+                        if (next_handle == POI_CONN_NONE) next_handle = 1;
+                    } while (poi_conn_mgr_find(&m, h) >= 0);
+                    CHECK(poi_conn_mgr_connected(&m, h) == p[k].slot);
+                    p[k].state = LINKED;
+                    p[k].handle = h;
+                }
+                break;
+            default: {
+                uint32_t r = test_rand() % 16;
+                if (r == 0) {
+                    CHECK(poi_conn_mgr_disconnected(&m, p[k].handle) == p[k].slot);
+                    CHECK(poi_conn_mgr_disconnected(&m, p[k].handle) == -1); // Second report is not ours
+                    p[k].state = IDLE;
+                } else {
+                    uint8_t cur = m.slot[p[k].slot].state;
+                    poi_slot_state_t to = (poi_slot_state_t)(test_rand() % (POI_SLOT_STREAMING + 1));
+                    bool ok = poi_conn_mgr_advance(&m, p[k].slot, to);
+                    CHECK(ok == (to == cur + 1));
+                    CHECK(m.slot[p[k].slot].state == (ok ? (uint8_t)to : cur));
+                }
+                break;
+            }
+        }
+        // Stray events the stack can deliver: unknown handles, a failure with nothing pending
+        CHECK(poi_conn_mgr_disconnected(&m, POI_CONN_NONE) == -1);
+        CHECK(poi_conn_mgr_advance(&m, -1, POI_SLOT_READY) == false);
+        if (test_rand() % 16 == 0) {
+            bool pending = false;
+            for (int j = 0; j < PEERS; j++) pending |= p[j].state == CONNECTING;
+            if (!pending) {
+                poi_conn_mgr_connect_failed(&m);
+                CHECK(poi_conn_mgr_connected(&m, 0x0FFF) == -1);
+            }
+        }
+        check_invariants(m, p);
+        if (poi_conn_mgr_count(&m, POI_SLOT_CONNECTING) == POI_MAX_DEVICES) full++;
+        int streaming = poi_conn_mgr_count(&m, POI_SLOT_STREAMING);
+        if (streaming > streaming_max) streaming_max = streaming;
+    }
+    printf("%d steps, %d peers for %d slots: all slots in use %.1f%% of steps, up to %d streaming\n", STEPS, PEERS,
+           POI_MAX_DEVICES, 100.0 * full / STEPS, streaming_max);
+    CHECK(full > 0 && streaming_max == POI_MAX_DEVICES);
+    puts("conn_mgr ok");
+    return 0;
+}
@@ -0,0 +1,284 @@
+// poi_fixed against libm, then every fixed-point mode against the float
+// mode it replaced (ref/float_modes.inc) on the same random-walk IMU and
+// audio inputs: 60 runs of 250 frames from power-on state, at 25 and
+// 31.25 fps. The float modes keep their state in function statics, so each
+// run is a forked child. Reports channel difference max / p99 / p99.9 /
+// mean and the share of frames with a channel off by more than 8, then
+// host time per frame and the float version's libm calls per frame.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "poi_fixed.h"
+#include "poi_modes.h"
+#include "host_test.h"
+
+#define NUM_LEDS  POI_MODE_LEDS
+#define N_SAMPLES 16
+#define RUNS      60
+#define FRAMES    250
+#define TIMED     4096
+
+typedef int TickType_t;
+#define pdTRUE 1
+static int audio_spectrum_buffer_mutex;
+static inline int xSemaphoreTake(int, TickType_t) { return pdTRUE; }
+static inline void xSemaphoreGive(int) {}
+
+static uint32_t esp_random() {
+    return test_rand();
+}
+
+static long libm_calls;
+static float audio_buffer[N_SAMPLES];
+static float spectrum[N_SAMPLES / 2];
+static float anim_step = 1.0f;
+#define MIN_BRIGHTNESS 0.05f
+
+namespace ref { // As shipped, libm calls counted
+#define atan2f(a, b) (libm_calls++, ::atan2f(a, b))
+#define sinf(a) (libm_calls++, ::sinf(a))
+#define cosf(a) (libm_calls++, ::cosf(a))
+#define expf(a) (libm_calls++, ::expf(a))
+#define sqrtf(a) (libm_calls++, ::sqrtf(a))
+#define fmodf(a, b) (libm_calls++, ::fmodf(a, b))
+#define REF_SPECTRUM_LEVEL(x) (x)
+#include "ref/float_modes.inc"
+#undef REF_SPECTRUM_LEVEL
+#undef atan2f
+#undef sinf
+#undef cosf
+#undef expf
+#undef sqrtf
+#undef fmodf
+} // namespace ref
+
+namespace ref_capped { // audio_spectrum with the port's brightness cap
+#define REF_SPECTRUM_LEVEL(x) fminf(1.0f, x)
+#include "ref/float_modes.inc"
+#undef REF_SPECTRUM_LEVEL
+} // namespace ref_capped
+
+#undef MIN_BRIGHTNESS
+
+// A fixed-point mode with its state from power-on, like the float statics
+template <auto Render>
+static void fixed(const poi_modes::input &in, uint8_t *p, size_t l) {
+    static typename poi_modes::thunk<Render>::state st;
+    Render(st, in, p, l);
+}
+
+struct pair {
+    const char *name;
+    void (*ref)(qmi8658_data_t *, uint8_t *, size_t);
+    void (*fixed)(const poi_modes::input &, uint8_t *, size_t);
+    double max_over; // % of frames allowed a channel off by more than 8: threshold edges in the mode
+};
+
+#define PAIR(n, over) {#n, ref::mode_##n, fixed<poi_modes::mode_##n>, over}
+static const pair pairs[] = {
+    PAIR(gravity_rainbow, 0),
+    PAIR(spin_fire, 0),
+    PAIR(centrifugal_rainbow, 0),
+    PAIR(flow_trail, 0),
+    PAIR(gravity_compass, 0),
+    PAIR(velocity_prism, 0),
+    PAIR(warp_speed, 0),
+    PAIR(plasma_ghost, 0),
+    PAIR(fire_ice_split, 0),
+    PAIR(shifting_horizon, 0),
+    PAIR(gravity_ball, 0.1),     // Which LED is lit
+    PAIR(compass_navigator, 0),
+    PAIR(audio_spectrum, 100),   // The float version wraps loud bins to dark; compared capped below
+    PAIR(audio_wave, 0),
+    PAIR(audio_bass_pulse, 0.1),
+    PAIR(audio_motion_fusion, 0.5), // The hue+90 wrap inside its blend
+    PAIR(audio_peak_color, 0),
+    PAIR(audio_rainbow_cycle, 0),
+    PAIR(audio_vu_meter, 0.1),   // The active LED count
+    PAIR(audio_beat_fade, 5),    // A beat seen by only one version shifts its boost and colour cycle
+    PAIR(audio_frequency_lava, 0),
+    {"audio_spectrum, capped", ref_capped::mode_audio_spectrum, fixed<poi_modes::mode_audio_spectrum>, 0},
+};
+#define PAIRS (int)(sizeof(pairs) / sizeof(pairs[0]))
+
+struct trace {
+    qmi8658_data_t imu;
+    float audio[N_SAMPLES];
+    float spec[N_SAMPLES / 2];
+};
+
+static float frand(uint32_t &st) {
+    st = st * 1103515245u + 12345u;
+    return ((st >> 8) & 0xFFFF) / 65535.0f;
+}
+
+static std::vector<trace> make_trace(int n, uint32_t seed) {
+    std::vector<trace> v(n);
+    float ax = 0, ay = 0, az = 1, gx = 0, gy = 0, gz = 0, loud = 0.02f;
+    for (trace &t : v) {
+        ax = fmaxf(-1.5f, fminf(1.5f, ax + (frand(seed) - 0.5f) * 0.2f));
+        ay = fmaxf(-1.5f, fminf(1.5f, ay + (frand(seed) - 0.5f) * 0.2f));
+        az = fmaxf(-1.5f, fminf(1.5f, az + (frand(seed) - 0.5f) * 0.2f));
+        gx = fmaxf(-900, fminf(900, gx + (frand(seed) - 0.5f) * 120));
+        gy = fmaxf(-900, fminf(900, gy + (frand(seed) - 0.5f) * 120));
+        gz = fmaxf(-1500, fminf(1500, gz + (frand(seed) - 0.5f) * 200));
+        loud = fmaxf(0, fminf(0.15f, loud + (frand(seed) - 0.5f) * 0.02f));
+        if (frand(seed) < 0.05f) loud = 0.12f; // A beat
+        t.imu = {ax, ay, az, gx, gy, gz};
+        for (float &a : t.audio) a = (frand(seed) * 2 - 1) * loud;
+        for (float &s : t.spec) s = -80 + frand(seed) * 75 + loud * 100;
+    }
+    return v;
+}
+
+// Both versions' inputs for frame k, as audio_fft_task and render_task publish them
+static void set_input(const trace &t, int k, poi_modes::input &in) {
+    memcpy(audio_buffer, t.audio, sizeof(audio_buffer));
+    memcpy(spectrum, t.spec, sizeof(spectrum));
+    float sum = 0;
+    for (float a : t.audio) sum += fabsf(a);
+    in.imu = t.imu;
+    in.audio_level = (int32_t)(sum * (32768.0f / N_SAMPLES) + 0.5f);
+    for (int i = 0; i < POI_MODE_BINS; i++) in.spectrum_q8[i] = POI_FX_FROM(t.spec[i], 8);
+    in.anim_step_q16 = (int32_t)(anim_step * 65536);
+    test_seed(k * 2654435761u);
+    in.random = esp_random();
+    in.lead_us = 0;
+    test_seed(k * 2654435761u); // The float version draws the same number
+}
+
+static void check_math() {
+    double sin_err = 0, atan_err = 0, exp_err = 0;
+    for (int a = 0; a < 65536; a++) {
+        sin_err = std::max(sin_err, fabs(poi_fx_sin((uint16_t)a) / 32768.0 - sin(a * 2 * M_PI / 65536)));
+    }
+    for (int y = -1000; y <= 1000; y += 7) {
+        for (int x = -1000; x <= 1000; x += 7) {
+            if (!x && !y) continue;
+            double d = fabs(poi_fx_atan2(y, x) * M_PI / 32768 - atan2(y, x));
+            atan_err = std::max(atan_err, std::min(d, 2 * M_PI - d)); // pi and -pi are one angle
+        }
+    }
+    for (int32_t x = 0; x < 8 << 16; x += 17) {
+        exp_err = std::max(exp_err, fabs(poi_fx_exp_neg(x) / 32768.0 - exp(-x / 65536.0)));
+    }
+    printf("worst error against libm: sin %.1e, atan2 %.1e rad, exp %.1e\n", sin_err, atan_err, exp_err);
+    CHECK(sin_err < 5e-5 && atan_err < 2e-4 && exp_err < 1.5e-4);
+
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    for (int k = 0; k < 1000000; k++) {
+        s ^= s << 13, s ^= s >> 7, s ^= s << 17;
+        uint64_t v = s >> (k % 64);
+        uint64_t r = poi_fx_sqrt(v);
+        CHECK(r * r <= v && (r + 1) * (r + 1) > v);
+    }
+    CHECK(poi_fx_sqrt(UINT64_MAX) == UINT32_MAX);
+    for (int c = 0; c < 256; c++) CHECK(((c * POI_FX_Q16(0.27)) >> 16) == (int)(uint8_t)(c * 0.27)); // GLOBAL_BRIGHTNESS
+    puts("isqrt exact, Q16 brightness exact for 0..255");
+}
+
+// Histogram of channel differences over every run of one pair
+struct diffs {
+    long hist[256];
+    long frames, frames_over;
+};
+
+static void compare(const pair &m, diffs *d) {
+    for (int run = 0; run < RUNS; run++) {
+        pid_t pid = fork();
+        CHECK(pid >= 0);
+        if (pid == 0) {
+            anim_step = run & 1 ? 0.8f : 1.0f; // 25 and 31.25 fps
+            std::vector<trace> tr = make_trace(FRAMES, 1000 + run);
+            poi_modes::input in;
+            for (int k = 0; k < FRAMES; k++) {
+                uint8_t a[NUM_LEDS * 3] = {}, b[NUM_LEDS * 3] = {};
+                set_input(tr[k], k, in);
+                m.ref(&tr[k].imu, a, sizeof(a));
+                m.fixed(in, b, sizeof(b));
+                int worst = 0;
+                for (int j = 0; j < NUM_LEDS * 3; j++) {
+                    int dj = abs(a[j] - b[j]);
+                    d->hist[dj]++;
+                    worst = std::max(worst, dj);
+                }
+                d->frames++;
+                if (worst > 8) d->frames_over++;
+            }
+            _exit(0);
+        }
+        int status;
+        CHECK(waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+}
+
+static void bench(const pair &m) {
+    std::vector<trace> tr = make_trace(TIMED, 3);
+    std::vector<poi_modes::input> in(TIMED);
+    for (int k = 0; k < TIMED; k++) set_input(tr[k], k, in[k]);
+    uint8_t buf[NUM_LEDS * 3];
+    double best[2] = {1e30, 1e30};
+    for (int rep = 0; rep < 5; rep++) {
+        for (int w = 0; w < 2; w++) {
+            auto t0 = std::chrono::steady_clock::now();
+            for (int k = 0; k < TIMED; k++) {
+                if (w) {
+                    m.fixed(in[k], buf, sizeof(buf));
+                } else {
+                    memcpy(audio_buffer, tr[k].audio, sizeof(audio_buffer));
+                    memcpy(spectrum, tr[k].spec, sizeof(spectrum));
+                    m.ref(&tr[k].imu, buf, sizeof(buf));
+                }
+                asm volatile("" ::"r"(buf) : "memory");
+            }
+            best[w] = std::min(best[w], std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / TIMED);
+        }
+    }
+    libm_calls = 0;
+    for (int k = 0; k < TIMED; k++) m.ref(&tr[k].imu, buf, sizeof(buf));
+    printf("%-24s %8.0f %8.0f %6.1fx %9.1f\n", m.name, best[0], best[1], best[0] / best[1], libm_calls / (double)TIMED);
+}
+
+int main() {
+    check_math();
+    poi_modes::init();
+
+    diffs *d = (diffs *)mmap(nullptr, sizeof(diffs), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    CHECK(d != MAP_FAILED);
+    printf("%-24s %5s %5s %6s %7s %9s\n", "mode", "max", "p99", "p99.9", "mean", "frames>8");
+    for (const pair &m : pairs) {
+        memset(d, 0, sizeof(*d));
+        compare(m, d);
+        long total = 0, acc = 0;
+        double sum = 0;
+        int max = 0, p99 = -1, p999 = -1;
+        for (int k = 0; k < 256; k++) {
+            total += d->hist[k];
+            sum += (double)k * d->hist[k];
+            if (d->hist[k]) max = k;
+        }
+        for (int k = 0; k < 256; k++) {
+            acc += d->hist[k];
+            if (p99 < 0 && acc * 100 >= total * 99) p99 = k;
+            if (p999 < 0 && acc * 1000 >= total * 999) p999 = k;
+        }
+        double over = 100.0 * d->frames_over / d->frames;
+        printf("%-24s %5d %5d %6d %7.3f %8.2f%%\n", m.name, max, p99, p999, sum / total, over);
+        CHECK(d->frames == RUNS * FRAMES && over <= m.max_over);
+        if (m.max_over < 1) CHECK(p999 <= 3); // A difference of 3 is one hue step
+    }
+    munmap(d, sizeof(diffs));
+
+    printf("\nhost ns per frame:        float    fixed  speedup  libm/frame\n");
+    for (int m = 0; m < PAIRS - 1; m++) bench(pairs[m]);
+    puts("fixed ok");
+    return 0;
+}
@@ -0,0 +1,177 @@
+// poi_frame_codec round trip and decoder fuzz. The round trip encodes a mix
+// of random, solid and single-pixel-change frames on a 21 LED strip through
+// an encoder/decoder pair and checks the poi ends up with every frame bit
+// exact; the fuzz feeds the decoder mutated and random payloads, which it
+// must reject or apply without reading or writing out of bounds (build with
+// POI_HOST_SANITIZE=ON to have that checked). Then every registered mode
+// over the mode bench traces (poi_mode_bench.h), 10 s each, through the
+// codec: one CSV record per mode and trace
+//   CODECBENCH,<mode index>,<mode name>,<trace>,<frames>,<mean bytes>,<ns per encode>
+// the bytes being the [type][body] the link carries, of LEN raw.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "poi_frame_codec.h"
+#include "poi_mode_bench.h"
+#include "host_test.h"
+
+#define LEDS      21
+#define LEN       (LEDS * 3)
+#define FRAMES    200000
+#define FUZZ_RUNS 1000000
+#define MODE_FRAMES (10 * POI_MODE_BENCH_FPS)
+#define ENCODE_RUNS 20 // Passes over each recording the timing averages
+
+// Next frame in the mix from the previous one
+static void make_frame(uint8_t *rgb, const uint8_t *prev) {
+    switch (test_rand() % 3) {
+        case 0:
+            for (int k = 0; k < LEN; k++) rgb[k] = (uint8_t)test_rand();
+            break;
+        case 1: {
+            uint32_t c = test_rand();
+            for (int i = 0; i < LEDS; i++) {
+                rgb[i * 3] = (uint8_t)c;
+                rgb[i * 3 + 1] = (uint8_t)(c >> 8);
+                rgb[i * 3 + 2] = (uint8_t)(c >> 16);
+            }
+            break;
+        }
+        default: {
+            memcpy(rgb, prev, LEN);
+            int i = test_rand() % LEDS;
+            rgb[i * 3] ^= (uint8_t)(test_rand() | 1);
+            break;
+        }
+    }
+}
+
+// Returns the average coded size, type byte included
+static double round_trip(bool packed4) {
+    poi_frame_codec_t enc = {}, dec = {};
+    enc.packed4 = dec.packed4 = packed4;
+    uint8_t prev[LEN] = {}, rgb[LEN], shown[LEN], out[LEN + 1];
+    for (int f = 0; f < FRAMES; f++) {
+        make_frame(rgb, prev);
+        if (packed4 && f % 4 == 0) poi_codec_reduce_depth(rgb, LEN, rgb); // Packs losslessly once reduced
+        size_t n = poi_codec_encode(&enc, rgb, LEN, out, sizeof(out));
+        CHECK(n >= 1 && n <= LEN + 1);
+        CHECK(poi_codec_decode(&dec, out, n, shown, LEN) == 0);
+        CHECK(memcmp(shown, rgb, LEN) == 0);
+        if (f % 97 == 96) {
+            poi_codec_reset(&enc); // A write error: the next frame must be a keyframe
+        } else {
+            poi_codec_commit(&enc, rgb, LEN, out[0], n);
+        }
+        memcpy(prev, rgb, LEN);
+    }
+    return (double)enc.coded_bytes / (enc.raw_bytes / LEN);
+}
+
+static void fuzz() {
+    poi_frame_codec_t enc = {}, dec = {};
+    dec.packed4 = true;
+    uint8_t prev[LEN] = {}, rgb[LEN], shown[POI_CODEC_MAX_BYTES];
+    uint8_t out[2 * LEN + 8] = {};
+    int accepted = 0;
+    for (int r = 0; r < FUZZ_RUNS; r++) {
+        size_t n;
+        if (r & 1) { // Random type and body
+            n = 1 + test_rand() % (sizeof(out) - 1);
+            for (size_t k = 0; k < n; k++) out[k] = (uint8_t)test_rand();
+            out[0] %= 5;
+        } else { // A valid frame with a few bytes flipped, cut short or extended
+            make_frame(rgb, prev);
+            memcpy(prev, rgb, LEN);
+            n = poi_codec_encode(&enc, rgb, LEN, out, sizeof(out));
+            poi_codec_commit(&enc, rgb, LEN, out[0], n);
+            for (uint32_t m = test_rand() % 4; m; m--) out[test_rand() % n] ^= (uint8_t)(1 << (test_rand() % 8));
+            if (test_rand() % 4 == 0) n = 1 + test_rand() % (sizeof(out) - 1);
+        }
+        size_t len = test_rand() % 8 ? LEN : 3 * (test_rand() % (POI_CODEC_MAX_PIXELS + 1));
+        if (poi_codec_decode(&dec, out, n, shown, len) == 0) accepted++;
+        if (test_rand() % 64 == 0) poi_codec_reset(&dec);
+    }
+    printf("fuzz: %d runs, %d accepted\n", FUZZ_RUNS, accepted);
+}
+
+// The UI label of mode on one line
+static void mode_name(int mode, char *name, size_t size) {
+    size_t n = 0;
+    for (const char *c = poi_modes::registry[mode].name; *c && n < size - 1; c++) {
+        char ch = *c == '\n' ? ' ' : *c;
+        if (ch != ' ' || (n && name[n - 1] != ' ')) name[n++] = ch;
+    }
+    name[n] = '\0';
+}
+
+// Records mode over trace, then encodes the recording as stream_task would; returns the mean coded size
+static double mode_run(int mode, int trace, double *ns) {
+    static poi_modes::arena<poi_modes::registry, 1> arena;
+    static poi_modes::instance<poi_modes::registry> inst;
+    static void *block = arena.alloc();
+    static uint8_t rec[MODE_FRAMES][LEN];
+    inst.bind(block);
+    inst.start(mode);
+    poi_modes::input in = {};
+    uint32_t rng = POI_MODE_BENCH_SEED;
+    for (int f = 0; f < MODE_FRAMES; f++) {
+        poi_mode_bench_input(trace, f, &in, &rng);
+        inst.render(in, rec[f], LEN);
+    }
+
+    poi_frame_codec_t enc = {}, dec = {};
+    uint8_t out[LEN + 1], shown[LEN];
+    for (int f = 0; f < MODE_FRAMES; f++) { // The poi shows every frame bit exact
+        size_t n = poi_codec_encode(&enc, rec[f], LEN, out, sizeof(out));
+        CHECK(poi_codec_decode(&dec, out, n, shown, LEN) == 0 && memcmp(shown, rec[f], LEN) == 0);
+        poi_codec_commit(&enc, rec[f], LEN, out[0], n);
+    }
+    double bytes = (double)enc.coded_bytes / MODE_FRAMES;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < ENCODE_RUNS; r++) {
+        poi_codec_reset(&enc);
+        for (int f = 0; f < MODE_FRAMES; f++) {
+            size_t n = poi_codec_encode(&enc, rec[f], LEN, out, sizeof(out));
+            poi_codec_commit(&enc, rec[f], LEN, out[0], n);
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    *ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / (ENCODE_RUNS * MODE_FRAMES);
+    return bytes;
+}
+
+static void modes() {
+    printf("CODECBENCH,mode,name,trace,frames,bytes_mean,ns_encode\n");
+    double all = 0;
+    for (int m = 0; m < poi_modes::COUNT; m++) {
+        char name[32];
+        mode_name(m, name, sizeof(name));
+        for (int t = 0; t < POI_MODE_BENCH_TRACES; t++) {
+            double ns, bytes = mode_run(m, t, &ns);
+            printf("CODECBENCH,%d,%s,%s,%d,%.1f,%.0f\n", m, name, poi_mode_bench_trace_name(t), MODE_FRAMES, bytes, ns);
+            CHECK(bytes <= LEN + 1);
+            all += bytes;
+        }
+    }
+    all /= poi_modes::COUNT * POI_MODE_BENCH_TRACES;
+    printf("modes: %.1f of %d bytes on average\n", all, LEN);
+    CHECK(all < LEN);
+}
+
+int main() {
+    test_seed(0x2545F491);
+    double avg = round_trip(false);
+    printf("round trip: %d frames, %.1f of %d bytes on average\n", FRAMES, avg, LEN);
+    CHECK(avg < LEN / 2);
+    avg = round_trip(true);
+    printf("round trip, packed4: %d frames, %.1f of %d bytes on average\n", FRAMES, avg, LEN);
+    fuzz();
+    poi_modes::init();
+    modes();
+    puts("frame_codec ok");
+    return 0;
+}
@@ -0,0 +1,146 @@
+// poi_imu_predict on swing traces sampled at 25 fps: a poi on a 0.5 m arm
+// turning in the x-y plane, its IMU seeing gravity, the centripetal pull
+// along the arm (y) and noise. Mean |error| of the gravity angle the modes
+// read (atan2 of the accel) and of gyroZ, raw and predicted, against the
+// sensor as it reads when the frame is shown. Then the history restart,
+// the horizon cap and the clipped accel.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+#include "poi_imu_predict.h"
+#include "host_test.h"
+
+#define ARM_M  0.5
+#define FPS    25
+#define RUN_S  60
+#define WARMUP 10
+
+// Arm angle from hanging straight down at t, rad
+typedef double (*motion_fn)(double t);
+
+static double swing(double t, double hz, double amp) {
+    return amp * sin(2 * M_PI * hz * t);
+}
+
+static double slow(double t) { // 0.8 Hz, 60 degrees either side
+    return swing(t, 0.8, M_PI / 3);
+}
+
+static double wide(double t) { // 1.1 Hz, 120 degrees either side
+    return swing(t, 1.1, 2 * M_PI / 3);
+}
+
+// Pace and amplitude drifting like a person swinging: 0.7-1.2 Hz, 40-150 degrees
+static double drift(double t) {
+    double amp = (95 + 55 * sin(2 * M_PI * t / 11)) * M_PI / 180;
+    return amp * sin(2 * M_PI * (0.95 * t - 0.25 * 7 / (2 * M_PI) * cos(2 * M_PI * t / 7)));
+}
+
+// A swing that goes over the top into three turns a second and back, every 10 s
+static double over_top(double t) {
+    double spin = 0.5 - 0.5 * cos(2 * M_PI * t / 10);
+    double turns = 3 * (0.5 * t - 0.5 * 10 / (2 * M_PI) * sin(2 * M_PI * t / 10));
+    return (1 - spin) * M_PI / 2 * sin(2 * M_PI * t) + 2 * M_PI * turns;
+}
+
+static double gauss() { // Irwin-Hall, near enough
+    double u = 0;
+    for (int i = 0; i < 12; i++) u += test_uniform();
+    return u - 6;
+}
+
+static double noise(double sd) {
+    return sd ? sd * gauss() : 0;
+}
+
+// The IMU at t: accel in g, gyro in dps
+static qmi8658_data_t sense(motion_fn f, double t, double accel_noise, double gyro_noise) {
+    double a = f(t), w = (f(t + 1e-5) - f(t - 1e-5)) / 2e-5;
+    qmi8658_data_t s = {};
+    s.accelX = (float)(sin(a) + noise(accel_noise));
+    s.accelY = (float)fmin(cos(a) + w * w * ARM_M / 9.81 + noise(accel_noise), 8); // The IMU's range
+    s.gyroZ = (float)(w * 180 / M_PI + noise(gyro_noise));
+    return s;
+}
+
+static double angle_err(const qmi8658_data_t &s, const qmi8658_data_t &truth) {
+    double d = atan2(s.accelY, s.accelX) - atan2(truth.accelY, truth.accelX);
+    return fabs(remainder(d, 2 * M_PI)) * 180 / M_PI;
+}
+
+struct errors {
+    double angle_raw, angle_pred, gyro_raw, gyro_pred; // Means: degrees, dps
+};
+
+static errors run(motion_fn f, int lead_ms, double accel_noise, double gyro_noise) {
+    poi_imu_predict_t p;
+    poi_imu_predict_reset(&p);
+    test_seed(12345);
+    errors e = {};
+    int n = 0;
+    for (int k = 0; k < RUN_S * FPS; k++) {
+        double t = k / (double)FPS + 0.0007 * gauss(); // Sample jitter from the render cadence
+        qmi8658_data_t s = sense(f, t, accel_noise, gyro_noise), pred;
+        poi_imu_predict_add(&p, llround(t * 1e6), &s);
+        CHECK(poi_imu_predict(&p, lead_ms * 1000, &pred) == (k ? lead_ms * 1000 : 0));
+        qmi8658_data_t truth = sense(f, t + lead_ms / 1000.0, 0, 0);
+        if (k < WARMUP) continue;
+        e.angle_raw += angle_err(s, truth);
+        e.angle_pred += angle_err(pred, truth);
+        e.gyro_raw += fabs(s.gyroZ - truth.gyroZ);
+        e.gyro_pred += fabs(pred.gyroZ - truth.gyroZ);
+        n++;
+    }
+    return {e.angle_raw / n, e.angle_pred / n, e.gyro_raw / n, e.gyro_pred / n};
+}
+
+static void edges() {
+    poi_imu_predict_t p;
+    poi_imu_predict_reset(&p);
+    qmi8658_data_t s = {0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 300.0f}, out;
+    CHECK(poi_imu_predict(&p, 50000, &out) == 0 && out.gyroZ == 0); // Nothing yet
+    poi_imu_predict_add(&p, 0, &s);
+    CHECK(poi_imu_predict(&p, 50000, &out) == 0 && out.accelY == 1.0f); // One sample: as it is
+    poi_imu_predict_add(&p, 40000, &s);
+    CHECK(poi_imu_predict(&p, 1000000, &out) == POI_IMU_PREDICT_MAX_US);
+    poi_imu_predict_add(&p, 40000 + POI_IMU_PREDICT_GAP_US + 1, &s); // The mode stopped reading the IMU
+    CHECK(p.count == 1 && poi_imu_predict(&p, 50000, &out) == 0);
+
+    qmi8658_data_t clip = {0.25f, 8.0f, 0.125f, 0.0f, 0.0f, 1440.0f}; // Spinning hard: the accel sits at the rail
+    poi_imu_predict_reset(&p);
+    for (int k = 0; k < 3; k++) poi_imu_predict_add(&p, k * 40000, &clip);
+    CHECK(poi_imu_predict(&p, 80000, &out) == 80000);
+    CHECK(out.accelX == clip.accelX && out.accelY == clip.accelY && out.accelZ == clip.accelZ && out.gyroZ == clip.gyroZ);
+    puts("edges ok: restart after a gap, horizon cap, clipped accel carried");
+}
+
+int main() {
+    struct {
+        const char *name;
+        motion_fn f;
+    } traces[] = {{"slow", slow}, {"wide", wide}, {"drift", drift}, {"over_top", over_top}};
+    const int leads[] = {40, 80, 120, 160};
+    printf("mean |angle error|, degrees, raw -> predicted (gyro noise 2 dps, accel 0.02 g)\n");
+    printf("lead      ");
+    for (int lead : leads) printf("     %3d ms  ", lead);
+    printf("   gyroZ at 120 ms, dps\n");
+    for (const auto &tr : traces) {
+        printf("%-9s", tr.name);
+        errors at120 = {};
+        for (int lead : leads) {
+            errors e = run(tr.f, lead, 0.02, 2);
+            printf(" %5.1f -> %4.1f", e.angle_raw, e.angle_pred);
+            CHECK(e.angle_pred < e.angle_raw * 0.75);
+            if (lead == 120) at120 = e;
+        }
+        printf("   %3.0f -> %3.0f\n", at120.gyro_raw, at120.gyro_pred);
+        CHECK(at120.gyro_pred < at120.gyro_raw);
+    }
+    errors noisy = run(slow, 120, 0.1, 15);
+    printf("slow at 120 ms, gyro noise 15 dps, accel 0.1 g: %.1f -> %.1f\n", noisy.angle_raw, noisy.angle_pred);
+    CHECK(noisy.angle_pred < noisy.angle_raw / 3);
+    edges();
+    puts("imu_predict ok");
+    return 0;
+}
@@ -0,0 +1,97 @@
+// poi_link_profile against scripted controllers: each script fixes what the
+// NimBLE calls return and which events come back, and the negotiation must
+// finish with the profile the link actually has. Time only moves when an
+// event arrives or, with nothing to do, to the pending request's deadline,
+// as link_timeout does on the host task. Then the capacity model at the
+// profiles the render rate is set from.
+
+#include <stdint.h>
+#include <stdio.h>
+#include "poi_link_profile.h"
+#include "host_test.h"
+
+struct script {
+    const char *name;
+    int phy_rc, phy_status, phy_result; // ble_gap_set_prefered_le_phy(), then its event
+    int dle_rc;
+    bool dle_event;
+    bool conn_answer[2]; // Per interval tier, fastest first
+    int conn_status[2];
+    // Profile it must end with
+    uint8_t tx_phy;
+    uint16_t tx_octets, conn_itvl;
+};
+
+static const script scripts[] = {
+    {"full success", 0, 0, 2, 0, true, {true, true}, {0, 0}, 2, 251, 9},
+    {"no 2M, no DLE answer, 7.5 ms rejected", 0, 0, 1, 0, false, {true, true}, {0x1E, 0}, 1, 27, 24},
+    {"PHY call fails", 5, 0, 2, 0, true, {true, true}, {0, 0}, 1, 251, 9},
+    {"2M, then no DLE or interval answers", 0, 0, 2, 0, false, {false, false}, {0, 0}, 2, 27, 24},
+    {"PHY rejected, DLE call fails, 7.5 ms unanswered", 0, 0x1A, 2, 7, true, {false, true}, {0, 0}, 1, 27, 24},
+};
+
+static void run(const script &s) {
+    poi_link_profile_t p;
+    poi_link_profile_init(&p, 24);
+    int64_t t = 0;
+    poi_link_req_t r;
+    for (int guard = 0; !poi_link_profile_done(&p); guard++) {
+        CHECK(guard < 100);
+        if (!poi_link_profile_next(&p, t, &r)) {
+            // Nothing to issue: waiting on an event, or the last step just timed out
+            CHECK(p.pending || poi_link_profile_done(&p));
+            if (p.pending) t = p.deadline_us;
+            continue;
+        }
+        switch (r.step) {
+            case POI_LINK_STEP_PHY:
+                poi_link_profile_issued(&p, s.phy_rc, t);
+                if (s.phy_rc == 0) {
+                    t += 50000;
+                    poi_link_profile_on_phy(&p, s.phy_status, (uint8_t)s.phy_result);
+                }
+                break;
+            case POI_LINK_STEP_DATA_LEN:
+                poi_link_profile_issued(&p, s.dle_rc, t);
+                if (s.dle_rc == 0 && s.dle_event) {
+                    t += 30000;
+                    poi_link_profile_on_data_len(&p, POI_LINK_TX_OCTETS_MAX);
+                }
+                break;
+            default: {
+                CHECK(r.step == POI_LINK_STEP_CONN_PARAMS && r.itvl_min <= r.itvl_max);
+                int tier = r.itvl_min == 6 ? 0 : 1;
+                poi_link_profile_issued(&p, 0, t);
+                if (s.conn_answer[tier]) {
+                    t += 100000;
+                    poi_link_profile_on_conn_update(&p, s.conn_status[tier], s.conn_status[tier] ? 0 : r.itvl_max);
+                }
+                break;
+            }
+        }
+    }
+    printf("%-48s %dM %3u octets, %4.2f ms after %.2f s\n", s.name, p.tx_phy, p.tx_octets, p.conn_itvl * 1.25,
+           t / 1e6);
+    CHECK(p.tx_phy == s.tx_phy && p.tx_octets == s.tx_octets && p.conn_itvl == s.conn_itvl);
+    CHECK(!p.pending);
+}
+
+int main() {
+    for (const script &s : scripts) run(s);
+
+    poi_link_profile_t q;
+    poi_link_profile_init(&q, 6);
+    q.tx_phy = POI_LINK_PHY_2M;
+    q.tx_octets = POI_LINK_TX_OCTETS_MAX;
+    uint32_t fast = poi_link_profile_capacity(&q, 244, 2);
+    poi_link_profile_init(&q, 24);
+    uint32_t slow = poi_link_profile_capacity(&q, 244, 2);
+    uint32_t slow_mtu23 = poi_link_profile_capacity(&q, 20, 2);
+    printf("capacity, 2 links: 2M/251/7.5 ms %u B/s, 1M/27/30 ms %u B/s (%u B/s with 20 byte writes)\n", fast, slow,
+           slow_mtu23);
+    CHECK(fast > 60000 && fast < 70000);
+    CHECK(slow > 15000 && slow < 20000);
+    CHECK(slow_mtu23 < slow); // Per-write overhead dominates small writes
+    puts("link_profile ok");
+    return 0;
+}
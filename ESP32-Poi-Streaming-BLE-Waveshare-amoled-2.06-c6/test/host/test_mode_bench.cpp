@@ -0,0 +1,14 @@
+// The mode bench (poi_mode_bench.h) on the host: every registered mode and
+// the compositor over the bench traces, as the MODEBENCH and COMPOSEBENCH
+// CSV records the firmware prints, in nanoseconds per frame.
+
+#include <stdio.h>
+#include "poi_modes.h"
+#include "poi_mode_bench.h"
+
+int main() {
+    poi_modes::init();
+    poi_mode_bench_run();
+    puts("mode_bench ok");
+    return 0;
+}
@@ -0,0 +1,18 @@
+// The golden check (poi_mode_bench.h) on the host: every registered mode
+// over 40 s of each bench trace against poi_mode_golden.cpp. Fails on any
+// pair that differs, near or not; the MODEGOLDEN_ROW lines it prints are
+// the replacement rows when a look changes on purpose.
+
+#include <stdio.h>
+#include "poi_modes.h"
+#include "poi_mode_bench.h"
+#include "host_test.h"
+
+int main() {
+    poi_modes::init();
+    int differ = poi_mode_golden_check();
+    printf("%d of %d pairs differ\n", differ, poi_modes::COUNT * POI_MODE_BENCH_TRACES);
+    CHECK(differ == 0);
+    puts("mode_golden ok");
+    return 0;
+}
@@ -0,0 +1,156 @@
+// poi_palette's strip kernels against a pixel-at-a-time reference: map,
+// blend and shade, with and without levels, at every length up to 64 LEDs
+// and every output alignment, guard bytes either side. The rainbow palette
+// must reproduce the hue branches the modes used before it exactly. Then
+// host timings per 21 LED strip, as POI_PALETTE_BENCH prints in cycles on
+// the watch.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "poi_palette.h"
+#include "poi_fixed.h"
+#include "host_test.h"
+
+#define MAX_LEDS   64
+#define GUARD      0xA5
+#define STRIP_LEDS 21 // NUM_LEDS
+#define BENCH_RUNS 200000
+
+static poi_palette_t rainbow, fire;
+
+// The per-pixel path before the palettes: hue branches, then a scale per channel
+static void hsv(const uint8_t *hue, const uint16_t *level, uint8_t *p, int n) {
+    for (int i = 0; i < n; i++, p += 3) {
+        uint16_t h = hue[i] * 3;
+        uint8_t r, g, b;
+        if (h < 255) { r = 255 - h; g = h; b = 0; }
+        else if (h < 510) { h -= 255; r = 0; g = 255 - h; b = h; }
+        else { h -= 510; r = h; g = 0; b = 255 - h; }
+        p[0] = poi_fx_scale8(r, level[i]);
+        p[1] = poi_fx_scale8(g, level[i]);
+        p[2] = poi_fx_scale8(b, level[i]);
+    }
+}
+
+static uint8_t chan(uint32_t c, int k) {
+    return (uint8_t)(c >> (8 * k));
+}
+
+// Runs kernel k into a guarded buffer at offset and checks it against the reference
+static void check(int k, const uint8_t *a, const uint8_t *b, const uint16_t *t, const uint16_t *level, int n, int offset) {
+    uint8_t buf[MAX_LEDS * 3 + 8], want[MAX_LEDS * 3];
+    memset(buf, GUARD, sizeof(buf));
+    uint8_t *out = buf + offset;
+    for (int i = 0; i < n; i++) {
+        for (int c = 0; c < 3; c++) {
+            uint8_t v;
+            switch (k) {
+                case 0: v = chan(poi_palette_lookup(&rainbow, a[i]), c); break;
+                case 1: v = chan(poi_palette_lerp(poi_palette_lookup(&fire, a[i]), poi_palette_lookup(&fire, b[i]), t[i]), c); break;
+                case 2: v = poi_fx_lerp8(chan(fire.rgb[a[i]], c), chan(fire.rgb[b[i]], c), t[i]); break;
+                default: v = chan(fire.rgb[a[0]], c); break;
+            }
+            want[i * 3 + c] = level ? poi_fx_scale8(v, level[i]) : v;
+        }
+    }
+    switch (k) {
+        case 0: poi_palette_map(&rainbow, a, level, out, n); break;
+        case 1:
+        case 2: poi_palette_blend(&fire, a, b, t, level, out, n); break;
+        default: poi_palette_shade(fire.rgb[a[0]], level, out, n); break;
+    }
+    CHECK(memcmp(out, want, n * 3) == 0);
+    for (int j = 0; j < offset; j++) CHECK(buf[j] == GUARD);
+    for (size_t j = offset + n * 3; j < sizeof(buf); j++) CHECK(buf[j] == GUARD);
+}
+
+static void kernels() {
+    uint8_t a[MAX_LEDS], b[MAX_LEDS];
+    uint16_t t[MAX_LEDS], level[MAX_LEDS];
+    int strips = 0;
+    for (int r = 0; r < 50; r++) {
+        for (int i = 0; i < MAX_LEDS; i++) {
+            a[i] = (uint8_t)test_rand();
+            b[i] = (uint8_t)test_rand();
+            t[i] = r == 0 ? (i & 1) * POI_FX_ONE : test_rand() % (POI_FX_ONE + 1); // The ends first
+            level[i] = r == 0 ? (i & 1) * POI_FX_ONE : test_rand() % (POI_FX_ONE + 1);
+        }
+        for (int n = 0; n <= MAX_LEDS; n++) {
+            for (int offset = 0; offset < 4; offset++) {
+                for (int k = 0; k < 4; k++) {
+                    if (k != 3) check(k, a, b, t, NULL, n, offset);
+                    check(k, a, b, t, level, n, offset);
+                    strips += k != 3 ? 2 : 1;
+                }
+            }
+        }
+    }
+
+    uint8_t hue[256], want[256 * 3], got[256 * 3];
+    uint16_t full[256];
+    for (int h = 0; h < 256; h++) {
+        hue[h] = (uint8_t)h;
+        full[h] = POI_FX_ONE;
+    }
+    hsv(hue, full, want, 256);
+    poi_palette_map(&rainbow, hue, NULL, got, 256);
+    CHECK(memcmp(got, want, sizeof(want)) == 0);
+    for (int r = 0; r < 1000; r++) {
+        for (int i = 0; i < 256; i++) full[i] = test_rand() % (POI_FX_ONE + 1);
+        hsv(hue, full, want, 256);
+        poi_palette_map(&rainbow, hue, full, got, 256);
+        CHECK(memcmp(got, want, sizeof(want)) == 0);
+    }
+    printf("%d strips (every kernel, with and without levels, 0..%d LEDs, output offsets 0-3) match the reference; the rainbow matches the hue branches\n",
+           strips, MAX_LEDS);
+}
+
+template <typename F>
+static double ns_per_strip(F &&f) {
+    double best = 1e9;
+    for (int rep = 0; rep < 5; rep++) {
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < BENCH_RUNS; r++) f();
+        auto t1 = std::chrono::steady_clock::now();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / BENCH_RUNS;
+        if (ns < best) best = ns;
+    }
+    return best;
+}
+
+static void bench() {
+    uint8_t a[STRIP_LEDS], b[STRIP_LEDS];
+    uint16_t t[STRIP_LEDS], level[STRIP_LEDS];
+    alignas(4) static uint8_t out[STRIP_LEDS * 3 + 4];
+    for (int i = 0; i < STRIP_LEDS; i++) {
+        a[i] = (uint8_t)test_rand();
+        b[i] = (uint8_t)test_rand();
+        t[i] = test_rand() % (POI_FX_ONE + 1);
+        level[i] = test_rand() % (POI_FX_ONE + 1);
+    }
+    printf("ns per %d LED strip    hsv   map+level   map   blend+level   shade\n", STRIP_LEDS);
+    for (int offset = 0; offset < 2; offset++) {
+        uint8_t *p = out + offset;
+        // The compiler must not drop a strip nobody reads
+        auto keep = [&] { __asm__ volatile("" : : "r"(p) : "memory"); };
+        double h = ns_per_strip([&] { hsv(a, level, p, STRIP_LEDS); keep(); });
+        double ml = ns_per_strip([&] { poi_palette_map(&rainbow, a, level, p, STRIP_LEDS); keep(); });
+        double m = ns_per_strip([&] { poi_palette_map(&rainbow, a, NULL, p, STRIP_LEDS); keep(); });
+        double bl = ns_per_strip([&] { poi_palette_blend(&fire, a, b, t, level, p, STRIP_LEDS); keep(); });
+        double s = ns_per_strip([&] { poi_palette_shade(fire.rgb[a[0]], level, p, STRIP_LEDS); keep(); });
+        printf("output %s     %6.1f %11.1f %5.1f %13.1f %7.1f\n", offset ? "+1 byte" : "aligned", h, ml, m, bl, s);
+    }
+}
+
+int main() {
+    static const poi_palette_stop_t stops[] = {{0, 0, 0, 0}, {96, 255, 32, 0}, {200, 255, 200, 40}, {255, 255, 255, 255}};
+    poi_palette_rainbow(&rainbow);
+    poi_palette_gradient(&fire, stops, 4);
+    test_seed(0x51ED2701);
+    kernels();
+    bench();
+    puts("palette ok");
+    return 0;
+}
@@ -0,0 +1,162 @@
+// The POV heart through the mode registry, on a simulated spin: a poi on a
+// 0.5 m arm from a hand circling 0.1 m in step with it, spun up from
+// hanging still to 1, 2 or 4 turns a second with 10% wobble on the pace,
+// its IMU seeing the full accel (clipped at 8 g) and gyro with noise.
+// Rendered at 25, 50 and 100 fps, shown PLAYOUT_LATENCY_MS after the IMU
+// state plus a latency error the mode isn't told about. The column error is
+// the angle between the image column the frame shows and where the arm
+// really is in the middle of the interval it is shown for. Every frame is
+// checked to be the strip of the column the mode's state says it picked.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include "poi_modes.h"
+#include "host_test.h"
+
+#define ARM_M       0.5
+#define WRIST_M     0.1
+#define G           9.81
+#define LEAD_US     120000 // PLAYOUT_LATENCY_MS
+#define FRAME_US    40000  // The frame interval at anim_step_q16 = 1 << 16
+#define COLUMNS     128    // POV_COLUMNS, 1 << 25 of a binary angle each
+#define RAMP_S      4.0    // From hanging still to full pace
+#define SETTLE_S    6.0    // Then this long before the error is measured
+#define RUN_S       30.0
+#define WOBBLE      0.1
+#define WOBBLE_S    1.3
+#define ACCEL_NOISE 0.02 // g rms
+#define GYRO_NOISE  2.0  // dps rms
+
+static double gauss() { // Irwin-Hall, near enough
+    double u = 0;
+    for (int i = 0; i < 12; i++) u += test_uniform();
+    return u - 6;
+}
+
+// Arm angle from hanging straight down at t, rad: a steady push up to tps
+// turns a second over RAMP_S, then that pace give or take WOBBLE
+static double arm(double tps, double t) {
+    if (t < RAMP_S) return 2 * M_PI * tps * t * t / (2 * RAMP_S);
+    double w = 2 * M_PI / WOBBLE_S, s = t - RAMP_S;
+    return 2 * M_PI * tps * (s + RAMP_S / 2 + WOBBLE * (1 - cos(w * s)) / w);
+}
+
+// Where the poi is at t, m: the hand on its circle, the arm off it
+static void head(double tps, double t, double *x, double *y) {
+    double a = arm(tps, t);
+    *x = (WRIST_M + ARM_M) * sin(a);
+    *y = -(WRIST_M + ARM_M) * cos(a);
+}
+
+// The IMU at t: accel in g with y along the arm towards the hand and x
+// across it, gyro in dps
+static qmi8658_data_t sense(double tps, double t) {
+    const double h = 1e-4;
+    double x0, y0, x1, y1, x2, y2;
+    head(tps, t - h, &x0, &y0);
+    head(tps, t, &x1, &y1);
+    head(tps, t + h, &x2, &y2);
+    double fx = (x2 - 2 * x1 + x0) / (h * h), fy = (y2 - 2 * y1 + y0) / (h * h) + G; // Specific force
+    double a = arm(tps, t), w = (arm(tps, t + h) - arm(tps, t - h)) / (2 * h);
+    qmi8658_data_t s = {};
+    s.accelX = (float)fmax(-8, fmin(8, (fx * cos(a) + fy * sin(a)) / G + ACCEL_NOISE * gauss()));
+    s.accelY = (float)fmax(-8, fmin(8, (-fx * sin(a) + fy * cos(a)) / G + ACCEL_NOISE * gauss()));
+    s.gyroZ = (float)(w * 180 / M_PI + GYRO_NOISE * gauss());
+    return s;
+}
+
+static poi_modes::arena<poi_modes::registry, 1> arena;
+static void *block = arena.alloc();
+static uint8_t columns[COLUMNS][POI_MODE_LEDS * 3]; // The strip each column shows
+
+static int pov_mode() {
+    for (int m = 0; m < poi_modes::COUNT; m++) {
+        if (poi_modes::registry[m].render == poi_modes::thunk<poi_modes::mode_pov_image>::render) return m;
+    }
+    return -1;
+}
+
+// Held still at the middle of each column for a frame as long as the pull
+// towards gravity, the mode starts from the angle of gravity exactly
+static void probe_columns() {
+    poi_modes::instance<poi_modes::registry> mode;
+    mode.bind(block);
+    poi_modes::input in = {};
+    in.anim_step_q16 = 8 << 16;
+    for (int c = 0; c < COLUMNS; c++) {
+        double a = (c + 0.5) * 2 * M_PI / COLUMNS;
+        in.imu.accelX = (float)sin(a);
+        in.imu.accelY = (float)cos(a);
+        mode.start(pov_mode());
+        mode.render(in, columns[c], sizeof(columns[c]));
+        CHECK(static_cast<const poi_modes::pov_image_state *>(block)->shown >> 25 == (uint32_t)c);
+    }
+}
+
+// Mean column error, degrees, at tps turns a second rendered at fps and shown error_ms late
+static double run(double tps, int fps, int error_ms) {
+    poi_modes::instance<poi_modes::registry> mode;
+    mode.bind(block);
+    mode.start(pov_mode());
+    const auto &st = *static_cast<const poi_modes::pov_image_state *>(block);
+
+    test_seed(0x7F4A7C15);
+    poi_modes::input in = {};
+    in.anim_step_q16 = (1 << 16) * 25 / fps;
+    in.lead_us = LEAD_US;
+    int32_t frame_us = (int32_t)(((int64_t)in.anim_step_q16 * FRAME_US) >> 16);
+    uint8_t rgb[POI_MODE_LEDS * 3];
+    double sum = 0;
+    int n = 0;
+    for (int f = 0; f < RUN_S * fps; f++) {
+        double t = (double)f / fps;
+        in.imu = sense(tps, t);
+        in.random = test_rand();
+        mode.render(in, rgb, sizeof(rgb));
+        if (t < RAMP_S + SETTLE_S) continue;
+
+        int c = st.shown >> 25;
+        CHECK(memcmp(rgb, columns[c], sizeof(rgb)) == 0);
+        double column = c * 360.0 / COLUMNS;
+        double truth = arm(tps, t + (LEAD_US + frame_us / 2) * 1e-6 + error_ms * 1e-3) * 180 / M_PI;
+        sum += fabs(remainder(truth - column, 360));
+        n++;
+    }
+    return sum / n;
+}
+
+int main() {
+    poi_modes::init();
+    CHECK(pov_mode() >= 0);
+    probe_columns();
+
+    static const double tps[] = {1, 2, 4};
+    static const int fps[] = {25, 50, 100};
+    static const int error_ms[] = {-40, -20, 0, 20, 40};
+    printf("mean column error, degrees, by latency error (ms)\n");
+    printf("turns/s  fps");
+    for (int e : error_ms) printf(" %7d", e);
+    printf("\n");
+    double worst_exact = 0;
+    for (double r : tps) {
+        for (int rate : fps) {
+            double exact = run(r, rate, 0);
+            printf("%7.0f %4d", r, rate);
+            for (int e : error_ms) {
+                double err = e ? run(r, rate, e) : exact;
+                printf(" %7.1f", err);
+                // Off by the latency error, the column is off by the turn the arm makes in it, give or take the error at the right latency
+                double slip = fabs(e) * 1e-3 * r * 360;
+                CHECK(fabs(err - slip) < exact + 1);
+            }
+            printf("\n");
+            if (exact > worst_exact) worst_exact = exact;
+        }
+    }
+    printf("worst mean column error at the right latency: %.1f degrees (one column is %.1f)\n", worst_exact, 360.0 / COLUMNS);
+    CHECK(worst_exact < 4);
+    puts("pov ok");
+    return 0;
+}
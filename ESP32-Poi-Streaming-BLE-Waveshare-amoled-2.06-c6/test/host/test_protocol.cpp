@@ -0,0 +1,188 @@
+// poi_protocol.h on the host: encode/decode round trips (also at compile
+// time), notify_decoder reassembling replies whatever way they are split or
+// merged, and a fuzz over the seed corpus in corpus/protocol/, one
+// notification stream per file. The fuzz mutates the seeds and feeds each
+// result whole and in random pieces: the packets must be the same either
+// way, each exactly reply_size() long. Build with POI_HOST_SANITIZE=ON to
+// have the bounds checked too. A stream that ever breaks the decoder goes
+// into the corpus as a new file.
+//   test_protocol <corpus dir>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include "poi_protocol.h"
+#include "host_test.h"
+
+using namespace poi_proto;
+
+#define FUZZ_RUNS 2000000
+
+typedef std::vector<uint8_t> bytes;
+
+static_assert(packet<config_reply> && packet<seq_end_reply> && packet<status_reply> && packet<timed_hdr>);
+
+constexpr bool begin_round_trip() {
+    uint8_t b[seq_begin_req::wire_size] = {};
+    encode(seq_begin_req{7, 1000, 0xDEADBEEF, 55, 25, 120}, b);
+    seq_begin_req m{};
+    return decode(std::span<const uint8_t>(b), m) && m.id == 7 && m.len == 1000 && m.crc == 0xDEADBEEF &&
+           m.frames == 55 && m.fps == 25 && m.num_leds == 120;
+}
+static_assert(begin_round_trip());
+
+// Packets notify_decoder finds in s, fed in pieces of at most step bytes (0 = random sizes)
+static std::vector<bytes> packets(const bytes &s, size_t step) {
+    std::vector<bytes> out;
+    notify_decoder d{};
+    for (size_t i = 0; i < s.size();) {
+        size_t n = step ? step : 1 + test_rand() % 24;
+        n = std::min(n, s.size() - i);
+        d.feed(std::span<const uint8_t>(&s[i], n), [&](std::span<const uint8_t> p) {
+            CHECK(p.size() >= HDR_LEN && p[0] == START_BYTE && p.size() == reply_size(p[1]));
+            out.emplace_back(p.begin(), p.end());
+        });
+        i += n;
+    }
+    return out;
+}
+
+template <packet T>
+static void append(bytes &s, const T &m) {
+    uint8_t b[T::wire_size];
+    CHECK(encode(m, b) == T::wire_size);
+    CHECK(encode(m, std::span<uint8_t>(b, T::wire_size - 1)) == 0); // Too small: nothing written
+    s.insert(s.end(), b, b + T::wire_size);
+}
+
+static void round_trips() {
+    bytes s;
+    append(s, config_reply{6, 72, 4096, 244, 3900, 512});
+    s.insert(s.end(), {0x55, START_BYTE, 0x99}); // Stray bytes and an unknown cmd
+    append(s, time_sync_reply{1, 2});
+    append(s, seq_end_reply{3, 0, 777});
+    append(s, status_reply{1234, 3, 8, 3850, 480, 2});
+    for (size_t step = 1; step <= s.size(); step++) {
+        std::vector<bytes> got = packets(s, step);
+        CHECK(got.size() == 4);
+        config_reply c;
+        time_sync_reply t;
+        seq_end_reply e;
+        status_reply st;
+        CHECK(decode(got[0], c) && c.num_leds == 72 && c.battery_mv == 3900 && c.free_space_kb == 512);
+        CHECK(decode(got[1], t) && t.t0_us == 1 && t.t1_us == 2);
+        CHECK(decode(got[2], e) && e.have == 777);
+        CHECK(decode(got[3], st) && st.last_seq == 1234 && st.late == 2);
+        CHECK(!decode(got[0], t)); // Another cmd
+    }
+    printf("round trips ok, %zu-byte stream in every piece size\n", s.size());
+}
+
+static std::vector<bytes> load_corpus(const char *dir) {
+    std::vector<std::filesystem::path> files;
+    for (const auto &e : std::filesystem::directory_iterator(dir)) files.push_back(e.path());
+    std::sort(files.begin(), files.end()); // Same seeds in the same order, same run
+    std::vector<bytes> seeds;
+    for (const auto &path : files) {
+        std::ifstream f(path, std::ios::binary);
+        seeds.emplace_back(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+    }
+    CHECK(!seeds.empty());
+    return seeds;
+}
+
+static bytes mutate(const std::vector<bytes> &seeds) {
+    bytes s = seeds[test_rand() % seeds.size()];
+    for (uint32_t m = 1 + test_rand() % 4; m; m--) {
+        size_t at = s.empty() ? 0 : test_rand() % s.size();
+        switch (test_rand() % 5) {
+            case 0: { // Splice in another seed
+                const bytes &o = seeds[test_rand() % seeds.size()];
+                s.insert(s.begin() + at, o.begin(), o.end());
+                break;
+            }
+            case 1:
+                if (!s.empty()) s[at] ^= (uint8_t)(1 << (test_rand() % 8));
+                break;
+            case 2:
+                if (!s.empty()) s.erase(s.begin() + at);
+                break;
+            case 3: // Bytes the decoder cares about
+                s.insert(s.begin() + at, test_rand() % 2 ? START_BYTE : (uint8_t)(CC_START_STREAM + test_rand() % 13));
+                break;
+            default:
+                s.insert(s.begin() + at, (uint8_t)test_rand());
+                break;
+        }
+    }
+    return s;
+}
+
+static void fuzz(const char *dir) {
+    std::vector<bytes> seeds = load_corpus(dir);
+    uint64_t found = 0;
+    for (const bytes &s : seeds) CHECK(packets(s, 0) == packets(s, s.size() ? s.size() : 1));
+    for (int r = 0; r < FUZZ_RUNS; r++) {
+        bytes s = mutate(seeds);
+        std::vector<bytes> whole = packets(s, std::max<size_t>(s.size(), 1));
+        CHECK(packets(s, 0) == whole);
+        for (const bytes &p : whole) {
+            config_reply c;
+            time_sync_reply t;
+            seq_begin_reply b;
+            status_reply st;
+            CHECK(decode(p, c) + decode(p, t) + decode(p, b) + decode(p, st) <= 1);
+        }
+        found += whole.size();
+    }
+    printf("fuzz ok: %zu seeds, %d mutated streams, %llu packets\n", seeds.size(), FUZZ_RUNS,
+           (unsigned long long)found);
+}
+
+static void bench() {
+    const int n = 10000000;
+    bytes s;
+    append(s, config_reply{6, 72, 4096, 244, 3900, 512});
+    append(s, time_sync_reply{1, 2});
+    append(s, seq_end_reply{3, 0, 777});
+    uint8_t out[16];
+    volatile uint32_t sink = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        encode(seq_begin_req{(uint8_t)i, (uint32_t)i, (uint32_t)i * 3, 1, 2, 3}, out);
+        asm volatile("" ::"r"(out) : "memory");
+        sink = sink + out[5];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++) {
+        config_reply c{};
+        asm volatile("" ::"r"(s.data()) : "memory");
+        decode(std::span<const uint8_t>(s.data(), config_reply::wire_size), c);
+        sink = sink + c.battery_mv;
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    notify_decoder d{};
+    for (int i = 0; i < n / 10; i++) {
+        asm volatile("" ::"r"(s.data()) : "memory");
+        d.feed(std::span<const uint8_t>(s), [&](std::span<const uint8_t> p) { sink = sink + p[1]; });
+    }
+    auto t3 = std::chrono::steady_clock::now();
+    auto ns = [](auto a, auto b, double k) { return std::chrono::duration<double, std::nano>(b - a).count() / k; };
+    printf("encode seq_begin %.2f ns, decode config_reply %.2f ns, notify_decoder %.2f ns/byte\n", ns(t0, t1, n),
+           ns(t1, t2, n), ns(t2, t3, (double)n / 10 * s.size()));
+}
+
+int main(int argc, char **argv) {
+    test_seed(0x6C8E9CF5);
+    CHECK(argc == 2);
+    round_trips();
+    fuzz(argv[1]);
+    bench();
+    puts("protocol ok");
+    return 0;
+}
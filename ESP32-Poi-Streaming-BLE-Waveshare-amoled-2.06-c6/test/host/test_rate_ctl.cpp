@@ -0,0 +1,245 @@
+// poi_rate_ctl on a link whose capacity follows a script. A 50 fps render of
+// 72 LEDs goes through the real tx_sched, rate controller, codec and batch
+// writer into a link that drains so many bytes/s on 15 ms connection
+// events, four writes deep; a poi-side codec decodes everything delivered.
+// Each script runs with a fixed quality, with frame thinning only, and with
+// the 4-bit ladder. Counts frames shown within 140 ms of render.
+//   test_rate_ctl [dir]   also writes <dir>/rate_ctl_<script>_<mode>.csv:
+//                         t, capacity, delivered fps, p95 latency, level per 0.5 s
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+#include "poi_rate_ctl.h"
+#include "poi_tx_sched.h"
+#include "poi_frame_codec.h"
+#include "poi_batch.h"
+#include "poi_protocol.h"
+#include "host_test.h"
+
+#define LEDS       72
+#define LEN        (LEDS * 3)
+#define RING       16     // FRAME_RING_SIZE
+#define FPS        50
+#define ITVL_US    15000
+#define MSYS       8
+#define IN_FLIGHT  4      // Writes the link holds
+#define WRITE_CAP  244
+#define ON_TIME_MS 140
+#define RUN_S      45
+
+enum { FIXED, THIN, PACKED4, MODES };
+static const char *const mode_name[MODES] = {"fixed", "thinning", "4-bit"};
+
+struct frame {
+    int64_t t;
+    uint8_t rgb[LEN];
+};
+
+struct att_write {
+    int len;
+    std::vector<int64_t> rendered;
+    std::vector<uint8_t> cmds;
+    std::vector<std::vector<uint8_t>> bodies;
+    std::vector<std::vector<uint8_t>> sent; // What the poi must end up showing
+};
+
+struct result {
+    double fps, on_time_fps, p50_ms, p95_ms;
+    int decode_errors;
+};
+
+// Bytes/s the link carries at t
+static double capacity(int script, double t) {
+    if (script == 0) { // Steps, then a wobble
+        if (t < 5) return 9000;
+        if (t < 12) return 3000;
+        if (t < 20) return 1500;
+        if (t < 30) return 9000;
+        return 4000 + 3500 * sin(t);
+    }
+    return 2500 + 6000 * (0.5 + 0.5 * sin(t * 2 * M_PI / 8)); // Fades as the poi swings behind the body
+}
+
+// A slow rainbow at the brightness the modes use, one pixel flickering now and then
+static void render(frame *f, uint32_t n, int64_t t) {
+    for (int i = 0; i < LEDS; i++) {
+        double h = fmod(i / (double)LEDS + t * 1e-6 * 0.3, 1.0) * 6, fr = h - (int)h, r, g, b;
+        switch ((int)h) {
+            case 0: r = 1, g = fr, b = 0; break;
+            case 1: r = 1 - fr, g = 1, b = 0; break;
+            case 2: r = 0, g = 1, b = fr; break;
+            case 3: r = 0, g = 1 - fr, b = 1; break;
+            case 4: r = fr, g = 0, b = 1; break;
+            default: r = 1, g = 0, b = 1 - fr; break;
+        }
+        f->rgb[i * 3] = (uint8_t)(r * 69);
+        f->rgb[i * 3 + 1] = (uint8_t)(g * 69);
+        f->rgb[i * 3 + 2] = (uint8_t)(b * 69);
+    }
+    if (n % 7 == 0) f->rgb[(n * 13 % LEDS) * 3 + 1] = 68;
+}
+
+// What the poi does with a frame of a batch
+static int apply(poi_frame_codec_t *dec, uint8_t cmd, const std::vector<uint8_t> &body, uint8_t *shown) {
+    if (cmd == poi_proto::CC_STREAM_COMPRESSED) return poi_codec_decode(dec, body.data(), body.size(), shown, LEN);
+    memcpy(shown, body.data(), LEN); // A raw frame is a keyframe too
+    memcpy(dec->ref, shown, LEN);
+    dec->ref_len = LEN;
+    return 0;
+}
+
+static result run(int script, int mode, const char *csv_dir) {
+    static frame ring[RING];
+    uint32_t rendered = 0, next_seq = 0;
+    poi_tx_sched_t tx;
+    poi_tx_sched_init(&tx, ITVL_US, 1);
+    poi_rate_ctl_t rate;
+    poi_rate_ctl_init(&rate, &tx, mode == PACKED4, 60000, 1);
+    poi_frame_codec_t enc = {}, dec = {};
+    enc.packed4 = dec.packed4 = mode == PACKED4;
+
+    std::deque<att_write> link;
+    double budget = 0;
+    int64_t next_event = ITVL_US, next_render = 0;
+    std::vector<double> window, all;
+    int window_frames = 0, bad = 0;
+    long on_time = 0;
+    double window_start = 0;
+    uint8_t shown[LEN];
+
+    FILE *csv = nullptr;
+    if (csv_dir) {
+        std::string path = std::string(csv_dir) + "/rate_ctl_" + std::to_string(script) + "_" + mode_name[mode] + ".csv";
+        csv = fopen(path.c_str(), "w");
+        CHECK(csv);
+        fprintf(csv, "t,capacity,fps,lat_ms_p95,level\n");
+    }
+
+    for (int64_t now = 1; now < RUN_S * 1000000LL; now += 1000) {
+        if (now >= next_render) {
+            next_render += 1000000 / FPS;
+            frame *f = &ring[rendered % RING];
+            f->t = now;
+            render(f, rendered, now);
+            rendered++;
+        }
+
+        if (now >= next_event) { // The link drains what the event carries, in order
+            next_event += ITVL_US;
+            budget += capacity(script, now * 1e-6) * ITVL_US * 1e-6;
+            if (link.empty()) budget = std::min(budget, 300.0); // Idle airtime isn't saved up
+            while (!link.empty() && budget >= link.front().len) {
+                att_write &w = link.front();
+                budget -= w.len;
+                for (size_t k = 0; k < w.rendered.size(); k++) {
+                    double ms = (now - w.rendered[k]) / 1000.0;
+                    window.push_back(ms);
+                    all.push_back(ms);
+                    window_frames++;
+                    if (ms <= ON_TIME_MS) on_time++;
+                    if (apply(&dec, w.cmds[k], w.bodies[k], shown) != 0 || memcmp(shown, w.sent[k].data(), LEN) != 0) bad++;
+                }
+                link.pop_front();
+            }
+        }
+
+        if (now % 5000 == 1) { // TX_TICK_MS
+            bool ready = next_seq != rendered && poi_tx_sched_ready(&tx, now, MSYS - (int)link.size());
+            if (next_seq != rendered) poi_rate_ctl_sample_depth(&rate, (uint8_t)link.size());
+            if (ready) {
+                if (rendered - next_seq > RING) { // Overwritten in the ring
+                    tx.frames_superseded += rendered - next_seq - RING;
+                    next_seq = rendered - RING;
+                }
+                uint32_t first = next_seq;
+                poi_frame_codec_t saved = enc;
+                uint8_t buf[WRITE_CAP];
+                poi_batch_t b;
+                poi_batch_begin(&b, buf, WRITE_CAP);
+                att_write w{};
+                const frame *prev = nullptr;
+                for (; next_seq != rendered; next_seq++) {
+                    const frame *f = &ring[next_seq % RING];
+                    if (!poi_rate_ctl_wants(&rate, next_seq)) {
+                        rate.thinned++;
+                        continue;
+                    }
+                    uint8_t quant[LEN];
+                    const uint8_t *rgb = f->rgb;
+                    if (rate.reduced_depth) {
+                        poi_codec_reduce_depth(rgb, LEN, quant);
+                        rgb = quant;
+                    }
+                    uint8_t body[1 + POI_CODEC_MAX_BYTES];
+                    size_t len = poi_codec_encode(&enc, rgb, LEN, body, sizeof(body));
+                    uint8_t type = body[0], cmd = poi_proto::CC_STREAM_COMPRESSED;
+                    if (type == POI_FRAME_KEY_RAW) { // Goes out as plain CC_STREAM_DATA
+                        cmd = poi_proto::CC_STREAM_DATA;
+                        memmove(body, &body[1], LEN);
+                        len = LEN;
+                    }
+                    uint32_t dt = prev ? (uint32_t)(f->t - prev->t) / 1000 : 0;
+                    if (!poi_batch_add(&b, (uint8_t)std::min<uint32_t>(dt, 255), cmd, body, len)) break;
+                    poi_codec_commit(&enc, rgb, LEN, type, len);
+                    w.rendered.push_back(f->t);
+                    w.cmds.push_back(cmd);
+                    w.bodies.emplace_back(body, body + len);
+                    w.sent.emplace_back(rgb, rgb + LEN);
+                    prev = f;
+                }
+                if (!w.rendered.empty()) {
+                    poi_rate_ctl_sample_latency(&rate, (uint32_t)(now - w.rendered[0]));
+                    w.len = (w.rendered.size() == 1 ? (int)(poi_proto::HDR_LEN + w.bodies[0].size()) : b.len) + 3 + 4; // ATT, L2CAP
+                    if (link.size() < IN_FLIGHT) {
+                        poi_tx_sched_complete(&tx, POI_TX_OK, (uint16_t)w.rendered.size(), (uint16_t)w.len);
+                        link.push_back(std::move(w));
+                    } else { // ENOMEM: back to the first frame, from a keyframe
+                        poi_tx_sched_complete(&tx, POI_TX_BUSY, 0, 0);
+                        next_seq = first;
+                        enc = saved;
+                        poi_codec_reset(&enc);
+                    }
+                }
+            }
+            if (mode != FIXED) poi_rate_ctl_update(&rate, &tx, now);
+        }
+
+        if (now * 1e-6 - window_start >= 0.5) {
+            std::sort(window.begin(), window.end());
+            double p95 = window.empty() ? 0 : window[(size_t)(window.size() * 0.95)];
+            if (csv) fprintf(csv, "%.1f,%.0f,%.1f,%.0f,%d\n", now * 1e-6, capacity(script, now * 1e-6), window_frames / 0.5, p95, rate.level);
+            window.clear();
+            window_frames = 0;
+            window_start = now * 1e-6;
+        }
+    }
+    if (csv) fclose(csv);
+    CHECK(!all.empty());
+    std::sort(all.begin(), all.end());
+    return {all.size() / (double)RUN_S, on_time / (double)RUN_S, all[all.size() / 2], all[all.size() * 95 / 100], bad};
+}
+
+int main(int argc, char **argv) {
+    const char *csv_dir = argc > 1 ? argv[1] : nullptr;
+    for (int script = 0; script < 2; script++) {
+        printf("%s:\n", script == 0 ? "steps 9000 -> 3000 -> 1500 -> 9000 B/s, then a wobble" : "8 s sine fade 2500-8500 B/s");
+        result r[MODES];
+        for (int mode = 0; mode < MODES; mode++) {
+            r[mode] = run(script, mode, csv_dir);
+            printf("  %-8s %5.1f fps delivered, %5.1f on time, latency p50 %4.0f ms p95 %4.0f ms\n", mode_name[mode],
+                   r[mode].fps, r[mode].on_time_fps, r[mode].p50_ms, r[mode].p95_ms);
+            CHECK(r[mode].decode_errors == 0); // Packed and thinned frames decode bit exact
+        }
+        CHECK(r[THIN].on_time_fps > r[FIXED].on_time_fps + 5);
+        CHECK(r[PACKED4].on_time_fps > r[THIN].on_time_fps);
+        CHECK(r[THIN].p50_ms < 50 && r[PACKED4].p50_ms < 50);
+    }
+    puts("rate_ctl ok");
+    return 0;
+}
@@ -0,0 +1,162 @@
+// Sequence upload against the reference receiver: chunking at the write
+// sizes a link can have, resume after a disconnect, refill of dropped
+// chunks, a corrupted chunk caught by the CRC, a poi without room, and a
+// poi that never answers. Every stored sequence must decode frame by frame.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <random>
+#include <vector>
+#include "poi_seq.h"
+#include "poi_frame_codec.h"
+#include "host_test.h"
+
+#define LEDS   40
+#define FRAMES 200
+#define FPS    25
+
+static uint8_t flash[32768];
+
+static std::vector<uint8_t> make_seq(uint16_t *frames) {
+    static uint8_t buf[32768];
+    poi_seq_builder_t b;
+    poi_seq_builder_init(&b, buf, sizeof(buf));
+    uint8_t rgb[LEDS * 3];
+    for (int f = 0; f < FRAMES; f++) {
+        for (int i = 0; i < LEDS; i++) {
+            rgb[i * 3] = (uint8_t)(i * 7 + f * 3);
+            rgb[i * 3 + 1] = i < LEDS / 2 ? 0 : 200;
+            rgb[i * 3 + 2] = f & 1 ? 50 : 0;
+        }
+        if (!poi_seq_builder_add(&b, rgb, sizeof(rgb))) break;
+    }
+    *frames = b.frames;
+    return std::vector<uint8_t>(buf, buf + b.len);
+}
+
+// What the link does to the writes of one upload
+struct link {
+    int drop_every = 0;     // Lose every nth chunk
+    int corrupt_at = -1;    // Flip bits in this write if it is a chunk
+    int disconnect_at = -1; // Lose this write with the link
+    int writes = 0;
+};
+
+static void run(poi_seq_upload_t &u, poi_seq_rx_t &rx, link &l, size_t write_len) {
+    uint8_t out[256], reply[16];
+    int64_t now = 0;
+    for (int step = 0; u.state != POI_SEQ_UP_DONE && u.state != POI_SEQ_UP_FAILED; step++) {
+        CHECK(step < 100000);
+        now += 7500;
+        poi_seq_upload_poll(&u, now);
+        size_t n = poi_seq_upload_next(&u, out, write_len);
+        if (!n) continue;
+        CHECK(n <= write_len);
+        poi_seq_upload_sent(&u, now);
+        l.writes++;
+        bool chunk = out[1] == poi_proto::CC_SEQ_CHUNK;
+        if (l.writes == l.disconnect_at) {
+            poi_seq_upload_restart(&u);
+            continue;
+        }
+        if (chunk && l.drop_every && l.writes % l.drop_every == 0) continue;
+        if (chunk && l.writes == l.corrupt_at) out[10] ^= 0x55;
+        size_t r = poi_seq_rx_write(&rx, out, n, reply);
+        if (r) poi_seq_upload_reply(&u, reply, r);
+    }
+}
+
+static void check_decodes(const poi_seq_rx_t &rx, uint16_t frames) {
+    poi_frame_codec_t c = {};
+    uint8_t rgb[LEDS * 3];
+    uint32_t off = 0;
+    const uint8_t *f;
+    uint16_t len;
+    int n = 0;
+    while (poi_seq_next_frame(rx.store, rx.len, &off, &f, &len)) {
+        CHECK(poi_codec_decode(&c, f, len, rgb, sizeof(rgb)) == 0);
+        n++;
+    }
+    CHECK(n == frames && off == rx.len);
+}
+
+static void start(poi_seq_upload_t &u, poi_seq_rx_t &rx, uint8_t id, const std::vector<uint8_t> &seq, uint16_t frames,
+                  uint32_t store) {
+    poi_seq_upload_init(&u, id, seq.data(), seq.size(), frames, FPS, LEDS);
+    poi_seq_rx_init(&rx, flash, store);
+}
+
+int main() {
+    uint16_t frames;
+    std::vector<uint8_t> seq = make_seq(&frames);
+    CHECK(frames == FRAMES);
+    printf("sequence: %u frames, %zu bytes (raw %u)\n", frames, seq.size(), frames * LEDS * 3);
+    poi_seq_upload_t u;
+    poi_seq_rx_t rx;
+
+    for (size_t write_len : {20, 64, 244}) {
+        link l;
+        start(u, rx, 1, seq, frames, sizeof(flash));
+        run(u, rx, l, write_len);
+        CHECK(u.state == POI_SEQ_UP_DONE && rx.complete && memcmp(flash, seq.data(), seq.size()) == 0);
+        size_t per_chunk = write_len - poi_proto::seq_chunk_hdr::wire_size;
+        size_t chunks = (seq.size() + per_chunk - 1) / per_chunk;
+        printf("%3zu byte writes: %d writes (%zu chunks + BEGIN + END)\n", write_len, l.writes, chunks);
+        CHECK((size_t)l.writes == chunks + 2);
+        check_decodes(rx, frames);
+    }
+
+    { // The second BEGIN resumes at the poi's offset
+        link l;
+        l.disconnect_at = 20;
+        start(u, rx, 2, seq, frames, sizeof(flash));
+        run(u, rx, l, 244);
+        CHECK(u.state == POI_SEQ_UP_DONE && rx.complete && u.resumed_at > 0);
+        CHECK(memcmp(flash, seq.data(), seq.size()) == 0);
+        printf("disconnect: resumed at %u of %zu, %d writes\n", u.resumed_at, seq.size(), l.writes);
+    }
+    { // Dropped chunks are refilled after END reports the sequence incomplete
+        link l;
+        l.drop_every = 9;
+        start(u, rx, 3, seq, frames, sizeof(flash));
+        run(u, rx, l, 244);
+        CHECK(u.state == POI_SEQ_UP_DONE && memcmp(flash, seq.data(), seq.size()) == 0);
+        printf("drops: done in %d writes\n", l.writes);
+    }
+    { // The poi discards a sequence that fails its CRC and the upload starts over
+        link l;
+        l.corrupt_at = 5;
+        start(u, rx, 4, seq, frames, sizeof(flash));
+        run(u, rx, l, 244);
+        CHECK(u.state == POI_SEQ_UP_DONE && u.retries == 1 && memcmp(flash, seq.data(), seq.size()) == 0);
+        printf("corrupt chunk: caught by the CRC, re-sent, %d writes\n", l.writes);
+    }
+    { // No room on the poi
+        link l;
+        start(u, rx, 5, seq, frames, 100);
+        run(u, rx, l, 244);
+        CHECK(u.state == POI_SEQ_UP_FAILED);
+        puts("no room: rejected");
+    }
+    { // A silent poi is retried, then given up on
+        uint8_t out[256];
+        int64_t now = 0;
+        poi_seq_upload_init(&u, 6, seq.data(), seq.size(), frames, FPS, LEDS);
+        while (u.state != POI_SEQ_UP_FAILED) {
+            now += 10000;
+            CHECK(now < 10000000);
+            poi_seq_upload_poll(&u, now);
+            if (poi_seq_upload_next(&u, out, 244)) poi_seq_upload_sent(&u, now);
+        }
+        printf("silent poi: failed after %.1f s\n", now / 1e6);
+    }
+
+    uint8_t tick[poi_proto::seq_play_req::wire_size];
+    poi_seq_play(&u, 17, 123456, tick);
+    poi_proto::seq_play_req play;
+    CHECK(poi_proto::decode({tick, sizeof(tick)}, play) && play.id == 6 && play.frame == 17 && play.pts_us == 123456);
+    CHECK(poi_crc32(0, (const uint8_t *)"123456789", 9) == 0xCBF43926); // CRC-32 check value
+    puts("seq ok");
+    return 0;
+}
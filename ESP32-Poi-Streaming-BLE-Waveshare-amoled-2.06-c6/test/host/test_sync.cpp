@@ -0,0 +1,135 @@
+// Inter-poi skew with and without presentation timestamps. Four poi run
+// clocks with random offsets and up to +-40 ppm drift; every link loses
+// packets and delays them by a connection interval plus jitter with a long
+// tail. The watch syncs each clock with poi_clock_sync_*, stamps every frame
+// PLAYOUT_LATENCY_MS ahead, and each poi plays frames out through
+// poi_playout_check(). Skew is the spread of the times the poi show a frame,
+// compared with showing it on arrival.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <vector>
+#include "poi_sync.h"
+#include "host_test.h"
+
+#define POI        4
+#define RUN_US     120000000
+#define FRAME_US   40000  // FRAME_INTERVAL_MS
+#define LATENCY_US 120000 // PLAYOUT_LATENCY_MS
+#define ITVL_US    7500   // Connection interval: the least a packet takes
+
+struct poi {
+    double drift;
+    int64_t offset;
+    poi_clock_sync_t sync;
+    poi_playout_t playout;
+    std::vector<std::pair<int, uint32_t>> held; // seq, pts of frames waiting for their time
+};
+
+struct packet {
+    int64_t at;
+    int poi;
+    bool reply; // Time sync reply, else a frame
+    uint32_t t0, t1;
+    int seq;
+    uint32_t pts;
+    bool operator>(const packet &o) const { return at > o.at; }
+};
+
+struct skew {
+    double p50, p99;
+};
+
+static skew spread(const std::map<int, std::vector<int64_t>> &at) {
+    std::vector<double> ms;
+    for (const auto &[seq, t] : at) {
+        if (seq < 50 || t.size() < 2) continue; // Past the first sync, shown on at least two poi
+        auto [lo, hi] = std::minmax_element(t.begin(), t.end());
+        ms.push_back((*hi - *lo) / 1000.0);
+    }
+    CHECK(!ms.empty());
+    std::sort(ms.begin(), ms.end());
+    return {ms[ms.size() / 2], ms[ms.size() * 99 / 100]};
+}
+
+static void run(double loss, double jitter_us, skew &arrival, skew &timed) {
+    test_seed(0x2F6B3A1D);
+    poi p[POI] = {};
+    for (poi &q : p) {
+        q.drift = (test_uniform() - 0.5) * 80e-6;
+        q.offset = (int64_t)(test_uniform() * 1e9);
+        poi_clock_sync_reset(&q.sync, 0);
+    }
+    auto clock = [&](int i, int64_t t) { return (uint32_t)(int64_t)(t * (1 + p[i].drift) + p[i].offset); };
+    auto delay = [&]() { return (int64_t)(ITVL_US + test_uniform() * jitter_us + (test_uniform() < 0.1 ? test_uniform() * jitter_us * 2 : 0)); };
+
+    std::priority_queue<packet, std::vector<packet>, std::greater<packet>> air;
+    std::map<int, std::vector<int64_t>> arrived, shown;
+    int seq = 0;
+    for (int64_t t = 0; t < RUN_US; t += 1000) {
+        for (int i = 0; i < POI; i++) {
+            uint8_t req[POI_TIME_SYNC_LEN];
+            if (poi_clock_sync_request(&p[i].sync, t, req) && test_uniform() > loss) {
+                int64_t rx = t + delay(); // The poi answers on receipt
+                if (test_uniform() > loss) air.push({rx + delay(), i, true, (uint32_t)t, clock(i, rx), 0, 0});
+            }
+        }
+        if (t % FRAME_US == 0) {
+            for (int i = 0; i < POI; i++) {
+                if (test_uniform() > loss) {
+                    uint32_t pts = p[i].sync.valid ? poi_clock_sync_to_peer(&p[i].sync, t + LATENCY_US) : 0;
+                    air.push({t + delay(), i, false, 0, 0, seq, pts});
+                }
+            }
+            seq++;
+        }
+        while (!air.empty() && air.top().at <= t) {
+            packet e = air.top();
+            air.pop();
+            if (e.reply) {
+                uint8_t r[POI_TIME_SYNC_REPLY_LEN];
+                poi_proto::encode(poi_proto::time_sync_reply{e.t0, e.t1}, {r, sizeof(r)});
+                poi_clock_sync_reply(&p[e.poi].sync, r, sizeof(r), t);
+            } else {
+                arrived[e.seq].push_back(t);
+                if (e.pts) p[e.poi].held.push_back({e.seq, e.pts});
+            }
+        }
+        for (int i = 0; i < POI; i++) {
+            auto &h = p[i].held;
+            std::sort(h.begin(), h.end());
+            while (!h.empty()) {
+                poi_play_action_t a = poi_playout_check(&p[i].playout, (uint16_t)h[0].first, h[0].second, clock(i, t));
+                if (a == POI_PLAY_WAIT) break;
+                if (a == POI_PLAY_SHOW) shown[h[0].first].push_back(t);
+                h.erase(h.begin());
+            }
+        }
+    }
+    arrival = spread(arrived);
+    timed = spread(shown);
+    for (int i = 0; i < POI; i++) {
+        const poi_playout_t &q = p[i].playout;
+        CHECK(q.shown > (uint32_t)seq * (1 - loss) * 0.9); // Timing drops next to nothing itself
+        printf("  poi %d: drift %+5.1f ppm, shown %u late %u stale %u\n", i, p[i].drift * 1e6, q.shown, q.late, q.stale);
+    }
+}
+
+int main() {
+    static const struct {
+        double loss, jitter_us;
+    } cases[] = {{0.05, 40000}, {0.10, 80000}};
+    for (const auto &c : cases) {
+        skew arrival, timed;
+        printf("loss %.0f%%, jitter up to %.0f ms:\n", c.loss * 100, c.jitter_us / 1000);
+        run(c.loss, c.jitter_us, arrival, timed);
+        printf("  on arrival: skew p50 %.1f ms, p99 %.1f ms\n", arrival.p50, arrival.p99);
+        printf("  timed:      skew p50 %.1f ms, p99 %.1f ms\n", timed.p50, timed.p99);
+        CHECK(timed.p99 < arrival.p99 / 2);
+    }
+    puts("sync ok");
+    return 0;
+}
@@ -0,0 +1,81 @@
+// poi_tx_sched against a simulated link: stream_task's 5 ms send loop and
+// 40 ms render cadence feeding a controller that clears a fixed number of
+// packets per connection event out of a shared msys pool. Checks the rate
+// each link settles at and how rarely the stack runs out of buffers.
+
+#include <stdint.h>
+#include <stdio.h>
+#include "poi_tx_sched.h"
+#include "host_test.h"
+
+#define RENDER_US   40000 // FRAME_INTERVAL_MS
+#define TICK_US     5000  // TX_TICK_MS
+#define MSYS_BLOCKS 32    // CONFIG_BT_NIMBLE_MSYS_1_BLOCK_COUNT
+#define RUN_US      20000000
+
+struct link {
+    uint32_t itvl_us;
+    int pkts_per_event;
+    int stack_slots; // Writes NimBLE queues for the link before it returns ENOMEM
+    float min_share; // Of the rate the link carries (at most 25 fps) it must reach
+};
+
+struct result {
+    float fps;
+    uint32_t rendered;
+    uint32_t superseded;
+    uint32_t busy;
+};
+
+static result run(const link &l) {
+    poi_tx_sched_t s;
+    poi_tx_sched_init(&s, l.itvl_us, 0);
+    int queued = 0;
+    bool pending = false;
+    uint32_t rendered = 0;
+    int64_t next_event = l.itvl_us, next_render = 0;
+    for (int64_t now = 0; now < RUN_US; now += TICK_US) {
+        while (next_event <= now) {
+            queued -= queued < l.pkts_per_event ? queued : l.pkts_per_event;
+            next_event += l.itvl_us;
+        }
+        if (now >= next_render) { // A newer render replaces a frame still waiting
+            if (pending) s.frames_superseded++;
+            pending = true;
+            rendered++;
+            next_render += RENDER_US;
+        }
+        if (pending && poi_tx_sched_ready(&s, now, MSYS_BLOCKS - queued)) {
+            if (queued >= l.stack_slots) {
+                poi_tx_sched_complete(&s, POI_TX_BUSY, 0, 0);
+            } else {
+                queued++;
+                poi_tx_sched_complete(&s, POI_TX_OK, 1, 70);
+                pending = false;
+            }
+        }
+    }
+    return {s.frames_sent * 1e6f / RUN_US, rendered, s.frames_superseded, s.busy_count};
+}
+
+int main() {
+    static const link links[] = {
+        {50000, 1, 8, 0.95f}, // Slow peripheral: one packet per 50 ms event
+        {30000, 1, 8, 0.95f},
+        {15000, 2, 8, 0.95f},
+        {7500, 4, 8, 0.95f},
+        {50000, 1, 2, 0.80f}, // Few stack buffers: each ENOMEM halves the drain estimate, which then undershoots
+    };
+    printf("itvl_ms pkts/evt slots   fps  superseded  busy\n");
+    for (const link &l : links) {
+        result r = run(l);
+        printf("%7.1f %8d %5d %5.1f %11lu %5lu\n", l.itvl_us / 1000.0, l.pkts_per_event, l.stack_slots, r.fps,
+               (unsigned long)r.superseded, (unsigned long)r.busy);
+        float link_fps = 1e6f * l.pkts_per_event / l.itvl_us;
+        float expect = link_fps < 25 ? link_fps : 25;
+        CHECK(r.fps > expect * l.min_share && r.fps < expect * 1.03f); // Plus what is still queued at the end
+        CHECK(r.busy < r.rendered / 10); // The drain estimate keeps ENOMEM rare
+    }
+    puts("tx_sched ok");
+    return 0;
+}